@@ -69,6 +69,23 @@ void ACROBOTIC_SSD1306::sendCommand(unsigned char command)
   Wire.endTransmission();                       // End I2C communication
 }
 
+void ACROBOTIC_SSD1306::sendCommands(const unsigned char *commands, unsigned char n)
+{
+  // One transaction for the lot: Co = 0 means every following byte is a
+  // command, so the control byte is only sent once.
+  while(n)
+  {
+    unsigned char len = n;
+    if(len > SSD1306_Wire_Max-1) len = SSD1306_Wire_Max-1;
+    Wire.beginTransmission(SSD1306_Address);
+    Wire.write((uint8_t)0x00);
+    Wire.write(commands, len);
+    Wire.endTransmission();
+    commands += len;
+    n -= len;
+  }
+}
+
 void ACROBOTIC_SSD1306::setBrightness(unsigned char Brightness)
 {
    sendCommand(SSD1306_Set_Brightness_Cmd);
@@ -98,17 +115,16 @@ void ACROBOTIC_SSD1306::setTextXY(unsigned char row, unsigned char col)
 
 void ACROBOTIC_SSD1306::clearDisplay()
 {
-  unsigned char i,j;
+  unsigned char j;
+  unsigned char blank[SSD1306_Max_X+1];
+  memset(blank, 0, sizeof(blank));
   sendCommand(SSD1306_Display_Off_Cmd);     //display off
   for(j=0;j<8;j++)
   {    
-    setTextXY(j,0);    
-    {
-      for(i=0;i<16;i++)  //clear all columns
-      {
-        putChar(' ');    
-      }
-    }
+    sendCommand(0xB0 + j);                  //set page address
+    sendCommand(0x00);                      //set column lower addr
+    sendCommand(0x10);                      //set column higher addr
+    sendData(blank, sizeof(blank));         //clear all columns
   }
   sendCommand(SSD1306_Display_On_Cmd);     //display on
   setTextXY(0,0);    
@@ -122,6 +138,23 @@ void ACROBOTIC_SSD1306::sendData(unsigned char Data)
      Wire.endTransmission();                    // stop I2C transmission
 }
 
+void ACROBOTIC_SSD1306::sendData(const unsigned char *data, unsigned int n)
+{
+  // Split into the longest transactions Wire can buffer, one data-mode
+  // control byte each, instead of a full transaction per byte.
+  while(n)
+  {
+    unsigned int len = n;
+    if(len > SSD1306_Wire_Max-1) len = SSD1306_Wire_Max-1;
+    Wire.beginTransmission(SSD1306_Address);
+    Wire.write(SSD1306_Data_Mode);
+    Wire.write(data, len);
+    Wire.endTransmission();
+    data += len;
+    n -= len;
+  }
+}
+
 bool ACROBOTIC_SSD1306::putChar(unsigned char ch)
 {
     if (!m_font) return 0;
@@ -131,11 +164,16 @@ bool ACROBOTIC_SSD1306::putChar(unsigned char ch)
     {
         ch = ' ';
     }    
-    for(unsigned char i=0;i<m_font_width;i++)
+    unsigned char glyph[16];
+    unsigned char n = m_font_width;
+    if(n > sizeof(glyph)) n = sizeof(glyph);
+    for(unsigned char i=0;i<n;i++)
     {
        // Font array starts at 0, ASCII starts at 32
-       sendData(pgm_read_byte(&m_font[(ch-32)*m_font_width+m_font_offset+i])); 
+       glyph[i] = pgm_read_byte(&m_font[(ch-32)*m_font_width+m_font_offset+i]);
     }
+    sendData(glyph, n);
+    return 1;
 }
 
 void ACROBOTIC_SSD1306::putString(const char *string)
@@ -272,9 +310,15 @@ void ACROBOTIC_SSD1306::drawBitmap(unsigned char *bitmaparray,int bytes)
       setHorizontalMode();
   }
 
-  for(int i=0;i<bytes;i++)
+  unsigned char chunk[SSD1306_Wire_Max-1];
+  for(int i=0;i<bytes;)
   {
-      sendData(pgm_read_byte(&bitmaparray[i]));
+      unsigned char n = 0;
+      while(n < sizeof(chunk) && i < bytes)
+      {
+          chunk[n++] = pgm_read_byte(&bitmaparray[i++]);
+      }
+      sendData(chunk, n);
   }
 
   if(localAddressMode == PAGE_MODE)
@@ -326,5 +370,110 @@ void ACROBOTIC_SSD1306::setInverseDisplay()
     sendCommand(SSD1306_Inverse_Display_Cmd);
 }
 
+bool ACROBOTIC_SSD1306::beginBuffer()
+{
+  if(!m_buffer)
+  {
+    m_buffer = (uint8_t *)malloc((SSD1306_Max_X+1) * SSD1306_Pages);
+    if(!m_buffer) return false;
+  }
+  clearBuffer();
+  return true;
+}
+
+void ACROBOTIC_SSD1306::clearBuffer()
+{
+  if(!m_buffer) return;
+  memset(m_buffer, 0, (SSD1306_Max_X+1) * SSD1306_Pages);
+  markAllDirty();
+}
+
+void ACROBOTIC_SSD1306::markAllDirty()
+{
+  for(unsigned char p=0;p<SSD1306_Pages;p++)
+  {
+    m_dirty_x1[p] = 0;
+    m_dirty_x2[p] = SSD1306_Max_X;
+  }
+}
+
+void ACROBOTIC_SSD1306::setPixel(unsigned char x, unsigned char y, bool on)
+{
+  if(!m_buffer || x > SSD1306_Max_X || y > SSD1306_Max_Y) return;
+  unsigned char page = y >> 3;
+  uint8_t *b = &m_buffer[page * (SSD1306_Max_X+1) + x];
+  uint8_t old = *b;
+  if(on) *b |= (1 << (y & 7));
+  else   *b &= ~(1 << (y & 7));
+  if(*b == old) return;                     // No change, nothing to send
+  if(m_dirty_x1[page] > m_dirty_x2[page])
+  {
+    m_dirty_x1[page] = m_dirty_x2[page] = x;
+  }
+  else if(x < m_dirty_x1[page]) m_dirty_x1[page] = x;
+  else if(x > m_dirty_x2[page]) m_dirty_x2[page] = x;
+}
+
+bool ACROBOTIC_SSD1306::getPixel(unsigned char x, unsigned char y)
+{
+  if(!m_buffer || x > SSD1306_Max_X || y > SSD1306_Max_Y) return false;
+  return m_buffer[(y >> 3) * (SSD1306_Max_X+1) + x] & (1 << (y & 7));
+}
+
+void ACROBOTIC_SSD1306::setWindow(unsigned char x1, unsigned char x2,
+                                  unsigned char page1, unsigned char page2)
+{
+  if(addressingMode == PAGE_MODE)
+  {
+    // Page mode has no window; caller only asks for one page at a time
+    unsigned char cmd[] = {(unsigned char)(0xB0 + page1),
+                           (unsigned char)(x1 & 0x0F),
+                           (unsigned char)(0x10 + (x1 >> 4))};
+    sendCommands(cmd, sizeof(cmd));
+  }
+  else
+  {
+    unsigned char cmd[] = {0x21, x1, x2, 0x22, page1, page2};
+    sendCommands(cmd, sizeof(cmd));
+  }
+}
+
+void ACROBOTIC_SSD1306::display()
+{
+  if(!m_buffer) return;
+  for(unsigned char p=0;p<SSD1306_Pages;p++)
+  {
+    if(m_dirty_x1[p] > m_dirty_x2[p]) continue;
+    unsigned char x1 = m_dirty_x1[p], x2 = m_dirty_x2[p], last = p;
+    // In horizontal mode, fold following dirty pages into the same
+    // window while the extra columns cost less than a new window setup
+    while(addressingMode != PAGE_MODE && last+1 < SSD1306_Pages &&
+          m_dirty_x1[last+1] <= m_dirty_x2[last+1])
+    {
+      unsigned char nx1 = min(x1, m_dirty_x1[last+1]);
+      unsigned char nx2 = max(x2, m_dirty_x2[last+1]);
+      int waste = (nx2 - nx1 + 1) * (last - p + 2);
+      for(unsigned char q=p;q<=last+1;q++)
+        waste -= m_dirty_x2[q] - m_dirty_x1[q] + 1;
+      if(waste > SSD1306_Merge_Slack) break;
+      x1 = nx1;
+      x2 = nx2;
+      last++;
+    }
+    setWindow(x1, x2, p, last);
+    for(unsigned char q=p;q<=last;q++)
+    {
+      sendData(&m_buffer[q * (SSD1306_Max_X+1) + x1], x2 - x1 + 1);
+      m_dirty_x1[q] = SSD1306_Max_X;
+      m_dirty_x2[q] = 0;
+    }
+    p = last;
+  }
+  if(addressingMode != PAGE_MODE)
+  {
+    // Leave the full-screen window that the text functions expect
+    setWindow(0, SSD1306_Max_X, 0, SSD1306_Pages-1);
+  }
+}
 
 ACROBOTIC_SSD1306 oled;  // Pre-instantiate object
@@ -44,6 +44,20 @@
 
 #define SSD1306_Max_X                 127    //128 Pixels
 #define SSD1306_Max_Y                 63     //64  Pixels
+#define SSD1306_Pages                 8      //64 rows / 8 rows per page
+
+// Longest I2C transaction the Wire library can buffer (address excluded)
+#if defined(BUFFER_LENGTH)
+  #define SSD1306_Wire_Max            BUFFER_LENGTH
+#elif defined(I2C_BUFFER_LENGTH)
+  #define SSD1306_Wire_Max            I2C_BUFFER_LENGTH
+#else
+  #define SSD1306_Wire_Max            32
+#endif
+
+// Neighbouring dirty pages share one address window when the merged
+// rectangle wastes no more than this many bytes
+#define SSD1306_Merge_Slack           8
 
 #define PAGE_MODE                     01
 #define HORIZONTAL_MODE               02
@@ -80,7 +94,9 @@ class ACROBOTIC_SSD1306 {
     void setInverseDisplay();
 
     void sendCommand(unsigned char command);
+    void sendCommands(const unsigned char *commands, unsigned char n);
     void sendData(unsigned char Data);
+    void sendData(const unsigned char *data, unsigned int n);
 
     void setPageMode();
     void setHorizontalMode();
@@ -106,7 +122,24 @@ class ACROBOTIC_SSD1306 {
 
     void setFont(const uint8_t* font);
 
+    // Optional 1 KB framebuffer. Pixels drawn into it are only sent by
+    // display(), which transfers just the changed columns of each page.
+    bool beginBuffer();
+    void clearBuffer();
+    void setPixel(unsigned char x, unsigned char y, bool on);
+    bool getPixel(unsigned char x, unsigned char y);
+    uint8_t *getBuffer() { return m_buffer; }
+    void markAllDirty();
+    void display();
+
   private:
+    void setWindow(unsigned char x1, unsigned char x2,
+                   unsigned char page1, unsigned char page2);
+
+    uint8_t* m_buffer = NULL;   // Framebuffer, page-major like display RAM
+    uint8_t m_dirty_x1[SSD1306_Pages]; // First dirty column per page
+    uint8_t m_dirty_x2[SSD1306_Pages]; // Last dirty column (< x1 if clean)
+
     const uint8_t* m_font;      // Current font.
     uint8_t m_font_offset = 2;  // Font bytes for meta data.
     uint8_t m_font_width;       // Font witdth.
@@ -0,0 +1,74 @@
+/*
+  File: AnimationFPS.ino
+  ------------------------------------------------------------------------
+  Description: 
+  Bounces a ball around the framebuffer and compares frames per second
+  when sending the whole buffer every frame against display()'s
+  dirty-region refresh, which only sends the columns of each page that
+  changed since the last frame.
+  ------------------------------------------------------------------------
+  License:
+  Released under the MIT license. Please check LICENSE.txt for more
+  information.  All text above must be included in any redistribution. 
+*/
+#include <Wire.h>
+#include <ACROBOTIC_SSD1306.h>
+
+#define FRAMES 200
+#define RADIUS 5
+
+int x = 20, y = 20, dx = 3, dy = 2;
+
+void drawBall(bool on)
+{
+  for(int i=-RADIUS;i<=RADIUS;i++)
+    for(int j=-RADIUS;j<=RADIUS;j++)
+      if(i*i + j*j <= RADIUS*RADIUS)
+        oled.setPixel(x+i, y+j, on);
+}
+
+void step()
+{
+  drawBall(false);
+  x += dx;
+  y += dy;
+  if(x < RADIUS+1 || x > SSD1306_Max_X-RADIUS-1) dx = -dx;
+  if(y < RADIUS+1 || y > SSD1306_Max_Y-RADIUS-1) dy = -dy;
+  drawBall(true);
+}
+
+float runFrames(bool fullRefresh)
+{
+  unsigned long start = millis();
+  for(int f=0;f<FRAMES;f++)
+  {
+    step();
+    if(fullRefresh) oled.markAllDirty();
+    oled.display();
+  }
+  return FRAMES * 1000.0 / (millis() - start);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Wire.begin();
+  Wire.setClock(400000);
+  oled.init();                      // Initialze SSD1306 OLED display
+  if(!oled.beginBuffer())
+  {
+    Serial.println("Not enough RAM for the framebuffer");
+    while(1);
+  }
+
+  Serial.print("Full refresh FPS:  ");
+  Serial.println(runFrames(true));
+  Serial.print("Dirty refresh FPS: ");
+  Serial.println(runFrames(false));
+}
+
+void loop()
+{
+  step();
+  oled.display();
+}
@@ -0,0 +1,83 @@
+// Host benchmark for the framebuffer's dirty-region display(). Bounces a
+// ball around the buffer the way examples/AnimationFPS does, sending each
+// frame once in full and once as dirty regions through a model of the
+// SSD1306's display RAM. Checks that the model ends up matching the
+// framebuffer after every frame and reports bytes, transactions and the
+// frame rate a 400 kHz bus would allow (9 clocks per byte).
+//
+// Usage: make
+
+#include "ACROBOTIC_SSD1306.h"
+#include <stdio.h>
+
+SSD1306Model display_model;
+TwoWire Wire;
+
+#define FRAMES 200
+#define RADIUS 5
+#define BUS_HZ 400000.0
+
+static int x = 20, y = 20, dx = 3, dy = 2;
+
+static void drawBall(bool on) {
+  for (int i = -RADIUS; i <= RADIUS; i++)
+    for (int j = -RADIUS; j <= RADIUS; j++)
+      if (i * i + j * j <= RADIUS * RADIUS)
+        oled.setPixel(x + i, y + j, on);
+}
+
+static void step() {
+  drawBall(false);
+  x += dx;
+  y += dy;
+  if ((x < RADIUS + 1) || (x > SSD1306_Max_X - RADIUS - 1))
+    dx = -dx;
+  if ((y < RADIUS + 1) || (y > SSD1306_Max_Y - RADIUS - 1))
+    dy = -dy;
+  drawBall(true);
+}
+
+// Run the animation, returning the number of frames where display RAM
+// didn't match the framebuffer
+static int run(bool full, long *bytes, long *transactions) {
+  int bad = 0;
+  display_model.bytes = display_model.transactions = 0;
+  for (int f = 0; f < FRAMES; f++) {
+    step();
+    if (full)
+      oled.markAllDirty();
+    oled.display();
+    if (memcmp(display_model.ram, oled.getBuffer(), sizeof(display_model.ram)))
+      bad++;
+  }
+  *bytes = display_model.bytes;
+  *transactions = display_model.transactions;
+  return bad;
+}
+
+int main() {
+  if (!oled.beginBuffer()) {
+    printf("FAIL: beginBuffer\n");
+    return 1;
+  }
+  oled.display();
+
+  long fullBytes, fullTx, dirtyBytes, dirtyTx;
+  int bad = run(true, &fullBytes, &fullTx);
+  bad += run(false, &dirtyBytes, &dirtyTx);
+
+  printf("full refresh:  %5ld bytes %3ld transactions per frame, %4.0f fps\n",
+         fullBytes / FRAMES, fullTx / FRAMES,
+         BUS_HZ / 9 / ((double)fullBytes / FRAMES));
+  printf("dirty refresh: %5ld bytes %3ld transactions per frame, %4.0f fps\n",
+         dirtyBytes / FRAMES, dirtyTx / FRAMES,
+         BUS_HZ / 9 / ((double)dirtyBytes / FRAMES));
+
+  if (display_model.overflows)
+    printf("FAIL: %ld transactions overflowed the Wire buffer\n",
+           display_model.overflows);
+  if (bad)
+    printf("FAIL: display RAM differed from the framebuffer in %d frames\n",
+           bad);
+  return (bad || display_model.overflows) ? 1 : 0;
+}
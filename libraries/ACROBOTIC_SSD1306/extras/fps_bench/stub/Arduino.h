@@ -0,0 +1,21 @@
+// Just enough of Arduino.h to build ACROBOTIC_SSD1306.cpp on a PC
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+
+class String : public std::string {
+public:
+  String(const char *s = "") : std::string(s) {}
+  void toCharArray(char *buf, unsigned n) const {
+    strncpy(buf, c_str(), n);
+    buf[n - 1] = 0;
+  }
+};
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
@@ -0,0 +1,71 @@
+// Stand-in for TwoWire that feeds every transaction to a model of the
+// SSD1306's display RAM and counts the bytes on the bus
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+
+#define BUFFER_LENGTH 32
+
+struct SSD1306Model {
+  uint8_t ram[8 * 128];
+  uint8_t col1 = 0, col2 = 127, page1 = 0, page2 = 7, col = 0, page = 0;
+  long bytes = 0;        // Bytes on the bus, address byte included
+  long transactions = 0;
+  long overflows = 0;    // Transactions longer than the Wire buffer
+
+  void run(const uint8_t *b, int n) {
+    transactions++;
+    bytes += n + 1;
+    if (n > BUFFER_LENGTH)
+      overflows++;
+    if (b[0] == 0x40) { // Data: written at the RAM pointer, which wraps
+      for (int i = 1; i < n; i++) {
+        ram[page * 128 + col] = b[i];
+        if (++col > col2) {
+          col = col1;
+          if (++page > page2)
+            page = page1;
+        }
+      }
+      return;
+    }
+    for (int i = 1; i < n; i++) { // Commands: only the address window ones
+      if ((b[i] == 0x21) && (i + 2 < n)) {
+        col = col1 = b[i + 1];
+        col2 = b[i + 2];
+        i += 2;
+      } else if ((b[i] == 0x22) && (i + 2 < n)) {
+        page = page1 = b[i + 1];
+        page2 = b[i + 2];
+        i += 2;
+      }
+    }
+  }
+};
+
+extern SSD1306Model display_model;
+
+class TwoWire {
+  uint8_t buf[256];
+  int len = 0;
+
+public:
+  void begin() {}
+  void beginTransmission(uint8_t) { len = 0; }
+  size_t write(uint8_t v) {
+    if (len < (int)sizeof(buf))
+      buf[len++] = v;
+    return 1;
+  }
+  size_t write(const uint8_t *d, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      write(d[i]);
+    return n;
+  }
+  uint8_t endTransmission() {
+    display_model.run(buf, len);
+    return 0;
+  }
+};
+
+extern TwoWire Wire;
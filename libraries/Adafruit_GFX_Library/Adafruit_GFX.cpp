@@ -700,6 +700,192 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   endWrite();
 }
 
+// POLYGON FUNCTIONS -------------------------------------------------------
+
+/**************************************************************************/
+/*!
+   @brief     Draw a closed polygon outline
+    @param    points  Vertex coordinates as interleaved x,y pairs
+                      (x0, y0, x1, y1, ...), 2*n values in total
+    @param    n       Number of vertices
+    @param    color   16-bit 5-6-5 Color to draw with
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawPolygon(const int16_t *points, uint16_t n,
+                               uint16_t color) {
+  if (!points || !n)
+    return;
+  startWrite();
+  int16_t px = points[2 * (n - 1)], py = points[2 * (n - 1) + 1];
+  for (uint16_t i = 0; i < n; i++) {
+    int16_t x = points[2 * i], y = points[2 * i + 1];
+    writeLine(px, py, x, y, color);
+    px = x;
+    py = y;
+  }
+  endWrite();
+}
+
+// One non-horizontal polygon edge for the fillPolygon() scanline
+// rasterizer. x advances by an integer DDA: xstep whole pixels per
+// scanline plus xrem/dy fractional pixels accumulated in err, so no
+// division is needed once the edge is active.
+typedef struct {
+  int16_t ymin;  // First scanline crossed by this edge
+  int16_t ymax;  // Scanline where the edge ends (exclusive, see below)
+  int16_t x;     // floor() of the edge X at the current scanline
+  int16_t xstep; // floor(dx / dy)
+  int16_t xrem;  // dx - xstep * dy, always 0 <= xrem < dy
+  int16_t dy;    // ymax - ymin, always > 0
+  int16_t err;   // Fractional X accumulator, 0 <= err < dy
+} GFXpolyEdge;
+
+/**************************************************************************/
+/*!
+   @brief     Draw a polygon with color-fill, using an active-edge-table
+              scanline rasterizer. Each scanline issues exactly one
+              writeFastHLine() per interior interval, so arbitrary shapes
+              don't overdraw shared edges the way a triangle fan does.
+              Filling uses the even-odd rule; self-intersecting outlines
+              are allowed. Edges are treated as half-open in Y (top row
+              included, bottom row excluded) so shared vertices are not
+              counted twice, except on the polygon's lowest row, which is
+              filled so results line up with fillTriangle()/fillRect().
+              Needs a small temporary edge table on the heap (about 16-20
+              bytes per vertex); if allocation fails nothing is drawn.
+    @param    points  Vertex coordinates as interleaved x,y pairs
+                      (x0, y0, x1, y1, ...), 2*n values in total
+    @param    n       Number of vertices (3 or more)
+    @param    color   16-bit 5-6-5 Color to fill/draw with
+*/
+/**************************************************************************/
+void Adafruit_GFX::fillPolygon(const int16_t *points, uint16_t n,
+                               uint16_t color) {
+  if (!points || (n < 3))
+    return;
+
+  // Edge table plus active-edge index list in one allocation
+  GFXpolyEdge *edges = (GFXpolyEdge *)malloc(
+      n * (sizeof(GFXpolyEdge) + sizeof(GFXpolyEdge *)));
+  if (!edges)
+    return;
+  GFXpolyEdge **active = (GFXpolyEdge **)&edges[n];
+
+  // Build the edge table, skipping horizontal edges (the edges adjoining
+  // them supply those spans). Insertion-sort by ymin as we go.
+  uint16_t nEdges = 0;
+  int16_t yTop = points[1], yBottom = points[1]; // Every vertex is in range
+  int16_t px = points[2 * (n - 1)], py = points[2 * (n - 1) + 1];
+  for (uint16_t i = 0; i < n; i++) {
+    int16_t x0 = px, y0 = py, x1 = points[2 * i], y1 = points[2 * i + 1];
+    px = x1;
+    py = y1;
+    if (y0 == y1)
+      continue;
+    if (y0 > y1) {
+      _swap_int16_t(x0, x1);
+      _swap_int16_t(y0, y1);
+    }
+    if (y0 < yTop)
+      yTop = y0;
+    if (y1 > yBottom)
+      yBottom = y1;
+    GFXpolyEdge e;
+    e.ymin = y0;
+    e.ymax = y1;
+    e.x = x0;
+    e.dy = y1 - y0;
+    int16_t dx = x1 - x0;
+    e.xstep = dx / e.dy;
+    e.xrem = dx % e.dy;
+    if (e.xrem < 0) { // C division truncates; we want floor
+      e.xstep--;
+      e.xrem += e.dy;
+    }
+    e.err = 0;
+    uint16_t j = nEdges++;
+    while ((j > 0) && (edges[j - 1].ymin > y0)) {
+      edges[j] = edges[j - 1];
+      j--;
+    }
+    edges[j] = e;
+  }
+
+  // Lowest row belongs to the polygon too; extend edges ending there
+  for (uint16_t i = 0; i < nEdges; i++) {
+    if (edges[i].ymax == yBottom)
+      edges[i].ymax++;
+  }
+
+  // Nothing visible above row 0 or below the last row
+  int16_t y = (yTop < 0) ? 0 : yTop;
+  int16_t yEnd = (yBottom >= _height) ? _height - 1 : yBottom;
+
+  startWrite();
+  uint16_t nextEdge = 0, nActive = 0;
+  for (; y <= yEnd; y++) {
+    // Drop edges that have ended
+    uint16_t k = 0;
+    for (uint16_t i = 0; i < nActive; i++) {
+      if (active[i]->ymax > y)
+        active[k++] = active[i];
+    }
+    nActive = k;
+
+    // Add edges starting here (or above the clip top on the first row),
+    // jumping their X straight to the current scanline
+    while ((nextEdge < nEdges) && (edges[nextEdge].ymin <= y)) {
+      GFXpolyEdge *e = &edges[nextEdge++];
+      if (e->ymax <= y)
+        continue;
+      int16_t skip = y - e->ymin;
+      if (skip) {
+        int32_t acc = (int32_t)e->xrem * skip;
+        e->x += (int16_t)((int32_t)e->xstep * skip + acc / e->dy);
+        e->err = acc % e->dy;
+      }
+      active[nActive++] = e;
+    }
+
+    // Active list stays nearly sorted between rows; insertion sort on X
+    for (uint16_t i = 1; i < nActive; i++) {
+      GFXpolyEdge *e = active[i];
+      uint16_t j = i;
+      while ((j > 0) && (active[j - 1]->x > e->x)) {
+        active[j] = active[j - 1];
+        j--;
+      }
+      active[j] = e;
+    }
+
+    // Even-odd pairs, merging touching/overlapping intervals so each
+    // interior run is a single span
+    for (uint16_t i = 0; i + 1 < nActive; i += 2) {
+      int16_t a = active[i]->x, b = active[i + 1]->x;
+      while ((i + 3 < nActive) && (active[i + 2]->x <= b + 1)) {
+        i += 2;
+        if (active[i + 1]->x > b)
+          b = active[i + 1]->x;
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+
+    // Step every active edge to the next scanline
+    for (uint16_t i = 0; i < nActive; i++) {
+      GFXpolyEdge *e = active[i];
+      e->x += e->xstep;
+      e->err += e->xrem;
+      if (e->err >= e->dy) {
+        e->x++;
+        e->err -= e->dy;
+      }
+    }
+  }
+  endWrite();
+
+  free(edges);
+}
+
 // BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
 
 /**************************************************************************/
@@ -1213,6 +1399,54 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // implemented this yet.
 
     startWrite();
+    if (pgm_read_byte(&gfxFont->flags) & GFXFONT_FLAG_RLE) {
+      // Run-length glyph: each foreground run becomes one span per
+      // glyph row it covers, instead of one pixel (or rect) per bit.
+      uint16_t remaining = (uint16_t)w * h;
+      bool on = false;
+      xx = yy = 0;
+      while (remaining) {
+        uint8_t len = (bit & 1) ? (bits & 0x0F)
+                                : ((bits = pgm_read_byte(&bitmap[bo++])) >> 4);
+        bit++;
+        if (!len) { // Escape: 8-bit length in next two nibbles
+          if (bit & 1) {
+            len = bits << 4;
+            bits = pgm_read_byte(&bitmap[bo++]);
+            len |= bits >> 4;
+          } else {
+            len = pgm_read_byte(&bitmap[bo++]);
+          }
+          bit += 2;
+        }
+        if (len > remaining)
+          len = remaining; // Corrupt data shouldn't run off the glyph
+        remaining -= len;
+        while (len) {
+          uint8_t n = w - xx; // Pixels left on this glyph row
+          if (n > len)
+            n = len;
+          if (on) {
+            if (size_x == 1 && size_y == 1) {
+              writeFastHLine(x + xo + xx, y + yo + yy, n, color);
+            } else {
+              writeFillRect(x + (xo16 + xx) * size_x,
+                            y + (yo16 + yy) * size_y, n * size_x, size_y,
+                            color);
+            }
+          }
+          len -= n;
+          xx += n;
+          if (xx >= w) {
+            xx = 0;
+            yy++;
+          }
+        }
+        on = !on;
+      }
+      endWrite();
+      return;
+    }
     for (yy = 0; yy < h; yy++) {
       for (xx = 0; xx < w; xx++) {
         if (!(bit++ & 7)) {
@@ -2693,3 +2927,262 @@ void GFXcanvas16::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
     buffer[i] = color;
   }
 }
+
+// -------------------------------------------------------------------------
+
+/**************************************************************************/
+/*!
+   @brief    Create a text field UI element; call begin() before use
+*/
+/**************************************************************************/
+Adafruit_GFX_TextField::Adafruit_GFX_TextField(void) {
+  _gfx = NULL;
+  _canvas = NULL;
+  _text = NULL;
+  _cellx = _newx = NULL;
+  _dirty = NULL;
+  _x = 0;
+  _len = _max = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete text field and free its buffers
+*/
+/**************************************************************************/
+Adafruit_GFX_TextField::~Adafruit_GFX_TextField(void) { releaseBuffers(); }
+
+void Adafruit_GFX_TextField::releaseBuffers(void) {
+  delete _canvas;
+  _canvas = NULL;
+  free(_text);
+  free(_cellx);
+  free(_newx);
+  free(_dirty);
+  _text = NULL;
+  _cellx = _newx = NULL;
+  _dirty = NULL;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Set up the field's position, font and colors and allocate its
+             buffers. Nothing is drawn until the first update(). The field
+             covers the characters' advance widths, so any glyph pixels
+             hanging past either end (e.g. an italic last character) are
+             clipped.
+   @param    gfx       Pointer to our display so we can draw to it!
+   @param    x         Cursor X of the first character, as for setCursor()
+   @param    y         Cursor Y, as for setCursor() (baseline for custom
+                       fonts, top edge for the classic font)
+   @param    maxChars  Longest string update() will draw; extra characters
+                       are ignored
+   @param    font      Custom font, or NULL for the classic built-in font
+   @param    textcolor Text color (16-bit 5-6-5 standard)
+   @param    bgcolor   Background color the field is drawn over
+   @param    textsize  Font magnification level, 1 is 'original' size
+   @returns  True on success, false if any buffer couldn't be allocated
+*/
+/**************************************************************************/
+bool Adafruit_GFX_TextField::begin(Adafruit_GFX *gfx, int16_t x, int16_t y,
+                                   uint8_t maxChars, const GFXfont *font,
+                                   uint16_t textcolor, uint16_t bgcolor,
+                                   uint8_t textsize) {
+  releaseBuffers();
+  _gfx = gfx;
+  _font = font;
+  _x = x;
+  _y = y;
+  _max = maxChars;
+  _len = 0;
+  _textcolor = textcolor;
+  _bgcolor = bgcolor;
+  _textsize = textsize ? textsize : 1;
+
+  // Cell geometry: widest advance and the vertical extent of all glyphs
+  int16_t advance = 6, top = 0, bottom = 8;
+  _overhang = false;
+  if (font) {
+    uint8_t first = pgm_read_byte(&font->first),
+            last = pgm_read_byte(&font->last);
+    advance = 0;
+    top = bottom = 0;
+    for (uint16_t c = first; c <= last; c++) {
+      GFXglyph *glyph = pgm_read_glyph_ptr(font, c - first);
+      uint8_t gw = pgm_read_byte(&glyph->width),
+              gh = pgm_read_byte(&glyph->height),
+              xa = pgm_read_byte(&glyph->xAdvance);
+      int8_t xo = pgm_read_byte(&glyph->xOffset),
+             yo = pgm_read_byte(&glyph->yOffset);
+      if (xa > advance)
+        advance = xa;
+      if (gw && gh) {
+        if (yo < top)
+          top = yo;
+        if (yo + gh > bottom)
+          bottom = yo + gh;
+        if ((xo < 0) || (xo + gw > xa))
+          _overhang = true;
+      }
+    }
+  }
+  _top = top * _textsize;
+  _h = (bottom - top) * _textsize;
+
+  _canvas = new GFXcanvas1(advance * _textsize, _h);
+  _text = (char *)malloc(maxChars + 1);
+  _cellx = (int16_t *)malloc((maxChars + 1) * sizeof(int16_t));
+  _newx = (int16_t *)malloc((maxChars + 1) * sizeof(int16_t));
+  _dirty = (uint8_t *)malloc(maxChars + 1);
+  if (!_canvas || !_canvas->getBuffer() || !_text || !_cellx || !_newx ||
+      !_dirty) {
+    releaseBuffers();
+    _gfx = NULL;
+    return false;
+  }
+  _canvas->setFont(font);
+  _text[0] = 0;
+  _cellx[0] = x;
+  return true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Change colors; the whole field is redrawn on the next update()
+   @param    textcolor Text color (16-bit 5-6-5 standard)
+   @param    bgcolor   Background color (16-bit 5-6-5 standard)
+*/
+/**************************************************************************/
+void Adafruit_GFX_TextField::setTextColor(uint16_t textcolor,
+                                          uint16_t bgcolor) {
+  _textcolor = textcolor;
+  _bgcolor = bgcolor;
+  invalidate();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Forget what's on screen so the next update() redraws every
+             character (e.g. after the display was cleared). The area
+             previously drawn is still erased if the new text is shorter.
+*/
+/**************************************************************************/
+void Adafruit_GFX_TextField::invalidate(void) {
+  if (!_gfx)
+    return;
+  _cellx[0] = _cellx[_len];
+  _len = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Draw a new string, touching only cells whose character or
+             position changed. With proportional fonts a width change moves
+             every following cell, so those get redrawn as well.
+   @param    str  String to show; characters past maxChars are ignored
+*/
+/**************************************************************************/
+void Adafruit_GFX_TextField::update(const char *str) {
+  if (!_gfx)
+    return;
+
+  uint8_t first = 0, last = 0;
+  if (_font) {
+    first = pgm_read_byte(&_font->first);
+    last = pgm_read_byte(&_font->last);
+  }
+
+  // Lay out the new string and flag cells that differ from last time.
+  // _cellx[0] doubles as the old right edge when the field was invalidated.
+  uint8_t len = 0;
+  int16_t x = _x;
+  while (str[len] && (len < _max)) {
+    uint8_t c = str[len];
+    _newx[len] = x;
+    if (!_font) {
+      x += 6 * _textsize;
+    } else if ((c >= first) && (c <= last)) {
+      x += (uint8_t)pgm_read_byte(
+               &pgm_read_glyph_ptr(_font, c - first)->xAdvance) *
+           _textsize;
+    }
+    len++;
+  }
+  _newx[len] = x;
+  int16_t oldEnd = _cellx[_len];
+  for (uint8_t i = 0; i < len; i++) {
+    _dirty[i] = (i >= _len) || (str[i] != _text[i]) ||
+                (_newx[i] != _cellx[i]) || (_newx[i + 1] != _cellx[i + 1]);
+  }
+
+  // Glyphs that spill past their own cell also paint the neighbours
+  if (_overhang) {
+    for (uint8_t i = 0; i < len; i++) {
+      if (_dirty[i] & 1) {
+        if (i)
+          _dirty[i - 1] |= 2;
+        if (i + 1 < len)
+          _dirty[i + 1] |= 2;
+      }
+    }
+  }
+
+  _gfx->startWrite();
+  for (uint8_t i = 0; i < len; i++) {
+    if (_dirty[i])
+      drawCell(i, str, len, _newx);
+  }
+  if (x < oldEnd) // Erase what's left of a longer previous string
+    _gfx->writeFillRect(x, _y + _top, oldEnd - x, _h, _bgcolor);
+  _gfx->endWrite();
+
+  memcpy(_text, str, len);
+  _text[len] = 0;
+  _len = len;
+  int16_t *t = _cellx;
+  _cellx = _newx;
+  _newx = t;
+}
+
+// Render cell i (plus any overhang from its neighbours) off-screen, then
+// copy it out as runs of text/background color.
+void Adafruit_GFX_TextField::drawCell(uint8_t i, const char *str, uint8_t len,
+                                      const int16_t *cellx) {
+  int16_t left = cellx[i], w = cellx[i + 1] - left;
+  if (w <= 0)
+    return;
+
+  _canvas->fillScreen(0);
+  uint8_t from = i, to = i;
+  if (_overhang) {
+    if (from)
+      from--;
+    if (to + 1 < len)
+      to++;
+  }
+  uint8_t first = 0, last = 255;
+  if (_font) {
+    first = pgm_read_byte(&_font->first);
+    last = pgm_read_byte(&_font->last);
+  }
+  for (uint8_t j = from; j <= to; j++) {
+    uint8_t c = str[j];
+    if ((c < first) || (c > last)) // Not in the font, leave the cell blank
+      continue;
+    _canvas->drawChar(cellx[j] - left, -_top, c, 1, 1, _textsize, _textsize);
+  }
+
+  for (uint16_t row = 0; row < _h; row++) {
+    int16_t start = 0;
+    bool on = _canvas->getPixel(0, row);
+    for (int16_t col = 1; col <= w; col++) {
+      bool pixel = (col < w) ? _canvas->getPixel(col, row) : !on;
+      if (pixel != on) {
+        _gfx->writeFastHLine(left + start, _y + _top + row, col - start,
+                             on ? _textcolor : _bgcolor);
+        start = col;
+        on = pixel;
+      }
+    }
+  }
+}
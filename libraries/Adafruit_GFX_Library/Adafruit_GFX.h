@@ -77,6 +77,8 @@ public:
                     int16_t y2, uint16_t color);
   void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
                     int16_t y2, uint16_t color);
+  void drawPolygon(const int16_t *points, uint16_t n, uint16_t color);
+  void fillPolygon(const int16_t *points, uint16_t n, uint16_t color);
   void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
                      int16_t radius, uint16_t color);
   void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
@@ -394,4 +396,48 @@ protected:
                      ///< nothing
 };
 
+/// A single-line text readout that redraws only the character cells whose
+/// contents changed since the last update(). Each changed cell is rendered
+/// off-screen into a small GFXcanvas1 and copied opaquely, so digits can
+/// change every second with proportional fonts and without flicker.
+class Adafruit_GFX_TextField {
+
+public:
+  Adafruit_GFX_TextField(void);
+  ~Adafruit_GFX_TextField(void);
+  bool begin(Adafruit_GFX *gfx, int16_t x, int16_t y, uint8_t maxChars,
+             const GFXfont *font, uint16_t textcolor, uint16_t bgcolor,
+             uint8_t textsize = 1);
+  void update(const char *str);
+  void setTextColor(uint16_t textcolor, uint16_t bgcolor);
+  void invalidate(void);
+
+  /**********************************************************************/
+  /*!
+    @brief    Width in pixels of the text as last drawn
+    @returns  Width in pixels
+  */
+  /**********************************************************************/
+  int16_t width(void) const { return _cellx ? _cellx[_len] - _x : 0; }
+
+private:
+  void drawCell(uint8_t i, const char *str, uint8_t len, const int16_t *cellx);
+  void releaseBuffers(void);
+
+  Adafruit_GFX *_gfx;
+  GFXcanvas1 *_canvas; // Scratch render target, one cell wide
+  const GFXfont *_font;
+  int16_t _x, _y;      // Cursor position, as for setCursor()
+  int16_t _top;        // Offset from cursor Y to top of field
+  uint16_t _h;         // Field height
+  uint16_t _textcolor, _bgcolor;
+  uint8_t _textsize;
+  uint8_t _max, _len;  // Capacity and length of last drawn string
+  bool _overhang;      // Font has glyphs reaching outside their advance
+  char *_text;         // Last drawn string
+  int16_t *_cellx;     // Left edge of each drawn cell, plus end (_len + 1)
+  int16_t *_newx;      // Scratch for the incoming string's cell edges
+  uint8_t *_dirty;     // Per-cell redraw flags
+};
+
 #endif // _ADAFRUIT_GFX_H
@@ -0,0 +1,76 @@
+/***
+Compares drawing speed of a raw GFX font against the same font run-length
+encoded (GFXFONT_FLAG_RLE). Text is drawn to an off-screen GFXcanvas16, so
+no display is needed; results are printed to Serial.
+
+FreeSans18pt7b_rle.h was generated with:
+  fontconvert/fontrle.py Fonts/FreeSans18pt7b.h > FreeSans18pt7b_rle.h
+
+Raw glyphs are drawn one writePixel() per set bit; RLE glyphs issue one
+writeFastHLine() per run per row, so the call count drops along with the
+flash size. Use fontrle.py --report to compare sizes for other fonts.
+***/
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans18pt7b.h>
+
+#include "FreeSans18pt7b_rle.h"
+
+// Canvas that counts the drawing calls a glyph turns into
+class CallCountCanvas : public GFXcanvas16 {
+public:
+  CallCountCanvas(uint16_t w, uint16_t h) : GFXcanvas16(w, h) {}
+  void writePixel(int16_t x, int16_t y, uint16_t color) {
+    calls++;
+    drawPixel(x, y, color);
+  }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    calls++;
+    GFXcanvas16::drawFastHLine(x, y, w, color);
+  }
+  uint32_t calls = 0;
+};
+
+#define REPEAT 10
+
+CallCountCanvas canvas(160, 48);
+const char text[] = "12:34:56";
+
+void benchmark(const GFXfont *font, const __FlashStringHelper *label) {
+  canvas.setFont(font);
+  canvas.calls = 0;
+  uint32_t t = micros();
+  for (uint8_t r = 0; r < REPEAT; r++) {
+    canvas.setCursor(0, 36);
+    canvas.print(text);
+  }
+  t = (micros() - t) / REPEAT;
+  Serial.print(label);
+  Serial.print(F(": "));
+  Serial.print(t);
+  Serial.print(F(" us, "));
+  Serial.print(canvas.calls / REPEAT);
+  Serial.println(F(" draw calls per string"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+
+  if (!canvas.getBuffer()) {
+    Serial.println(F("Canvas allocation failed"));
+    return;
+  }
+  canvas.setTextColor(0xFFFF);
+
+  Serial.print(F("Bitmap bytes, raw: "));
+  Serial.print(sizeof(FreeSans18pt7bBitmaps));
+  Serial.print(F(" RLE: "));
+  Serial.println(sizeof(FreeSans18pt7b_rleBitmaps));
+
+  benchmark(&FreeSans18pt7b, F("Raw"));
+  benchmark(&FreeSans18pt7b_rle, F("RLE"));
+}
+
+void loop() {}
@@ -0,0 +1,87 @@
+/***
+Compares fillPolygon() against building the same shape from a fan of
+fillTriangle() calls. Drawing goes to an off-screen GFXcanvas16, so no
+display is needed; results are printed to Serial.
+
+For each polygon size the sketch reports the time per shape and the number
+of writeFastHLine() spans issued. The triangle fan redraws every shared
+edge and issues one span per triangle per scanline, while fillPolygon()
+issues a single span per scanline per interior interval.
+***/
+
+#include <Adafruit_GFX.h>
+
+// Canvas that counts the spans it receives
+class SpanCountCanvas : public GFXcanvas16 {
+public:
+  SpanCountCanvas(uint16_t w, uint16_t h) : GFXcanvas16(w, h) {}
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    spans++;
+    GFXcanvas16::drawFastHLine(x, y, w, color);
+  }
+  uint32_t spans = 0;
+};
+
+#define CANVAS_W 96
+#define CANVAS_H 96
+#define MAX_VERTS 24
+#define REPEAT 20
+
+SpanCountCanvas canvas(CANVAS_W, CANVAS_H);
+int16_t points[MAX_VERTS * 2];
+
+// Regular n-gon centred in the canvas
+void makePolygon(uint8_t n) {
+  for (uint8_t i = 0; i < n; i++) {
+    float a = (float)i * 2.0 * PI / n;
+    points[i * 2] = CANVAS_W / 2 + (int16_t)(44.0 * cos(a));
+    points[i * 2 + 1] = CANVAS_H / 2 + (int16_t)(44.0 * sin(a));
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+
+  if (!canvas.getBuffer()) {
+    Serial.println(F("Canvas allocation failed"));
+    return;
+  }
+
+  Serial.println(F("verts\tpoly us\tpoly spans\tfan us\tfan spans"));
+  for (uint8_t n = 3; n <= MAX_VERTS; n *= 2) {
+    makePolygon(n);
+
+    canvas.spans = 0;
+    uint32_t t = micros();
+    for (uint8_t r = 0; r < REPEAT; r++)
+      canvas.fillPolygon(points, n, 0xFFFF);
+    uint32_t polyTime = (micros() - t) / REPEAT;
+    uint32_t polySpans = canvas.spans / REPEAT;
+
+    canvas.spans = 0;
+    t = micros();
+    for (uint8_t r = 0; r < REPEAT; r++) {
+      for (uint8_t i = 1; i + 1 < n; i++) {
+        canvas.fillTriangle(points[0], points[1], points[i * 2],
+                            points[i * 2 + 1], points[i * 2 + 2],
+                            points[i * 2 + 3], 0xFFFF);
+      }
+    }
+    uint32_t fanTime = (micros() - t) / REPEAT;
+    uint32_t fanSpans = canvas.spans / REPEAT;
+
+    Serial.print(n);
+    Serial.print('\t');
+    Serial.print(polyTime);
+    Serial.print('\t');
+    Serial.print(polySpans);
+    Serial.print("\t\t");
+    Serial.print(fanTime);
+    Serial.print('\t');
+    Serial.println(fanSpans);
+  }
+}
+
+void loop() {}
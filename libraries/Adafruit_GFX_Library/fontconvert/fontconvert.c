@@ -8,6 +8,11 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+Pass -r as the first argument to emit run-length encoded glyphs
+(GFXFONT_FLAG_RLE, see gfxfont.h).  This shrinks larger point sizes
+considerably but can grow small ones; raw and RLE sizes are reported on
+stderr so you can pick.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -22,6 +27,7 @@ See notes at end for glyph nomenclature & other tidbits.
 #include <ft2build.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include FT_GLYPH_H
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
@@ -29,29 +35,81 @@ See notes at end for glyph nomenclature & other tidbits.
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// Write one byte of bitmap data, formatting the output table nicely
+void embyte(uint8_t value) {
+  static uint8_t row = 0, firstCall = 1;
+  if (!firstCall) {    // Format output table nicely
+    if (++row >= 12) { // Last entry on line?
+      printf(",\n  "); //   Newline format output
+      row = 0;         //   Reset row counter
+    } else {           // Not end of line
+      printf(", ");    //   Simple comma delim
+    }
+  }
+  printf("0x%02X", value); // Write byte value
+  firstCall = 0;           // Formatting flag
+}
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
-  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+  static uint8_t sum = 0, bit = 0x80;
   if (value)
-    sum |= bit;          // Set bit if needed
-  if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
-    if (!firstCall) {    // Format output table nicely
-      if (++row >= 12) { // Last entry on line?
-        printf(",\n  "); //   Newline format output
-        row = 0;         //   Reset row counter
-      } else {           // Not end of line
-        printf(", ");    //   Simple comma delim
-      }
-    }
-    printf("0x%02X", sum); // Write byte value
-    sum = 0;               // Clear for next byte
-    bit = 0x80;            // Reset bit counter
-    firstCall = 0;         // Formatting flag
+    sum |= bit;       // Set bit if needed
+  if (!(bit >>= 1)) { // Advance to next bit, end of byte reached?
+    embyte(sum);      // Write byte value
+    sum = 0;          // Clear for next byte
+    bit = 0x80;       // Reset bit counter
+  }
+}
+
+// Accumulate nibbles for RLE output, high nibble first. Pass flush=1 to
+// pad out a pending half byte. Returns number of bytes written.
+int ennibble(uint8_t value, int flush) {
+  static uint8_t sum = 0, half = 0;
+  if (flush) {
+    if (!half)
+      return 0;
+    embyte(sum);
+    sum = half = 0;
+    return 1;
+  }
+  if (half) {
+    embyte(sum | (value & 0x0F));
+    sum = half = 0;
+    return 1;
   }
+  sum = value << 4;
+  half = 1;
+  return 0;
+}
+
+// Emit one run length in GFXFONT_FLAG_RLE form (see gfxfont.h): 1-15
+// inline, anything else as a 0 escape plus 8-bit length. Runs over 255
+// are split with zero-length runs of the opposite color between them.
+int enrun(int len) {
+  int bytes = 0;
+  while (len > 255) {
+    bytes += ennibble(0, 0);
+    bytes += ennibble(0xF, 0);
+    bytes += ennibble(0xF, 0); // 255
+    bytes += ennibble(0, 0);
+    bytes += ennibble(0, 0);
+    bytes += ennibble(0, 0); // 0, opposite color
+    len -= 255;
+  }
+  if ((len >= 1) && (len <= 15)) {
+    bytes += ennibble(len, 0);
+  } else {
+    bytes += ennibble(0, 0);
+    bytes += ennibble(len >> 4, 0);
+    bytes += ennibble(len & 0x0F, 0);
+  }
+  return bytes;
 }
 
 int main(int argc, char *argv[]) {
   int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
+  int rle = 0, rawBytes = 0;
   char *fontName, c, *ptr;
   FT_Library library;
   FT_Face face;
@@ -65,11 +123,19 @@ int main(int argc, char *argv[]) {
   //   fontconvert [filename] [size]
   //   fontconvert [filename] [size] [last char]
   //   fontconvert [filename] [size] [first char] [last char]
+  // Any of these may be preceded by -r for run-length encoded output.
   // Unless overridden, default first and last chars are
   // ' ' (space) and '~', respectively
 
+  if ((argc > 1) && !strcmp(argv[1], "-r")) {
+    rle = 1;
+    argv++;
+    argc--;
+  }
+
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n",
+            argv[0]);
     return 1;
   }
 
@@ -184,22 +250,45 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
-    for (y = 0; y < bitmap->rows; y++) {
-      for (x = 0; x < bitmap->width; x++) {
-        byte = x / 8;
-        bit = 0x80 >> (x & 7);
-        enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+    if (rle) {
+      // Runs alternate background/foreground, starting with background,
+      // and continue across row boundaries
+      int run = 0, on = 0, bytes = 0;
+      for (y = 0; y < bitmap->rows; y++) {
+        for (x = 0; x < bitmap->width; x++) {
+          byte = x / 8;
+          bit = 0x80 >> (x & 7);
+          if (!(bitmap->buffer[y * bitmap->pitch + byte] & bit) != !on) {
+            bytes += enrun(run);
+            run = 0;
+            on = !on;
+          }
+          run++;
+        }
+      }
+      if (run)
+        bytes += enrun(run);
+      bytes += ennibble(0, 1); // Each glyph starts on a byte boundary
+      bitmapOffset += bytes;
+    } else {
+      for (y = 0; y < bitmap->rows; y++) {
+        for (x = 0; x < bitmap->width; x++) {
+          byte = x / 8;
+          bit = 0x80 >> (x & 7);
+          enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+        }
       }
-    }
 
-    // Pad end of char bitmap to next byte boundary if needed
-    int n = (bitmap->width * bitmap->rows) & 7;
-    if (n) {     // Pixel count not an even multiple of 8?
-      n = 8 - n; // # bits to next multiple
-      while (n--)
-        enbit(0);
+      // Pad end of char bitmap to next byte boundary if needed
+      int n = (bitmap->width * bitmap->rows) & 7;
+      if (n) {     // Pixel count not an even multiple of 8?
+        n = 8 - n; // # bits to next multiple
+        while (n--)
+          enbit(0);
+      }
+      bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
     }
-    bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+    rawBytes += (bitmap->width * bitmap->rows + 7) / 8;
 
     FT_Done_Glyph(glyph);
   }
@@ -231,11 +320,18 @@ int main(int argc, char *argv[]) {
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d", first, last, table[0].height);
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
+    printf("  0x%02X, 0x%02X, %ld", first, last,
            face->size->metrics.height >> 6);
   }
+  if (rle) {
+    printf(", GFXFONT_FLAG_RLE };\n\n");
+    fprintf(stderr, "%s: %d bytes raw, %d bytes RLE\n", fontName, rawBytes,
+            bitmapOffset);
+  } else {
+    printf(" };\n\n");
+  }
   printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
   // Size estimate is based on AVR struct and pointer sizes;
   // actual size may vary.
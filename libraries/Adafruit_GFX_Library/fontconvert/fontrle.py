@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+
+# Re-encode an existing Adafruit_GFX font header (as produced by fontconvert)
+# with run-length encoded glyphs (GFXFONT_FLAG_RLE, see gfxfont.h), without
+# needing the original TrueType file.
+#
+# Usage:
+#   fontrle.py ../Fonts/FreeSans24pt7b.h > FreeSans24pt7b_rle.h
+#   fontrle.py --report ../Fonts/*.h
+#
+# --report prints raw vs. RLE bitmap size for each font and writes nothing.
+# Glyph and font names get an "_rle" suffix so both versions can be linked
+# into the same sketch. Fonts whose RLE form isn't smaller are still
+# converted, but a note is printed on stderr.
+
+import re
+import sys
+
+
+def parse_font(text):
+    """Return (name, bitmap bytes, glyph tuples, first, last, yAdvance)."""
+    bitmap = re.search(r"(\w+)Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    name = bitmap.group(1)
+    data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", bitmap.group(2))]
+    glyphs = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    body = re.sub(r"//[^\n]*", "", glyphs.group(1))
+    table = [tuple(int(v) for v in g.split(","))
+             for g in re.findall(r"\{([^{}]*)\}", body)]
+    font = re.search(r"GFXfont\s+%s\s+PROGMEM\s*=\s*\{(.*?)\};" % name,
+                     text, re.S)
+    fields = [f.strip() for f in font.group(1).split(",")]
+    first, last, y_advance = (int(f, 0) for f in fields[2:5])
+    return name, data, table, first, last, y_advance
+
+
+def glyph_runs(data, offset, width, height):
+    """Run lengths alternating background/foreground, background first."""
+    runs, on, run = [], 0, 0
+    for i in range(width * height):
+        pixel = (data[offset + i // 8] >> (7 - (i & 7))) & 1
+        if pixel != on:
+            runs.append(run)
+            run, on = 0, pixel
+        run += 1
+    if run:
+        runs.append(run)
+    return runs
+
+
+def encode_runs(runs):
+    """Pack runs into the nibble stream described in gfxfont.h."""
+    nibbles = []
+    for run in runs:
+        while run > 255:
+            nibbles += [0, 0xF, 0xF, 0, 0, 0]  # 255, then 0 of opposite color
+            run -= 255
+        if 1 <= run <= 15:
+            nibbles.append(run)
+        else:
+            nibbles += [0, run >> 4, run & 0xF]
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def encode_font(data, table):
+    out, glyphs = [], []
+    for offset, width, height, x_advance, x_offset, y_offset in table:
+        glyphs.append((len(out), width, height, x_advance, x_offset, y_offset))
+        out += encode_runs(glyph_runs(data, offset, width, height))
+    return out, glyphs
+
+
+def write_header(name, data, glyphs, first, last, y_advance):
+    name += "_rle"
+    print("#pragma once")
+    print("#include <Adafruit_GFX.h>\n")
+    print("const uint8_t %sBitmaps[] PROGMEM = {" % name)
+    for i in range(0, len(data), 12):
+        row = ", ".join("0x%02X" % b for b in data[i:i + 12])
+        print("    %s%s" % (row, "," if i + 12 < len(data) else "};\n"))
+    print("const GFXglyph %sGlyphs[] PROGMEM = {" % name)
+    for i, g in enumerate(glyphs):
+        c = first + i
+        end = "}," if c < last else "}};"
+        label = " '%c'" % c if 32 <= c <= 126 else ""
+        print("    {%d, %d, %d, %d, %d, %d%s // 0x%02X%s" % (g + (end, c, label)))
+    print("\nconst GFXfont %s PROGMEM = {" % name)
+    print("    (uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs," % (name, name))
+    print("    0x%02X, 0x%02X, %d, GFXFONT_FLAG_RLE};\n" % (first, last, y_advance))
+    print("// Approx. %d bytes" % (len(data) + len(glyphs) * 7 + 8))
+
+
+def main(args):
+    report = "--report" in args
+    files = [a for a in args if a != "--report"]
+    if not files or (not report and len(files) != 1):
+        sys.stderr.write(__doc__ or "Usage: fontrle.py [--report] font.h\n")
+        return 1
+    if report:
+        print("%-32s %7s %7s %6s" % ("font", "raw", "rle", "ratio"))
+    total_raw = total_rle = 0
+    for path in files:
+        with open(path) as f:
+            name, data, table, first, last, y_advance = parse_font(f.read())
+        rle, glyphs = encode_font(data, table)
+        total_raw += len(data)
+        total_rle += len(rle)
+        if report:
+            print("%-32s %7d %7d %5.1f%%" % (name, len(data), len(rle),
+                                            100.0 * len(rle) / len(data)))
+            continue
+        if len(rle) >= len(data):
+            sys.stderr.write("%s: RLE (%d bytes) is not smaller than raw "
+                             "(%d bytes)\n" % (name, len(rle), len(data)))
+        write_header(name, rle, glyphs, first, last, y_advance)
+    if report:
+        print("%-32s %7d %7d %5.1f%%" % ("total", total_raw, total_rle,
+                                        100.0 * total_rle / total_raw))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
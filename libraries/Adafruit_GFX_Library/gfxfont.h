@@ -17,6 +17,14 @@ typedef struct {
   int8_t yOffset;        ///< Y dist from cursor pos to UL corner
 } GFXglyph;
 
+/// GFXfont flags: glyph bitmaps are run-length encoded rather than raw
+/// 1-bit rows. Each glyph is a nibble stream (high nibble first) of run
+/// lengths alternating background/foreground, starting with background and
+/// running left-to-right, top-to-bottom through the glyph. Nibble values
+/// 1-15 are a run of that length; 0 means the next two nibbles hold an
+/// 8-bit length (0-255). Every glyph starts on a byte boundary.
+#define GFXFONT_FLAG_RLE 0x01
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   uint8_t *bitmap;  ///< Glyph bitmaps, concatenated
@@ -24,6 +32,7 @@ typedef struct {
   uint16_t first;   ///< ASCII extents (first char)
   uint16_t last;    ///< ASCII extents (last char)
   uint8_t yAdvance; ///< Newline distance (y axis)
+  uint8_t flags;    ///< GFXFONT_FLAG_* bits; omitted (0) for raw bitmaps
 } GFXfont;
 
 #endif // _GFXFONT_H_
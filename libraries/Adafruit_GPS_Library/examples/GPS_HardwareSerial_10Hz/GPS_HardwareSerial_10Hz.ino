@@ -0,0 +1,79 @@
+// Test code for Ultimate GPS Using Hardware Serial at a 10 Hz update rate
+//
+// At 10 Hz with all sentences turned on, the GPS sends dozens of sentences
+// per second, in bursts. readAll() takes in everything the serial port has
+// waiting, and the library queues complete sentences until newNMEAreceived()
+// hands them out, so loop() can be busy for a while without losing fixes. The
+// sketch prints how many sentences were dropped because the queue was full;
+// if that climbs, loop() is too slow for the update rate.
+//
+// Tested and works great with the Adafruit GPS FeatherWing
+// ------> https://www.adafruit.com/products/3133
+// but also works with the shield, breakout
+// ------> https://www.adafruit.com/products/1272
+// ------> https://www.adafruit.com/products/746
+//
+// Pick one up today at the Adafruit electronics shop
+// and help support open source hardware & software! -ada
+
+#include <Adafruit_GPS.h>
+
+// what's the name of the hardware serial port?
+#define GPSSerial Serial1
+
+// Connect to the GPS on the hardware port
+Adafruit_GPS GPS(&GPSSerial);
+
+uint32_t timer = millis();
+uint32_t fixes = 0;
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Adafruit GPS library 10 Hz queue test!");
+
+  // 9600 baud is too slow for 10 Hz with everything turned on, so switch the
+  // module to 115200 baud and follow it
+  GPS.begin(9600);
+  GPS.sendCommand(PMTK_SET_BAUD_115200);
+  delay(100);
+  GPSSerial.end();
+  GPS.begin(115200);
+
+  GPS.sendCommand(PMTK_SET_NMEA_OUTPUT_ALLDATA);
+  GPS.sendCommand(PMTK_SET_NMEA_UPDATE_10HZ);
+  GPS.sendCommand(PMTK_API_SET_FIX_CTL_5HZ); // fastest position fix rate
+}
+
+void loop() {
+  // take in everything that has arrived since last time
+  GPS.readAll();
+
+  // then parse every complete sentence waiting, oldest first
+  while (GPS.newNMEAreceived()) {
+    char *nmea = GPS.lastNMEA();
+    if (GPS.parse(nmea) && !strcmp(GPS.lastSentence, "RMC"))
+      fixes++;
+  }
+
+  // pretend to be busy with something else, as a real sketch would be
+  delay(10);
+
+  if (millis() - timer > 2000) {
+    timer = millis();
+    Serial.print("Sentences: ");
+    Serial.print(GPS.receivedNMEA());
+    Serial.print(" dropped: ");
+    Serial.print(GPS.droppedNMEA());
+    Serial.print(" RMC parsed: ");
+    Serial.print(fixes);
+    Serial.print(" Fix: ");
+    Serial.print((int)GPS.fix);
+    if (GPS.fix) {
+      Serial.print(" ");
+      Serial.print(GPS.latitudeDegrees, 6);
+      Serial.print(", ");
+      Serial.print(GPS.longitudeDegrees, 6);
+    }
+    Serial.println();
+  }
+}
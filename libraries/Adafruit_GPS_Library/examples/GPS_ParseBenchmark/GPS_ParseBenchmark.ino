@@ -0,0 +1,99 @@
+// Parser benchmark for the Adafruit GPS library
+//
+// Times GPS.parse() on a recorded one second burst from an Ultimate GPS
+// (MTK3339) with all sentences turned on, and prints how many sentences per
+// second this board can parse. No GPS module is needed. Handy for deciding
+// whether a slow board can keep up with a 10 Hz update rate, or how much of
+// loop() parsing takes.
+//
+// parse() doesn't modify the sentence, so each one is copied to RAM once and
+// parsed over and over.
+//
+// Pick one up today at the Adafruit electronics shop
+// and help support open source hardware & software! -ada
+
+#include <Adafruit_GPS.h>
+
+// No communications, just parsing
+Adafruit_GPS GPS;
+
+// Output of one fix, as recorded from the module at 9600 baud
+const char recorded[] PROGMEM =
+    "$GPGGA,120000.000,4044.5149,N,07359.3585,W,1,08,1.56,10.0,M,-34.2,M,,*60\n"
+    "$GPGSA,A,3,26,04,05,07,24,04,14,,,,,,2.03,1.56,1.40*01\n"
+    "$GPGSV,3,1,11,03,16,222,28,05,35,046,32,28,12,289,18,15,85,321,33*7D\n"
+    "$GPGSV,3,2,11,04,78,299,27,04,33,023,32,09,42,214,19,08,78,157,32*75\n"
+    "$GPGSV,3,3,11,12,18,297,33,13,52,049,32,05,77,030,34,14,68,348,32*72\n"
+    "$GPRMC,120000.000,A,4044.5149,N,07359.3585,W,1.28,113.09,190426,,,A*78\n"
+    "$GPVTG,210.80,T,,M,1.20,N,2.20,K,A*35\n"
+    "$PGTOP,11,2*6E\n";
+
+#define MAXSENTENCES 8
+char sentences[MAXSENTENCES][MAXLINELENGTH];
+uint8_t numSentences = 0;
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial)
+    delay(10);
+  Serial.println("Adafruit GPS library parse() benchmark");
+
+  // split the recorded burst into lines
+  uint16_t i = 0;
+  uint8_t n = 0;
+  char c;
+  while ((c = pgm_read_byte(&recorded[i++])) && numSentences < MAXSENTENCES) {
+    if (c == '\n') {
+      sentences[numSentences++][n] = 0;
+      n = 0;
+    } else if (n < MAXLINELENGTH - 1) {
+      sentences[numSentences][n++] = c;
+    }
+  }
+
+  uint8_t good = 0;
+  for (uint8_t s = 0; s < numSentences; s++) {
+    Serial.print(sentences[s]);
+    if (GPS.parse(sentences[s])) {
+      good++;
+      Serial.println("  <-- parsed");
+    } else {
+      Serial.println("  <-- checked, not parsed");
+    }
+  }
+  Serial.print(good);
+  Serial.print(" of ");
+  Serial.print(numSentences);
+  Serial.println(" sentences parsed");
+  Serial.println();
+}
+
+void loop() {
+  const uint16_t rounds = 200;
+  uint32_t start = micros();
+  for (uint16_t r = 0; r < rounds; r++)
+    for (uint8_t s = 0; s < numSentences; s++)
+      GPS.parse(sentences[s]);
+  uint32_t elapsed = micros() - start;
+
+  uint32_t count = (uint32_t)rounds * numSentences;
+  Serial.print(count);
+  Serial.print(" sentences in ");
+  Serial.print(elapsed);
+  Serial.print(" us: ");
+  Serial.print((float)elapsed / count, 1);
+  Serial.print(" us/sentence, ");
+  Serial.print(count * 1000000.0 / elapsed, 0);
+  Serial.println(" sentences/s");
+  Serial.print("Fix: ");
+  Serial.print(GPS.latitudeDegrees, 6);
+  Serial.print(", ");
+  Serial.print(GPS.longitudeDegrees, 6);
+  Serial.print(" at ");
+  Serial.print(GPS.hour);
+  Serial.print(':');
+  Serial.print(GPS.minute);
+  Serial.print(':');
+  Serial.println(GPS.seconds);
+  delay(2000);
+}
@@ -89,6 +89,16 @@ void loop() {
     Serial.print(GPS.get(NMEA_AWA));
     Serial.print(" while the smoothed value is: ");
     Serial.println(GPS.getSmoothed(NMEA_AWA));
+
+    nmea_float_t lo, hi, avg;
+    if (GPS.getHistoryStats(NMEA_DEPTH, 20, &lo, &hi, &avg)) {
+      Serial.print("Depth over the last minute ranged from ");
+      Serial.print(lo);
+      Serial.print(" to ");
+      Serial.print(hi);
+      Serial.print(", averaging ");
+      Serial.println(avg);
+    }
     
 #endif // NMEA_Extensions
   }
@@ -138,6 +148,8 @@ void addHistory(Adafruit_GPS *nmea) {
   nmea->initHistory(NMEA_HDG, 10.0, 0.0, 3);
   // Record pressure every 10 minutes, in Pa relative to 1 bar
   nmea->initHistory(NMEA_BAROMETER, 1.0, -100000.0, 600);
-  nmea->initHistory(NMEA_DEPTH, 10.0, 0.0, 3);
+  // Smooth depth in fixed point, which is much faster on boards without an
+  // FPU, and keep the last hour at 3 second intervals.
+  nmea->initHistory(NMEA_DEPTH, 10.0, 0.0, 3, 1200, true);
 }
 #endif              // NMEA_EXTENSIONS
@@ -0,0 +1,182 @@
+// Host test and benchmark for Adafruit_GPS::parse(), on track.nmea: two and
+// a half minutes of an MTK3339's output (GGA/GSA/GSV/RMC/VTG/PGTOP, from
+// before the first fix) interleaved with instrument sentences from a marine
+// NMEA 0183 multiplexer, with a little line noise. The log is generated in
+// the shape of a recording, along a smooth track.
+//
+// The same program is built against this library and against an older
+// revision of it (see Makefile). With "dump" it prints every parsed field
+// after each sentence. Given the old build's dump instead, it checks that
+// every field, and what parse() returned, matches the old parser, except
+// latitude_fixed/longitude_fixed: those are now exact where the old float
+// path came out up to a few 1e-7 degrees low. Either way it then times
+// parse() over the log and prints sentences per second.
+//
+// Usage: parse_test track.nmea [dump | old.txt]   (see Makefile)
+
+#include <string>
+#include <vector> // before Arduino.h's min() and max() macros
+
+#include "Adafruit_GPS.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static std::vector<std::string> load(const char *path) {
+  std::vector<std::string> lines;
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    exit(2);
+  }
+  char buf[4096]; // dump lines with NMEA_EXTENSIONS are about 1 KB
+  while (fgets(buf, sizeof(buf), f)) {
+    buf[strcspn(buf, "\r\n")] = 0;
+    lines.push_back(buf);
+  }
+  fclose(f);
+  return lines;
+}
+
+// Everything parse() can set, as "name=value" words. Only fields that both
+// the old and the new library have.
+static std::string fields(Adafruit_GPS &gps, bool ok) {
+  char buf[2048];
+  int n = snprintf(
+      buf, sizeof(buf),
+      "ok=%d check=%d source=%s sentence=%s last=%s time=%d:%d:%d.%d "
+      "date=%d/%d/%d lat=%.9g lon=%.9g latf=%ld lonf=%ld latdeg=%.9g "
+      "londeg=%.9g ns=%c ew=%c fix=%d quality=%d quality3d=%d sats=%d "
+      "antenna=%d hdop=%.6g vdop=%.6g pdop=%.6g alt=%.6g geoid=%.6g "
+      "speed=%.6g angle=%.6g magvar=%.6g mag=%c",
+      ok, gps.thisCheck, gps.thisSource, gps.thisSentence, gps.lastSentence,
+      gps.hour, gps.minute, gps.seconds, gps.milliseconds, gps.day, gps.month,
+      gps.year, gps.latitude, gps.longitude, (long)gps.latitude_fixed,
+      (long)gps.longitude_fixed, gps.latitudeDegrees, gps.longitudeDegrees,
+      gps.lat ? gps.lat : '-', gps.lon ? gps.lon : '-', gps.fix,
+      gps.fixquality, gps.fixquality_3d, gps.satellites, gps.antenna,
+      gps.HDOP, gps.VDOP, gps.PDOP, gps.altitude, gps.geoidheight, gps.speed,
+      gps.angle, gps.magvariation, gps.mag ? gps.mag : '-');
+#ifdef NMEA_EXTENSIONS
+  for (int k = 0; k < NMEA_MAX_INDEX; k++)
+    n += snprintf(buf + n, sizeof(buf) - n, " v%d=%.6g", k,
+                  gps.get((nmea_index_t)k));
+  n += snprintf(buf + n, sizeof(buf) - n, " to=%s from=%s txt=%d/%d/%d:%s",
+                gps.toID, gps.fromID, gps.txtTot, gps.txtN, gps.txtID,
+                gps.txtTXT);
+#endif
+  return std::string(buf, n);
+}
+
+static std::vector<std::string> words(const std::string &s) {
+  std::vector<std::string> w;
+  size_t p = 0, q;
+  while ((q = s.find(' ', p)) != std::string::npos) {
+    w.push_back(s.substr(p, q - p));
+    p = q + 1;
+  }
+  w.push_back(s.substr(p));
+  return w;
+}
+
+// Compare one dump line with the old parser's. Returns how far the
+// coordinates moved, in 1e-7 degrees: latitude_fixed/longitude_fixed and the
+// latitudeDegrees/longitudeDegrees now derived from them.
+static long compare(int line, const std::string &sentence,
+                    const std::string &got, const std::string &want) {
+  std::vector<std::string> g = words(got), w = words(want);
+  long moved = 0;
+  if (g.size() != w.size()) {
+    CHECK(false, "line %d (%s): %zu fields, old dump has %zu", line,
+          sentence.c_str(), g.size(), w.size());
+    return 0;
+  }
+  for (size_t i = 0; i < g.size(); i++) {
+    if (g[i] == w[i])
+      continue;
+    std::string const name = g[i].substr(0, g[i].find('=') + 1);
+    if (name == "latf=" || name == "lonf=" || name == "latdeg=" ||
+        name == "londeg=") {
+      double const a = atof(g[i].c_str() + name.size()),
+                   b = atof(w[i].c_str() + name.size());
+      double const scale = (name.size() == 5) ? 1 : 1e7;
+      long const d = lround(fabs(a - b) * scale);
+      moved = d > moved ? d : moved;
+      continue;
+    }
+    CHECK(false, "line %d (%s): %s, old parser %s", line, sentence.c_str(),
+          g[i].c_str(), w[i].c_str());
+  }
+  return moved;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("usage: %s log.nmea [dump | old.txt]\n", argv[0]);
+    return 2;
+  }
+  std::vector<std::string> log = load(argv[1]);
+  std::vector<std::vector<char> > text;
+  for (const std::string &s : log)
+    text.push_back(std::vector<char>(s.begin(), s.end() + 1));
+
+  static Adafruit_GPS gps; // zeroed, as the old library left some fields
+  if (argc > 2 && !strcmp(argv[2], "dump")) {
+    for (std::vector<char> &t : text) {
+      bool const ok = gps.parse(t.data());
+      printf("%s\n", fields(gps, ok).c_str());
+    }
+    return 0;
+  }
+
+  if (argc > 2) {
+    std::vector<std::string> old = load(argv[2]);
+    CHECK(old.size() == log.size(), "%zu sentences, old dump has %zu lines",
+          log.size(), old.size());
+    long moved = 0;
+    int parsed = 0;
+    for (size_t i = 0; i < text.size() && i < old.size() && failures < 20;
+         i++) {
+      bool const ok = gps.parse(text[i].data());
+      parsed += ok;
+      long const m = compare(i + 1, log[i], fields(gps, ok), old[i]);
+      moved = m > moved ? m : moved;
+    }
+    printf("%d of %zu sentences parsed, as before; coordinates moved by up "
+           "to %ld * 1e-7 degrees\n",
+           parsed, text.size(), moved);
+    CHECK(moved <= 5, "coordinates moved by %ld * 1e-7 degrees", moved);
+  }
+
+  const int R = 200;
+  int good = 0;
+  double best = 1e99;
+  for (int k = 0; k < 5; k++) {
+    double const t0 = now();
+    good = 0;
+    for (int r = 0; r < R; r++)
+      for (std::vector<char> &t : text)
+        good += gps.parse(t.data());
+    double const dt = (now() - t0) / R / text.size();
+    best = dt < best ? dt : best;
+  }
+  printf("parse(): %d of %zu parsed, %.0f ns/sentence, %.2f M sentences/s\n",
+         good / R, text.size(), best, 1e3 / best);
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,77 @@
+// Just enough of Arduino.h to build the GPS library on a PC
+#pragma once
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define DEC 10
+#define HEX 16
+
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+inline unsigned long millis(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000UL + t.tv_nsec / 1000000;
+}
+inline void delay(unsigned long) {}
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline bool isDigit(int c) { return c >= '0' && c <= '9'; }
+inline bool isAlpha(int c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+class String : public std::string {
+public:
+  String(const char *s = "") : std::string(s) {}
+};
+
+// Output goes nowhere; the tests look at parsed fields, not at printing
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t *, size_t n) { return n; }
+  size_t print(const char *s) { return strlen(s); }
+  template <class T> size_t print(T, int = DEC) { return 1; }
+  size_t println(const char *s = "") { return strlen(s) + 2; }
+  template <class T> size_t println(T, int = DEC) { return 3; }
+};
+
+class Stream : public Print {
+public:
+  virtual int available(void) { return 0; }
+  virtual int read(void) { return -1; }
+  virtual int peek(void) { return -1; }
+  virtual void flush(void) {}
+  size_t readBytes(char *buf, size_t n) {
+    size_t i = 0;
+    for (int c; i < n && (c = read()) >= 0; i++)
+      buf[i] = c;
+    return i;
+  }
+};
+
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  void end(void) {}
+};
+
+inline HardwareSerial Serial;
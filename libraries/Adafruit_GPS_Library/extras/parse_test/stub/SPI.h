@@ -0,0 +1,18 @@
+// SPI is only used by the GPS library's SPI constructor, never on a PC
+#pragma once
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+struct SPISettings {
+  SPISettings(uint32_t = 0, uint8_t = 0, uint8_t = 0) {}
+};
+
+class SPIClass {
+public:
+  void begin(void) {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction(void) {}
+  uint8_t transfer(uint8_t) { return 0; }
+};
@@ -0,0 +1,11 @@
+// I2C is only used by the GPS library's Wire constructor, never on a PC
+#pragma once
+#include "Arduino.h"
+
+class TwoWire : public Stream {
+public:
+  void begin(void) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 0; }
+  uint8_t requestFrom(uint8_t, uint8_t, uint8_t = 1) { return 0; }
+};
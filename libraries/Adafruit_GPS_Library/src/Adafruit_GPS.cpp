@@ -157,11 +157,10 @@ void Adafruit_GPS::common_init(void) {
   gpsStream = NULL;   // port pointer in corresponding constructor
   gpsI2C = NULL;
   gpsSPI = NULL;
-  recvdflag = false;
   paused = false;
-  lineidx = 0;
-  currentline = line1;
-  lastline = line2;
+  head = tail = lineidx = 0;
+  recvdflag = holding = false;
+  received = dropped = 0;
 
   hour = minute = seconds = year = month = day = fixquality = fixquality_3d =
       satellites = antenna = 0; // uint8_t
@@ -271,14 +270,15 @@ size_t Adafruit_GPS::write(uint8_t c) {
     Call very frequently and multiple times per opportunity or the buffer
     may overflow if there are frequent NMEA sentences. An 82 character NMEA
     sentence 10 times per second will require 820 calls per second, and
-    once a loop() may not be enough. Check for newNMEAreceived() after at
-    least every 10 calls, or you may miss some short sentences.
+    once a loop() may not be enough. Complete sentences are queued, up to
+    GPS_QUEUE_SIZE - 1 of them counting the one lastNMEA() returns, until
+    newNMEAreceived() takes them; see readAll() to take in everything
+    waiting at once. Safe to call from an interrupt, as
+    long as nothing else calls read(), readAll() or feed() at the same time.
     @return The character that we received, or 0 if nothing was available
 */
 /**************************************************************************/
 char Adafruit_GPS::read(void) {
-  static uint32_t firstChar = 0; // first character received in current sentence
-  uint32_t tStart = millis();    // as close as we can get to time char was sent
   char c = 0;
 
   if (paused || noComms)
@@ -351,37 +351,100 @@ char Adafruit_GPS::read(void) {
   }
   // Serial.print(c);
 
-  currentline[lineidx] = c;
-  lineidx = lineidx + 1;
-  if (lineidx >= MAXLINELENGTH)
-    lineidx = MAXLINELENGTH -
-              1; // ensure there is someplace to put the next received character
+  store(c);
+  return c;
+}
 
-  if (c == '\n') {
-    currentline[lineidx] = 0;
+/**************************************************************************/
+/*!
+    @brief Read every character waiting from the GPS into the sentence queue,
+    rather than one per read() call. Serial ports are read in blocks, so this
+    is the cheap way to keep up with a 10 Hz receiver from loop().
+    @return The number of characters read
+*/
+/**************************************************************************/
+size_t Adafruit_GPS::readAll(void) {
+  char buf[32];
+  size_t total = 0;
 
-    if (currentline == line1) {
-      currentline = line2;
-      lastline = line1;
-    } else {
-      currentline = line1;
-      lastline = line2;
+  if (paused || noComms)
+    return 0;
+
+  Stream *s = gpsStream;
+#if (defined(__AVR__) || ((defined(ARDUINO_UNOR4_WIFI) || defined(ESP8266)) && \
+                          !defined(NO_SW_SERIAL)))
+  if (gpsSwSerial)
+    s = gpsSwSerial;
+#endif
+  if (gpsHwSerial)
+    s = gpsHwSerial;
+  if (s) {
+    int n;
+    while ((n = s->available()) > 0) {
+      if (n > (int)sizeof(buf))
+        n = sizeof(buf);
+      n = s->readBytes(buf, n);
+      if (n <= 0)
+        break;
+      feed(buf, n);
+      total += n;
     }
+    return total;
+  }
 
-    // Serial.println("----");
-    // Serial.println((char *)lastline);
-    // Serial.println("----");
+  // I2C and SPI always have something to read, so stop after a sentence's
+  // worth or when the module has nothing more for us
+  while (total < MAXLINELENGTH && read())
+    total++;
+  return total;
+}
+
+/**************************************************************************/
+/*!
+    @brief Add characters from the GPS to the sentence queue, for data that
+    arrives some other way than through read(), e.g. a UART receive interrupt
+    or DMA buffer. Like read(), safe to call from an interrupt as long as
+    it's the only thing putting characters into this object.
+    @param data Pointer to the characters
+    @param len Number of characters
+    @return The number of characters taken, always len
+*/
+/**************************************************************************/
+size_t Adafruit_GPS::feed(const char *data, size_t len) {
+  for (size_t i = 0; i < len; i++)
+    store(data[i]);
+  return len;
+}
+
+/**************************************************************************/
+/*!
+    @brief Add one character to the sentence being received, and queue the
+    sentence when it's complete. millis() is only read at the start and end
+    of each sentence.
+    @param c The character
+*/
+/**************************************************************************/
+void Adafruit_GPS::store(char c) {
+  uint8_t h = head;
+  volatile char *line = lines[h];
+  if (lineidx == 0)
+    lineSent[h] = millis(); // as close as we can get to time it was sent
+  line[lineidx] = c;
+  if (lineidx < MAXLINELENGTH - 1)
+    lineidx = lineidx + 1; // ensure there is someplace to put the next
+                           // received character
+
+  if (c == '\n') {
+    line[lineidx] = 0;
     lineidx = 0;
-    recvdflag = true;
-    recvdTime = millis(); // time we got the end of the string
-    sentTime = firstChar;
-    firstChar = 0; // there are no characters yet
-    return c;      // wait until next character to set time
+    lineRecvd[h] = millis(); // time we got the end of the string
+    received = received + 1;
+    uint8_t next = (h + 1 < GPS_QUEUE_SIZE) ? h + 1 : 0;
+    if (next == tail)
+      dropped = dropped + 1; // full, so receive the next one over this one
+    else
+      head = next; // publish only once the sentence is complete
   }
-
-  if (firstChar == 0)
-    firstChar = tStart;
-  return c;
 }
 
 /**************************************************************************/
@@ -394,11 +457,28 @@ void Adafruit_GPS::sendCommand(const char *str) { println(str); }
 
 /**************************************************************************/
 /*!
-    @brief Check to see if a new NMEA line has been received
-    @return True if received, false if not
+    @brief Check to see if a new NMEA line has been received. If the line
+    lastNMEA() returned has been read, its buffer is handed back and the
+    oldest queued sentence, if any, becomes the one lastNMEA() returns.
+    @return True if there's a sentence waiting for lastNMEA()
 */
 /**************************************************************************/
-bool Adafruit_GPS::newNMEAreceived(void) { return recvdflag; }
+bool Adafruit_GPS::newNMEAreceived(void) {
+  if (recvdflag)
+    return true;
+  uint8_t t = tail;
+  if (holding) { // done with the previous sentence
+    t = (t + 1 < GPS_QUEUE_SIZE) ? t + 1 : 0;
+    tail = t;
+    holding = false;
+  }
+  if (t == head)
+    return false;
+  sentTime = lineSent[t]; // for parse()
+  recvdTime = lineRecvd[t];
+  holding = recvdflag = true;
+  return true;
+}
 
 /**************************************************************************/
 /*!
@@ -410,13 +490,72 @@ void Adafruit_GPS::pause(bool p) { paused = p; }
 
 /**************************************************************************/
 /*!
-    @brief Returns the last NMEA line received and unsets the received flag
-    @return Pointer to the last line string
+    @brief Returns the last NMEA line received and unsets the received flag.
+    Can be called any number of times for the same sentence; the next one
+    comes from newNMEAreceived().
+    @return Pointer to the line, valid until the next newNMEAreceived() call.
+    Empty if newNMEAreceived() hasn't returned true since it last returned
+    false.
 */
 /**************************************************************************/
 char *Adafruit_GPS::lastNMEA(void) {
+  static char none[1] = {0};
   recvdflag = false;
-  return (char *)lastline;
+  return holding ? (char *)lines[tail] : none;
+}
+
+/**************************************************************************/
+/*!
+    @brief How many complete sentences newNMEAreceived() has yet to report,
+    including one it has reported that lastNMEA() hasn't returned yet
+    @return Number of sentences, up to GPS_QUEUE_SIZE - 1
+*/
+/**************************************************************************/
+uint8_t Adafruit_GPS::queuedNMEA(void) {
+  uint8_t h = head, t = tail;
+  uint8_t n = (h >= t) ? h - t : h + GPS_QUEUE_SIZE - t;
+  return (holding && !recvdflag) ? n - 1 : n;
+}
+
+/**************************************************************************/
+/*!
+    @brief Total number of sentences received, including dropped ones
+    @return Sentence count since the object was created
+*/
+/**************************************************************************/
+uint32_t Adafruit_GPS::receivedNMEA(void) {
+  uint32_t n;
+  do { // may be updated by an interrupt part way through reading it
+    n = received;
+  } while (n != received);
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief Number of sentences dropped because the queue was full when they
+    arrived. If this climbs, call newNMEAreceived() more often, use readAll(), or
+    build with a larger GPS_QUEUE_SIZE.
+    @return Dropped sentence count since the object was created
+*/
+/**************************************************************************/
+uint32_t Adafruit_GPS::droppedNMEA(void) {
+  uint32_t n;
+  do { // may be updated by an interrupt part way through reading it
+    n = dropped;
+  } while (n != dropped);
+  return n;
+}
+
+/**************************************************************************/
+/*!
+    @brief Throw away any sentences waiting in the queue, e.g. to wait for
+    the response to a command
+*/
+/**************************************************************************/
+void Adafruit_GPS::discardNMEA(void) {
+  tail = head;
+  recvdflag = holding = false;
 }
 
 /**************************************************************************/
@@ -456,7 +595,7 @@ bool Adafruit_GPS::waitForSentence(const char *wait4me, uint8_t max,
 /**************************************************************************/
 bool Adafruit_GPS::LOCUS_StartLogger(void) {
   sendCommand(PMTK_LOCUS_STARTLOG);
-  recvdflag = false;
+  discardNMEA();
   return waitForSentence(PMTK_LOCUS_STARTSTOPACK);
 }
 
@@ -468,7 +607,7 @@ bool Adafruit_GPS::LOCUS_StartLogger(void) {
 /**************************************************************************/
 bool Adafruit_GPS::LOCUS_StopLogger(void) {
   sendCommand(PMTK_LOCUS_STOPLOG);
-  recvdflag = false;
+  discardNMEA();
   return waitForSentence(PMTK_LOCUS_STARTSTOPACK);
 }
 
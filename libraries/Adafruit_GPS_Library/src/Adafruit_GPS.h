@@ -51,6 +51,17 @@
 #define GPS_MAX_SPI_TRANSFER                                                   \
   100                     ///< The max number of bytes we'll try to read at once
 #define MAXLINELENGTH 120 ///< how long are max NMEA lines to parse?
+#ifndef GPS_QUEUE_SIZE // inject on the compile command line to change
+#ifdef __AVR__
+#define GPS_QUEUE_SIZE                                                         \
+  2 ///< sentence buffers: one being received, the rest waiting to be read
+#else
+#define GPS_QUEUE_SIZE                                                         \
+  8 ///< sentence buffers: one being received, the rest waiting to be read
+#endif
+#endif
+#define NMEA_MAX_FIELDS                                                        \
+  24 ///< fields after the sentence ID whose offsets check() records
 #define NMEA_MAX_SENTENCE_ID                                                   \
   20 ///< maximum length of a sentence ID name, including terminating 0
 #define NMEA_MAX_SOURCE_ID                                                     \
@@ -104,6 +115,12 @@ public:
   bool newNMEAreceived();
   void pause(bool b);
   char *lastNMEA(void);
+  size_t readAll(void);
+  size_t feed(const char *data, size_t len);
+  uint8_t queuedNMEA(void);
+  uint32_t receivedNMEA(void);
+  uint32_t droppedNMEA(void);
+  void discardNMEA(void);
   bool waitForSentence(const char *wait, uint8_t max = MAXWAITSENTENCE,
                        bool usingInterrupts = false);
   bool LOCUS_StartLogger(void);
@@ -140,8 +157,12 @@ public:
   nmea_history_t *initHistory(nmea_index_t idx, nmea_float_t scale = 10.0,
                               nmea_float_t offset = 0.0,
                               unsigned historyInterval = 20,
-                              unsigned historyN = 192);
+                              unsigned historyN = 192,
+                              bool fixedSmoothing = false);
   void removeHistory(nmea_index_t idx);
+  nmea_float_t getHistory(nmea_index_t idx, unsigned age = 0);
+  bool getHistoryStats(nmea_index_t idx, unsigned n, nmea_float_t *minimum,
+                       nmea_float_t *maximum = NULL, nmea_float_t *mean = NULL);
   void showDataValue(nmea_index_t idx, int n = 7);
   bool isCompoundAngle(nmea_index_t idx);
 #endif
@@ -242,8 +263,10 @@ private:
   //   bool parseLonDir(char *);
   // NMEA_data.cpp
   void data_init();
+#ifdef NMEA_EXTENSIONS
+  void newDataValue(nmea_index_t idx, nmea_float_t v, uint32_t now);
+#endif
   // NMEA_parse.cpp
-  const char *tokenOnList(char *token, const char **list);
   bool parseCoord(char *p, nmea_float_t *angleDegrees = NULL,
                   nmea_float_t *angle = NULL, int32_t *angle_fixed = NULL,
                   char *dir = NULL);
@@ -252,24 +275,16 @@ private:
   bool parseFix(char *);
   bool parseAntenna(char *);
   bool isEmpty(char *pStart);
+  char *field(char *nmea, uint8_t i);
+  static int32_t parseInteger(const char *p);
+  static nmea_float_t parseDecimal(const char *p);
+  static uint8_t sentenceKind(uint32_t id);
 
-  // used by check() for validity tests, room for future expansion
-  const char *sources[7] = {"II", "WI", "GP", "PG",
-                            "GN", "P",  "ZZZ"}; ///< valid source ids
-#ifdef NMEA_EXTENSIONS
-  const char *sentences_parsed[21] = {"GGA", "GLL", "GSA", "RMC", "DBT", "HDM",
-                                      "HDT", "MDA", "MTW", "MWV", "RMB", "TOP",
-                                      "TXT", "VHW", "VLW", "VPW", "VWR", "WCV",
-                                      "XTE", "ZZZ"}; ///< parseable sentence ids
-  const char *sentences_known[15] = {
-      "APB", "DPT", "GSV", "HDG", "MWD", "ROT",
-      "RPM", "RSA", "VDR", "VTG", "ZDA", "ZZZ"}; ///< known, but not parseable
-#else // make the lists short to save memory
-  const char *sentences_parsed[6] = {"GGA", "GLL", "GSA", "RMC",
-                                     "TOP", "ZZZ"}; ///< parseable sentence ids
-  const char *sentences_known[4] = {"DBT", "HDM", "HDT",
-                                    "ZZZ"}; ///< known, but not parseable
-#endif
+  // filled in by check() in the same pass as the checksum, used by parse()
+  uint32_t thisId = 0; ///< sentence ID packed by NMEA_ID(), 0 if none
+  uint8_t fieldStart[NMEA_MAX_FIELDS]; ///< offset of each field after the ID
+  uint8_t fieldCount = 0; ///< number of fields found, up to NMEA_MAX_FIELDS
+  uint8_t starOffset = 0; ///< offset of the '*' that starts the checksum
 
   // Make all of these times far in the past by setting them near the middle of
   // the millis() range. Timing assumes that sentences are parsed promptly.
@@ -303,13 +318,22 @@ private:
   int8_t _buff_max = -1, _buff_idx = 0;
   char last_char = 0;
 
-  volatile char line1[MAXLINELENGTH]; ///< We double buffer: read one line in
-                                      ///< and leave one for the main program
-  volatile char line2[MAXLINELENGTH]; ///< Second buffer
+  // Sentence queue. read() or feed() fill lines[head] and move head on at
+  // each '\n'. newNMEAreceived() hands lines[tail] to lastNMEA() and only
+  // moves tail on when it's next called. Each index is only written by one
+  // side, so read() can run in an interrupt without any locking. When full,
+  // new sentences are counted and dropped.
+  void store(char c);
+  volatile char lines[GPS_QUEUE_SIZE][MAXLINELENGTH]; ///< Sentence buffers
+  volatile uint32_t lineSent[GPS_QUEUE_SIZE]; ///< millis() at first character
+  volatile uint32_t lineRecvd[GPS_QUEUE_SIZE]; ///< millis() at the '\n'
+  volatile uint8_t head = 0;    ///< Buffer being received into
+  volatile uint8_t tail = 0;    ///< Oldest sentence not yet read
   volatile uint8_t lineidx = 0; ///< our index into filling the current line
-  volatile char *currentline;   ///< Pointer to current line buffer
-  volatile char *lastline;      ///< Pointer to previous line buffer
-  volatile bool recvdflag;      ///< Received flag
+  volatile uint32_t received = 0; ///< Sentences received
+  volatile uint32_t dropped = 0;  ///< Sentences dropped because queue full
+  bool holding = false;   ///< lastNMEA() returns lines[tail]
+  bool recvdflag = false; ///< newNMEAreceived() true until lastNMEA()
   volatile bool inStandbyMode;  ///< In standby flag
 };
 /**************************************************************************/
@@ -43,56 +43,106 @@
 /**************************************************************************/
 void Adafruit_GPS::newDataValue(nmea_index_t idx, nmea_float_t v) {
 #ifdef NMEA_EXTENSIONS
+  newDataValue(idx, v, millis()); // one time stamp for all the components
+#else
+  (void)idx;
+  (void)v;
+#endif // NMEA_EXTENSIONS
+}
+
+#ifdef NMEA_EXTENSIONS
+/**************************************************************************/
+/*!
+    @brief Update the value and history information with a new value, as
+    of a given time.
+
+    Smoothing is an exponential filter with weight dt / response, capped at
+    1, worked out as a 16 bit fraction from the weight precomputed by
+    initDataValue() so there's no division. With fixedSmoothing set on the
+    history of a simple float value, the filter itself runs in 32 bit fixed
+    point, in units of the history's integers, and the smoothed value is
+    only converted back to float when it's read with getSmoothed().
+    @param idx The data index for which a new value has been received
+    @param v The new value received
+    @param now millis() when it was received
+    @return none
+*/
+/**************************************************************************/
+void Adafruit_GPS::newDataValue(nmea_index_t idx, nmea_float_t v,
+                                uint32_t now) {
   //  Serial.println();Serial.print(idx);Serial.print(", "); Serial.println(v);
-  val[idx].latest = v; // update the value
+  nmea_datavalue_t *d = &val[idx];
+  nmea_history_t *h = d->hist;
+  d->latest = v; // update the value
 
   // update the smoothed verion
   if (isCompoundAngle(idx)) { // angle with sin/cos component recording
-    newDataValue((nmea_index_t)(idx + 1), sin(v / (nmea_float_t)RAD_TO_DEG));
-    newDataValue((nmea_index_t)(idx + 2), cos(v / (nmea_float_t)RAD_TO_DEG));
+    nmea_float_t rad = v / (nmea_float_t)RAD_TO_DEG;
+    newDataValue((nmea_index_t)(idx + 1), sin(rad), now);
+    newDataValue((nmea_index_t)(idx + 2), cos(rad), now);
+  }
+  // weighting factor for smoothing depends on delta t / tau, as a fraction
+  // of 65536
+  uint32_t dt = now - d->lastUpdate;
+  uint32_t w = (dt >= d->response) ? 65536 : (dt * d->weight) >> 16;
+  bool fixed = false;
+  switch (d->type) {
+  case NMEA_COMPASS_ANGLE_SIN: // special smoothing for some angle types
+    d->smoothed = compassAngle(getSmoothed((nmea_index_t)(idx + 1)),
+                               getSmoothed((nmea_index_t)(idx + 2)));
+    break;
+  case NMEA_BOAT_ANGLE_SIN:
+    d->smoothed = boatAngle(getSmoothed((nmea_index_t)(idx + 1)),
+                            getSmoothed((nmea_index_t)(idx + 2)));
+    break;
+  case NMEA_BOAT_ANGLE: // some types just don't make sense to smooth
+  case NMEA_COMPASS_ANGLE:
+  case NMEA_DDMM:
+  case NMEA_HHMMSS:
+    d->smoothed = d->latest;
+    break;
+  default: // default smoothing
+    if (h && h->fixedSmoothing && d->type == NMEA_SIMPLE_FLOAT) {
+      // history units * 32768, clamped to the int16 history range so the
+      // difference below fits in 32 bits
+      nmea_float_t x = (v - h->offset) * h->scale * 32768.0f;
+      int32_t xq = (x > 1073709056.0f)    ? 1073709056L
+                   : (x < -1073709056.0f) ? -1073709056L
+                                          : (int32_t)x;
+      if (w >= 65536) {
+        h->smooth = xq;
+      } else { // diff * w >> 16 in two halves, without a 64 bit product
+        int32_t diff = xq - h->smooth;
+        h->smooth += (diff >> 16) * (int32_t)w +
+                     (int32_t)(((uint32_t)diff & 0xFFFF) * w >> 16);
+      }
+      fixed = true;
+    } else {
+      d->smoothed += (v - d->smoothed) * (nmea_float_t)w * (1.0f / 65536.0f);
+    }
+    break;
   }
-  // weighting factor for smoothing depends on delta t / tau
-  nmea_float_t w =
-      min((nmea_float_t)1.0,
-          (nmea_float_t)(millis() - val[idx].lastUpdate) / val[idx].response);
-  // default smoothing
-  val[idx].smoothed = (1.0f - w) * val[idx].smoothed + w * v;
-  // special smoothing for some angle types
-  if (val[idx].type == NMEA_COMPASS_ANGLE_SIN)
-    val[idx].smoothed =
-        compassAngle(val[idx + 1].smoothed, val[idx + 2].smoothed);
-  if (val[idx].type == NMEA_BOAT_ANGLE_SIN)
-    val[idx].smoothed = boatAngle(val[idx + 1].smoothed, val[idx + 2].smoothed);
-  // some types just don't make sense to smooth -- use latest
-  if (val[idx].type == NMEA_BOAT_ANGLE)
-    val[idx].smoothed = val[idx].latest;
-  if (val[idx].type == NMEA_COMPASS_ANGLE)
-    val[idx].smoothed = val[idx].latest;
-  if (val[idx].type == NMEA_DDMM)
-    val[idx].smoothed = val[idx].latest;
-  if (val[idx].type == NMEA_HHMMSS)
-    val[idx].smoothed = val[idx].latest;
-
-  val[idx].lastUpdate = millis(); // take a time stamp
-  if (val[idx].hist) {            // there's a history struct for this tag
-    unsigned long seconds = (millis() - val[idx].hist->lastHistory) / 1000;
-    // do an update if the time has come, or if this is the first time through
-    if (seconds >= val[idx].hist->historyInterval ||
-        val[idx].hist->lastHistory == 0) {
-
-      // move the old history back in time by one step
-      for (unsigned i = 0; i < (val[idx].hist->n - 1); i++)
-        val[idx].hist->data[i] = val[idx].hist->data[i + 1];
 
+  d->lastUpdate = now; // take a time stamp
+  if (h) {             // there's a history struct for this tag
+    // do an update if the time has come, or if this is the first time through
+    if ((now - h->lastHistory) / 1000 >= h->historyInterval ||
+        h->lastHistory == 0) {
       // Create the new entry, scaling and offsetting the value to fit into an
-      // integer, and based on the smoothed value.
-      val[idx].hist->data[val[idx].hist->n - 1] =
-          val[idx].hist->scale * (val[idx].smoothed - val[idx].hist->offset);
-      val[idx].hist->lastHistory = millis();
+      // integer, and based on the smoothed value, over the oldest one.
+      if (fixed)
+        h->data[h->head] = (h->smooth + 16384L) >> 15;
+      else
+        h->data[h->head] = h->scale * (d->smoothed - h->offset);
+      if (++h->head >= h->n)
+        h->head = 0;
+      if (h->count < h->n)
+        h->count++;
+      h->lastHistory = now;
     }
   }
-#endif // NMEA_EXTENSIONS
 }
+#endif // NMEA_EXTENSIONS
 
 /**************************************************************************/
 /*!
@@ -317,6 +367,9 @@ nmea_float_t Adafruit_GPS::get(nmea_index_t idx) {
 nmea_float_t Adafruit_GPS::getSmoothed(nmea_index_t idx) {
   if (idx >= NMEA_MAX_INDEX || idx < NMEA_HDOP)
     return 0.0;
+  nmea_history_t *h = val[idx].hist;
+  if (h && h->fixedSmoothing && val[idx].type == NMEA_SIMPLE_FLOAT)
+    return h->smooth / (h->scale * 32768.0f) + h->offset;
   return val[idx].smoothed;
 }
 
@@ -345,8 +398,10 @@ void Adafruit_GPS::initDataValue(nmea_index_t idx, char *label, char *fmt,
       val[idx].fmt = fmt;
     if (unit)
       val[idx].unit = unit;
-    if (response)
-      val[idx].response = response;
+    if (response) {
+      val[idx].response = min(response, 65535UL);
+      val[idx].weight = 0xFFFFFFFFUL / val[idx].response;
+    }
     val[idx].type = type;
     if ((int)(val[idx].type / 10) ==
         1) { // angle with sin/cos component recording
@@ -373,13 +428,19 @@ void Adafruit_GPS::initDataValue(nmea_index_t idx, char *label, char *fmt,
     @param historyInterval Approximate Time in seconds between historical
    values.
     @param historyN Set size of data buffer.
+    @param fixedSmoothing Smooth the value with 32 bit integer arithmetic
+   rather than floating point, resolving 1/32768 of a history unit. Much
+   cheaper on processors without an FPU, like the AVR and SAMD21. Only
+   applies to values of type NMEA_SIMPLE_FLOAT, and the scaled value must
+   fit in 16 bits like the history itself.
     @return pointer to the history
 */
 /**************************************************************************/
 nmea_history_t *Adafruit_GPS::initHistory(nmea_index_t idx, nmea_float_t scale,
                                           nmea_float_t offset,
                                           unsigned historyInterval,
-                                          unsigned historyN) {
+                                          unsigned historyN,
+                                          bool fixedSmoothing) {
   historyN = max((unsigned)10, historyN);
   if (idx < NMEA_MAX_INDEX) {
     // remove any existing history
@@ -399,11 +460,17 @@ nmea_history_t *Adafruit_GPS::initHistory(nmea_index_t idx, nmea_float_t scale,
     }
     if (val[idx].hist != NULL) {
       val[idx].hist->n = historyN;
-      if (scale > 0.0f)
-        val[idx].hist->scale = scale;
-      val[idx].hist->offset = offset;
+      val[idx].hist->head = val[idx].hist->count = 0;
+      val[idx].hist->lastHistory = 0;
+      val[idx].hist->historyInterval = 20;
       if (historyInterval > 0)
         val[idx].hist->historyInterval = historyInterval;
+      val[idx].hist->scale = (scale > 0.0f) ? scale : 1.0f;
+      val[idx].hist->offset = offset;
+      val[idx].hist->fixedSmoothing = fixedSmoothing;
+      // start the filter from the current smoothed value
+      val[idx].hist->smooth = (int32_t)((val[idx].smoothed - offset) *
+                                        val[idx].hist->scale * 32768.0f);
     }
     return val[idx].hist;
   }
@@ -427,6 +494,69 @@ void Adafruit_GPS::removeHistory(nmea_index_t idx) {
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief Get a value from a data value's history.
+    @param idx The data index for the value
+    @param age How many history intervals back to look, 0 for the most recent
+    @return The historical value, or 0.0 if there is no history that old
+*/
+/**************************************************************************/
+nmea_float_t Adafruit_GPS::getHistory(nmea_index_t idx, unsigned age) {
+  if (idx >= NMEA_MAX_INDEX || val[idx].hist == NULL)
+    return 0.0;
+  nmea_history_t *h = val[idx].hist;
+  if (age >= h->count)
+    return 0.0;
+  unsigned i = (h->head > age) ? h->head - age - 1 : h->head + h->n - age - 1;
+  return h->data[i] / h->scale + h->offset;
+}
+
+/**************************************************************************/
+/*!
+    @brief Find the minimum, maximum and mean of the most recent part of a
+    data value's history, in one pass over the integer values.
+    @param idx The data index for the value
+    @param n The number of history values to include, 0 for all of them
+    @param minimum Pointer to return the minimum, or NULL
+    @param maximum Pointer to return the maximum, or NULL
+    @param mean Pointer to return the mean, or NULL
+    @return true if there was any history to look at
+*/
+/**************************************************************************/
+bool Adafruit_GPS::getHistoryStats(nmea_index_t idx, unsigned n,
+                                   nmea_float_t *minimum,
+                                   nmea_float_t *maximum, nmea_float_t *mean) {
+  if (idx >= NMEA_MAX_INDEX || val[idx].hist == NULL)
+    return false;
+  nmea_history_t *h = val[idx].hist;
+  if (n == 0 || n > h->count)
+    n = h->count;
+  if (n == 0)
+    return false;
+  int16_t lo = 32767, hi = -32768;
+  int32_t sum = 0;
+  // the newest n values may wrap around the end of the array
+  unsigned start = (h->head >= n) ? h->head - n : h->head + h->n - n;
+  for (unsigned k = 0, i = start; k < n; k++) {
+    int16_t x = h->data[i];
+    if (x < lo)
+      lo = x;
+    if (x > hi)
+      hi = x;
+    sum += x;
+    if (++i >= h->n)
+      i = 0;
+  }
+  if (minimum)
+    *minimum = lo / h->scale + h->offset;
+  if (maximum)
+    *maximum = hi / h->scale + h->offset;
+  if (mean)
+    *mean = (nmea_float_t)sum / n / h->scale + h->offset;
+  return true;
+}
+
 /**************************************************************************/
 /*!
     @brief Print out the current state of a data value. Primarily useful as
@@ -446,7 +576,7 @@ void Adafruit_GPS::showDataValue(nmea_index_t idx, int n) {
   Serial.print(", ");
   Serial.print(val[idx].latest, 4);
   Serial.print(", ");
-  Serial.print(val[idx].smoothed, 4);
+  Serial.print(getSmoothed(idx), 4);
   Serial.print(", at ");
   Serial.print(val[idx].lastUpdate);
   Serial.print(" ms, tau = ");
@@ -455,16 +585,17 @@ void Adafruit_GPS::showDataValue(nmea_index_t idx, int n) {
   Serial.print(val[idx].type);
   Serial.print(",  ockam:");
   Serial.print(val[idx].ockam);
-  if (val[idx].hist) {
+  nmea_history_t *h = val[idx].hist;
+  if (h) {
     Serial.print("\n     History at ");
-    Serial.print(val[idx].hist->historyInterval);
+    Serial.print(h->historyInterval);
     Serial.print(" second intervals:  ");
-    Serial.print(val[idx].hist->data[val[idx].hist->n - 1]);
-    for (unsigned i = val[idx].hist->n - 2;
-         i >= max(val[idx].hist->n - n, (unsigned)0);
-         i--) { // most recent first
-      Serial.print(", ");
-      Serial.print(val[idx].hist->data[i]);
+    unsigned i = h->head;
+    for (unsigned k = 0; k < min((unsigned)n, h->count); k++) {
+      i = i ? i - 1 : h->n - 1; // most recent first
+      if (k)
+        Serial.print(", ");
+      Serial.print(h->data[i]);
     }
   }
   Serial.print("\n");
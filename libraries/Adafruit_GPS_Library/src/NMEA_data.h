@@ -43,18 +43,27 @@ typedef NMEA_FLOAT_T
   can be converted back to an approximate float value with
   X = I / scale + offset
 
+  The data array is circular: each new value is written at head, which then
+  moves on, so adding a value takes the same time however long the history
+  is. Once count reaches n, data[head] is the oldest value. Use
+  getHistory() and getHistoryStats() rather than indexing it directly.
+
   Only some tags have history in order to save memory. Most of the memory
   cost is directly in the array.
 
   192 history values taken every 20 seconds covers just over an hour.
  **************************************************************************/
 typedef struct {
-  int16_t *data = NULL;          ///< array of ints, oldest first
+  int16_t *data = NULL;          ///< circular array of ints, see head
   unsigned n = 0;                ///< number of history array elements
+  unsigned head = 0;             ///< element the next value will go in
+  unsigned count = 0;            ///< number of elements filled so far
   uint32_t lastHistory = 0;      ///< millis() when history was last updated
   uint16_t historyInterval = 20; ///< seconds between history updates
   nmea_float_t scale = 1.0;      ///< history = (smoothed - offset) * scale
   nmea_float_t offset = 0.0;     ///< value = (float) history / scale + offset
+  bool fixedSmoothing = false;   ///< smooth in fixed point history units
+  int32_t smooth = 0; ///< fixed point smoothed value, history units * 32768
 } nmea_history_t;
 
 /**************************************************************************/
@@ -96,9 +105,11 @@ typedef enum {
 typedef struct {
   nmea_float_t latest = 0.0; ///< the most recently obtained value
   nmea_float_t smoothed =
-      0.0;                  ///< smoothed value based on weight of dt/response
+      0.0; ///< smoothed value based on weight of dt/response, not kept up to
+           ///< date with fixedSmoothing; getSmoothed() always is
   uint32_t lastUpdate = 0;  ///< millis() when latest was last set
   uint16_t response = 1000; ///< time constant in millis for smoothing
+  uint32_t weight = 4294967; ///< 0xFFFFFFFF / response, for smoothing
   nmea_value_type_t type =
       NMEA_SIMPLE_FLOAT; ///< type of float data value represented
   byte ockam = 0; ///< the corresponding Ockam Instruments tag number, 0-128
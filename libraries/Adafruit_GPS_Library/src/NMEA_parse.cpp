@@ -22,6 +22,11 @@
 
 #include <Adafruit_GPS.h>
 
+/// Pack a three character sentence ID into one integer for switch() dispatch
+#define NMEA_ID(a, b, c)                                                       \
+  (((uint32_t)(uint8_t)(a) << 16) | ((uint32_t)(uint8_t)(b) << 8) |            \
+   (uint32_t)(uint8_t)(c))
+
 /**************************************************************************/
 /*!
     @brief Parse a standard NMEA string and update the relevant variables.
@@ -51,190 +56,181 @@
 bool Adafruit_GPS::parse(char *nmea) {
   if (!check(nmea))
     return false;
-  // passed the check, so there's a valid source in thisSource and a valid
-  // sentence in thisSentence
-  char *p = nmea; // Pointer to move through the sentence -- good parsers are
-                  // non-destructive
-  p = strchr(p, ',') + 1; // Skip to char after the next comma, then check.
-
-  // This may look inefficient, but an M0 will get down the list in about 1 us /
-  // strcmp()! Put the GPS sentences from Adafruit_GPS at the top to make
-  // pruning excess code easier. Otherwise, keep them alphabetical for ease of
-  // reading.
-  if (!strcmp(thisSentence, "GGA")) { //************************************GGA
+  // passed the check, so there's a valid source in thisSource, a valid
+  // sentence in thisSentence and thisId, and the start of every field is
+  // known, so each one is reached with field() rather than by walking the
+  // string again. Good parsers are non-destructive.
+  char *p;
+
+  // Put the GPS sentences from Adafruit_GPS at the top to make pruning excess
+  // code easier. Otherwise, keep them alphabetical for ease of reading.
+  switch (thisId) {
+  case NMEA_ID('G', 'G', 'A'): //***************************************GGA
     // Adafruit from Actisense NGW-1 from SH CP150C
-    parseTime(p);
-    p = strchr(p, ',') + 1; // parse time with specialized function
-    // parse out both latitude and direction, then go to next field, or fail
-    if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
+    parseTime(field(nmea, 0));
+    // parse out both latitude and direction, or fail
+    if (parseCoord(field(nmea, 1), &latitudeDegrees, &latitude,
+                   &latitude_fixed, &lat))
       newDataValue(NMEA_LAT, latitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction, then go to next field, or fail
-    if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
+    // parse out both longitude and direction, or fail
+    if (parseCoord(field(nmea, 3), &longitudeDegrees, &longitude,
+                   &longitude_fixed, &lon))
       newDataValue(NMEA_LON, longitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+    p = field(nmea, 5);
     if (!isEmpty(p)) { // if it's a , (or a * at end of sentence) the value is
                        // not included
-      fixquality = atoi(p); // needs additional processing
+      fixquality = parseInteger(p); // needs additional processing
       if (fixquality > 0) {
         fix = true;
         lastFix = sentTime;
       } else
         fix = false;
     }
-    p = strchr(p, ',') + 1; // then move on to the next
-    // Most can just be parsed with atoi() or atof(), then move on to the next.
+    // Most can just be parsed with parseInteger() or parseDecimal()
+    p = field(nmea, 6);
     if (!isEmpty(p))
-      satellites = atoi(p);
-    p = strchr(p, ',') + 1;
+      satellites = parseInteger(p);
+    p = field(nmea, 7);
     if (!isEmpty(p))
-      newDataValue(NMEA_HDOP, HDOP = atof(p));
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_HDOP, HDOP = parseDecimal(p));
+    p = field(nmea, 8);
     if (!isEmpty(p))
-      altitude = atof(p);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1; // skip the units
+      altitude = parseDecimal(p);
+    p = field(nmea, 10); // skip the units
     if (!isEmpty(p))
-      geoidheight = atof(p); // skip the rest
+      geoidheight = parseDecimal(p); // skip the rest
+    break;
 
-  } else if (!strcmp(thisSentence, "RMC")) { //*****************************RMC
+  case NMEA_ID('R', 'M', 'C'): //***************************************RMC
     // in Adafruit from Actisense NGW-1 from SH CP150C
-    parseTime(p);
-    p = strchr(p, ',') + 1;
-    parseFix(p);
-    p = strchr(p, ',') + 1;
-    // parse out both latitude and direction, then go to next field, or fail
-    if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
+    parseTime(field(nmea, 0));
+    parseFix(field(nmea, 1));
+    // parse out both latitude and direction, or fail
+    if (parseCoord(field(nmea, 2), &latitudeDegrees, &latitude,
+                   &latitude_fixed, &lat))
       newDataValue(NMEA_LAT, latitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction, then go to next field, or fail
-    if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
+    // parse out both longitude and direction, or fail
+    if (parseCoord(field(nmea, 4), &longitudeDegrees, &longitude,
+                   &longitude_fixed, &lon))
       newDataValue(NMEA_LON, longitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+    p = field(nmea, 6);
     if (!isEmpty(p))
-      newDataValue(NMEA_SOG, speed = atof(p));
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_SOG, speed = parseDecimal(p));
+    p = field(nmea, 7);
     if (!isEmpty(p))
-      newDataValue(NMEA_COG, angle = atof(p));
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_COG, angle = parseDecimal(p));
+    p = field(nmea, 8);
     if (!isEmpty(p)) {
-      uint32_t fulldate = atof(p);
+      uint32_t fulldate = parseInteger(p);
       day = fulldate / 10000;
       month = (fulldate % 10000) / 100;
       year = (fulldate % 100);
       lastDate = sentTime;
     } // skip the rest
+    break;
 
-  } else if (!strcmp(thisSentence, "GLL")) { //*****************************GLL
+  case NMEA_ID('G', 'L', 'L'): //***************************************GLL
     // in Adafruit from Actisense NGW-1 from SH CP150C
-    // parse out both latitude and direction, then go to next field, or fail
-    if (parseCoord(p, &latitudeDegrees, &latitude, &latitude_fixed, &lat))
+    // parse out both latitude and direction, or fail
+    if (parseCoord(field(nmea, 0), &latitudeDegrees, &latitude,
+                   &latitude_fixed, &lat))
       newDataValue(NMEA_LAT, latitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction, then go to next field, or fail
-    if (parseCoord(p, &longitudeDegrees, &longitude, &longitude_fixed, &lon))
+    // parse out both longitude and direction, or fail
+    if (parseCoord(field(nmea, 2), &longitudeDegrees, &longitude,
+                   &longitude_fixed, &lon))
       newDataValue(NMEA_LON, longitudeDegrees);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    parseTime(p);
-    p = strchr(p, ',') + 1;
-    parseFix(p); // skip the rest
+    parseTime(field(nmea, 4));
+    parseFix(field(nmea, 5)); // skip the rest
+    break;
 
-  } else if (!strcmp(thisSentence, "GSA")) { //*****************************GSA
+  case NMEA_ID('G', 'S', 'A'): //***************************************GSA
     // in Adafruit from Actisense NGW-1
-    p = strchr(p, ',') + 1; // skip selection mode
+    p = field(nmea, 1); // skip selection mode
     if (!isEmpty(p))
-      fixquality_3d = atoi(p);
-    p = strchr(p, ',') + 1;
+      fixquality_3d = parseInteger(p);
     // skip 12 Satellite PDNs without interpreting them
-    for (int i = 0; i < 12; i++)
-      p = strchr(p, ',') + 1;
+    p = field(nmea, 14);
     if (!isEmpty(p))
-      PDOP = atof(p);
-    p = strchr(p, ',') + 1;
+      PDOP = parseDecimal(p);
     // parse out HDOP, we also parse this from the GGA sentence. Chipset should
     // report the same for both
+    p = field(nmea, 15);
     if (!isEmpty(p))
-      newDataValue(NMEA_HDOP, HDOP = atof(p));
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_HDOP, HDOP = parseDecimal(p));
+    p = field(nmea, 16);
     if (!isEmpty(p))
-      VDOP = atof(p); // last before checksum
+      VDOP = parseDecimal(p); // last before checksum
+    break;
 
-  } else if (!strcmp(thisSentence, "TOP")) { //*****************************TOP
+  case NMEA_ID('T', 'O', 'P'): //***************************************TOP
     // See:
     // https://learn.adafruit.com/adafruit-ultimate-gps-featherwing/antenna-options
     // There is an output sentence that will tell you the status of the
     // antenna. $PGTOP,11,x where x is the status number. If x is 3 that means
     // it is using the external antenna. If x is 2 it's using the internal
-    p = strchr(p, ',') + 1;
-    parseAntenna(p);
-  }
+    parseAntenna(field(nmea, 1));
+    break;
 
 #ifdef NMEA_EXTENSIONS // Sentences not required for basic GPS functionality
-  else if (!strcmp(thisSentence, "APB")) { //*******************************APB
-    // from Actisense NGW-1 from SH CP150C
-    return false;
-
-  } else if (!strcmp(thisSentence, "DBT")) { //*****************************DBT
+  case NMEA_ID('A', 'P', 'B'): // from Actisense NGW-1 from SH CP150C
+  case NMEA_ID('D', 'P', 'T'): // from Actisense NGW-1
+  case NMEA_ID('G', 'S', 'V'): // from Actisense NGW-1
+  case NMEA_ID('H', 'D', 'G'): // from Actisense NGW-1 from SH CP150C
+  case NMEA_ID('M', 'W', 'D'): // from Actisense NGW-1
+  case NMEA_ID('R', 'O', 'T'):
+  case NMEA_ID('R', 'P', 'M'):
+  case NMEA_ID('R', 'S', 'A'): // from Actisense NGW-1
+  case NMEA_ID('V', 'D', 'R'): // from Actisense NGW-1
+  case NMEA_ID('V', 'T', 'G'): // from Actisense NGW-1 from SH CP150C
+  case NMEA_ID('Z', 'D', 'A'): // from Actisense NGW-1
+    return false;              // known, but not parsed yet
+
+  case NMEA_ID('D', 'B', 'T'): //***************************************DBT
     // from Actisense NGW-1
     // feet, metres, fathoms below transducer coerced to water depth from
     // surface in metres
+    p = field(nmea, 0);
     if (!isEmpty(p))
       newDataValue(NMEA_DEPTH,
-                   (nmea_float_t)atof(p) * 0.3048f + depthToTransducer);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      newDataValue(NMEA_DEPTH, (nmea_float_t)atof(p) + depthToTransducer);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+                   (nmea_float_t)parseDecimal(p) * 0.3048f + depthToTransducer);
+    p = field(nmea, 2);
     if (!isEmpty(p))
       newDataValue(NMEA_DEPTH,
-                   (nmea_float_t)atof(p) * 6 * 0.3048f + depthToTransducer);
-
-  } else if (!strcmp(thisSentence, "DPT")) { //*****************************DPT
-    // from Actisense NGW-1
-    return false;
-
-  } else if (!strcmp(thisSentence, "GSV")) { //*****************************GSV
-    // from Actisense NGW-1
-    return false;
-
-  } else if (!strcmp(thisSentence, "HDG")) { //*****************************HDG
-    // from Actisense NGW-1 from SH CP150C
-    return false;
+                   (nmea_float_t)parseDecimal(p) + depthToTransducer);
+    p = field(nmea, 4);
+    if (!isEmpty(p))
+      newDataValue(NMEA_DEPTH, (nmea_float_t)parseDecimal(p) * 6 * 0.3048f +
+                                   depthToTransducer);
+    break;
 
-  } else if (!strcmp(thisSentence, "HDM")) { //*****************************HDM
+  case NMEA_ID('H', 'D', 'M'): //***************************************HDM
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      newDataValue(NMEA_HDG, atof(p)); // skip the rest
+      newDataValue(NMEA_HDG, parseDecimal(p)); // skip the rest
+    break;
 
-  } else if (!strcmp(thisSentence, "HDT")) { //*****************************HDT
+  case NMEA_ID('H', 'D', 'T'): //***************************************HDT
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      newDataValue(NMEA_HDT, atof(p)); // skip the rest
+      newDataValue(NMEA_HDT, parseDecimal(p)); // skip the rest
+    break;
 
-  } else if (!strcmp(thisSentence, "MDA")) { //*****************************MDA
+  case NMEA_ID('M', 'D', 'A'): { //*************************************MDA
     // from Actisense NGW-1
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      newDataValue(NMEA_BAROMETER, atof(p) * 3386.39);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_BAROMETER, parseDecimal(p) * 3386.39);
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      newDataValue(NMEA_BAROMETER, atof(p) * 100000);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_BAROMETER, parseDecimal(p) * 100000);
     nmea_float_t T = 100000.;
     char u = 'C';
+    p = field(nmea, 4);
     if (!isEmpty(p))
-      T = atof(p);
-    p = strchr(p, ',') + 1;
+      T = parseDecimal(p);
+    p = field(nmea, 5);
     if (!isEmpty(p))
       u = *p;
-    p = strchr(p, ',') + 1;
     if (u != 'C') {
       T = (T - 32) / 1.8f;
       u = 'C';
@@ -243,27 +239,31 @@ bool Adafruit_GPS::parse(char *nmea) {
       newDataValue(NMEA_TEMPERATURE_AIR, T);
     T = 100000.;
     u = 'C';
+    p = field(nmea, 6);
     if (!isEmpty(p))
-      T = atof(p);
-    p = strchr(p, ',') + 1;
+      T = parseDecimal(p);
+    p = field(nmea, 7);
     if (!isEmpty(p))
       u = *p;
-    p = strchr(p, ',') + 1;
     if (u != 'C') {
       T = (T - 32) / 1.8f;
       u = 'C';
     }
     if (T < 1000)
       newDataValue(NMEA_TEMPERATURE_WATER, T);
+    p = field(nmea, 8);
     if (!isEmpty(p))
-      newDataValue(NMEA_HUMIDITY, atof(p)); // skip the rest
+      newDataValue(NMEA_HUMIDITY, parseDecimal(p)); // skip the rest
+    break;
+  }
 
-  } else if (!strcmp(thisSentence, "MTW")) { //*****************************MTW
+  case NMEA_ID('M', 'T', 'W'): { //*************************************MTW
     nmea_float_t T = 100000.;
     char u = 'C';
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      T = atof(p);
-    p = strchr(p, ',') + 1;
+      T = parseDecimal(p);
+    p = field(nmea, 1);
     if (!isEmpty(p))
       u = *p; // last before checksum
     if (u != 'C') {
@@ -272,30 +272,29 @@ bool Adafruit_GPS::parse(char *nmea) {
     }
     if (T < 1000)
       newDataValue(NMEA_TEMPERATURE_WATER, T);
+    break;
+  }
 
-  } else if (!strcmp(thisSentence, "MWD")) { //*****************************MWD
-    // from Actisense NGW-1
-    return false;
-
-  } else if (!strcmp(thisSentence, "MWV")) { //*****************************MWV
+  case NMEA_ID('M', 'W', 'V'): { //*************************************MWV
     // from Actisense NGW-1
     nmea_float_t ang = 100000.;
     char ref = 'T';
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      ang = atof(p);
-    p = strchr(p, ',') + 1;
+      ang = parseDecimal(p);
+    p = field(nmea, 1);
     if (!isEmpty(p))
       ref = *p;
-    p = strchr(p, ',') + 1;
     nmea_float_t spd = 100000.;
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      spd = atof(p);
-    p = strchr(p, ',') + 1;
+      spd = parseDecimal(p);
     char units = 'N';
+    p = field(nmea, 3);
     if (!isEmpty(p))
       units = *p;
-    p = strchr(p, ',') + 1;
     char stat = 'A';
+    p = field(nmea, 4);
     if (!isEmpty(p))
       stat = *p; // last before checksum
     if (units == 'K') {
@@ -319,8 +318,10 @@ bool Adafruit_GPS::parse(char *nmea) {
       if (spd < 1000.0f && stat == 'A')
         newDataValue(NMEA_TWS, spd);
     }
+    break;
+  }
 
-  } else if (!strcmp(thisSentence, "RMB")) { //*****************************RMB
+  case NMEA_ID('R', 'M', 'B'): { //*************************************RMB
     // from Actisense NGW-1 from SH CP150C
     // RMB Recommended Minimum Navigation Information
     //       1 2   3 4    5    6       7 8        9 10  11 12  13 14
@@ -337,26 +338,26 @@ bool Adafruit_GPS::parse(char *nmea) {
     // 11) Bearing to destination in degrees True
     // 12) Destination closing velocity in knots
     // 13) Arrival Status, A = Arrival Circle Entered 14) Checksum
-    p = strchr(p, ',') + 1; // skip status
+    // field(nmea, n) is item n + 1 above, so skip status
     nmea_float_t xte = 100000.;
     char xteDir = 'X';
+    p = field(nmea, 1);
     if (!isEmpty(p))
-      xte = atof(p);
-    p = strchr(p, ',') + 1;
+      xte = parseDecimal(p);
+    p = field(nmea, 2);
     if (!isEmpty(p))
       xteDir = *p;
-    p = strchr(p, ',') + 1;
     if (xte < 10000.0f && xteDir != 'X') {
       if (xteDir == 'L')
         xte *= -1.0f;
       newDataValue(NMEA_XTE, xte);
     }
+    p = field(nmea, 3);
     if (!isEmpty(p))
       parseStr(toID, p, NMEA_MAX_WP_ID);
-    p = strchr(p, ',') + 1;
+    p = field(nmea, 4);
     if (!isEmpty(p))
       parseStr(fromID, p, NMEA_MAX_WP_ID);
-    p = strchr(p, ',') + 1;
     nmea_float_t latitudeWP = 0;
     nmea_float_t longitudeWP = 0;
     int32_t latitude_fixedWP = 0;
@@ -366,8 +367,8 @@ bool Adafruit_GPS::parse(char *nmea) {
     char latWP = 'X';
     char lonWP = 'X';
 
-    // parse out both latitude and direction for WayPoint, then go to next
-    // field, or fail
+    // parse out both latitude and direction for WayPoint, or fail
+    p = field(nmea, 5);
     if (!isEmpty(p)) {
       if (!parseCoord(p, &latitudeDegreesWP, &latitudeWP, &latitude_fixedWP,
                       &latWP))
@@ -375,10 +376,8 @@ bool Adafruit_GPS::parse(char *nmea) {
       else
         newDataValue(NMEA_LATWP, latitudeDegreesWP);
     }
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
-    // parse out both longitude and direction for WayPoint, then go to next
-    // field, or fail
+    // parse out both longitude and direction for WayPoint, or fail
+    p = field(nmea, 7);
     if (!isEmpty(p)) {
       if (!parseCoord(p, &longitudeDegreesWP, &longitudeWP, &longitude_fixedWP,
                       &lonWP))
@@ -386,114 +385,96 @@ bool Adafruit_GPS::parse(char *nmea) {
       else
         newDataValue(NMEA_LONWP, longitudeDegreesWP);
     }
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+    p = field(nmea, 9);
     if (!isEmpty(p))
-      newDataValue(NMEA_DISTWP, atof(p));
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_DISTWP, parseDecimal(p));
+    p = field(nmea, 10);
     if (!isEmpty(p))
-      newDataValue(NMEA_COGWP, atof(p));
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_COGWP, parseDecimal(p));
+    p = field(nmea, 11);
     if (!isEmpty(p))
-      newDataValue(NMEA_VMGWP, atof(p)); // skip arrival flag
-
-  } else if (!strcmp(thisSentence, "ROT")) { //*****************************ROT
-    return false;
-
-  } else if (!strcmp(thisSentence, "RPM")) { //*****************************RPM
-    return false;
-
-  } else if (!strcmp(thisSentence, "RSA")) { //*****************************RSA
-    // from Actisense NGW-1
-    return false;
+      newDataValue(NMEA_VMGWP, parseDecimal(p)); // skip arrival flag
+    break;
+  }
 
-  } else if (!strcmp(thisSentence, "TXT")) { //*****************************TXT
+  case NMEA_ID('T', 'X', 'T'): //***************************************TXT
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      txtTot = atoi(p);
-    p = strchr(p, ',') + 1;
+      txtTot = parseInteger(p);
+    p = field(nmea, 1);
     if (!isEmpty(p))
-      txtN = atoi(p);
-    p = strchr(p, ',') + 1;
+      txtN = parseInteger(p);
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      txtID = atoi(p);
-    p = strchr(p, ',') + 1;
+      txtID = parseInteger(p);
+    p = field(nmea, 3);
     if (!isEmpty(p))
       parseStr(txtTXT, p, 61); // copy the text to NMEA TXT max of 61 characters
+    break;
 
-  } else if (!strcmp(thisSentence, "VDR")) { //*****************************VDR
-    // from Actisense NGW-1
-    return false;
-
-  } else if (!strcmp(thisSentence, "VHW")) { //*****************************VHW
+  case NMEA_ID('V', 'H', 'W'): //***************************************VHW
     // from Actisense NGW-1
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      newDataValue(NMEA_HDT, atof(p));
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_HDT, parseDecimal(p));
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      newDataValue(NMEA_HDG, atof(p));
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_HDG, parseDecimal(p));
+    p = field(nmea, 4);
     if (!isEmpty(p))
-      newDataValue(NMEA_VTW, atof(p)); // skip the other units
+      newDataValue(NMEA_VTW, parseDecimal(p)); // skip the other units
+    break;
 
-  } else if (!strcmp(thisSentence, "VLW")) { //*****************************VLW
+  case NMEA_ID('V', 'L', 'W'): //***************************************VLW
     // from Actisense NGW-1
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      newDataValue(NMEA_LOG, atof(p));
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+      newDataValue(NMEA_LOG, parseDecimal(p));
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      newDataValue(NMEA_LOGR, atof(p)); // skip the other units
+      newDataValue(NMEA_LOGR, parseDecimal(p)); // skip the other units
+    break;
 
-  } else if (!strcmp(thisSentence, "VPW")) { //*****************************VPW
+  case NMEA_ID('V', 'P', 'W'): { //*************************************VPW
     // knots, metres/s coerced to knots
     nmea_float_t vmg = 100000.;
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      vmg = atof(p);
-    p = strchr(p, ',') + 1;
-    p = strchr(p, ',') + 1;
+      vmg = parseDecimal(p);
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      vmg = atof(p) * 0.3048 * 3600. / 6000.; // skip units
+      vmg = parseDecimal(p) * 0.3048 * 3600. / 6000.; // skip units
     if (vmg < 1000.0f)
       newDataValue(NMEA_VMG, vmg);
-  } else if (!strcmp(thisSentence, "VTG")) { //*****************************VTG
-    // from Actisense NGW-1 from SH CP150C
-    return false;
+    break;
+  }
 
-  } else if (!strcmp(thisSentence, "VWR")) { //*****************************VWR
+  case NMEA_ID('V', 'W', 'R'): { //*************************************VWR
     // from Actisense NGW-1
     nmea_float_t ang = 1000.;
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      ang = atof(p);
-    p = strchr(p, ',') + 1;
+      ang = parseDecimal(p);
     char ref = ' ';
+    p = field(nmea, 1);
     if (!isEmpty(p))
       ref = *p;
-    p = strchr(p, ',') + 1;
     if (ref == 'L')
       ang *= -1;
     if (ang < 1000.0f)
       newDataValue(NMEA_AWA, ang);
     nmea_float_t ws = 0.0;
     char units = 'X';
-    if (!isEmpty(p))
-      ws = atof(p);
-    p = strchr(p, ',') + 1; // knots
-    if (!isEmpty(p))
-      units = *p;
-    p = strchr(p, ',') + 1;
-    if (!isEmpty(p))
-      ws = atof(p);
-    p = strchr(p, ',') + 1; // meters / second
-    if (!isEmpty(p))
-      units = *p;
-    p = strchr(p, ',') + 1; // M
-    if (!isEmpty(p))
-      ws = atof(p);
-    p = strchr(p, ',') + 1; // kilometers / hour can be converted back to knots
-    if (!isEmpty(p))
-      units = *p; // last before checksum
+    // the same speed in knots, metres / second and kilometres / hour; the
+    // last one present wins and is converted back to knots
+    for (uint8_t i = 2; i <= 6; i += 2) {
+      p = field(nmea, i);
+      if (!isEmpty(p))
+        ws = parseDecimal(p);
+      p = field(nmea, i + 1);
+      if (!isEmpty(p))
+        units = *p;
+    }
     if (units == 'M') {
       ws *= 3.6f;
       units = 'K';
@@ -508,37 +489,37 @@ bool Adafruit_GPS::parse(char *nmea) {
     } // convert miles / hr to knots
     if (units == 'N')
       newDataValue(NMEA_AWS, ws); // store the final result
+    break;
+  }
 
-  } else if (!strcmp(thisSentence, "WCV")) { //*****************************WCV
+  case NMEA_ID('W', 'C', 'V'): //***************************************WCV
     // from SH CP150C
+    p = field(nmea, 0);
     if (!isEmpty(p))
-      newDataValue(NMEA_VMGWP, atof(p)); // skip the rest
+      newDataValue(NMEA_VMGWP, parseDecimal(p)); // skip the rest
+    break;
 
-  } else if (!strcmp(thisSentence, "XTE")) { //*****************************XTE
+  case NMEA_ID('X', 'T', 'E'): { //*************************************XTE
     // from Actisense NGW-1 from SH CP150C
-    p = strchr(p, ',') + 1; // skip status 1
-    p = strchr(p, ',') + 1; // skip status 2
+    // skip status 1 and status 2
     nmea_float_t xte = 100000.;
     char xteDir = 'X';
+    p = field(nmea, 2);
     if (!isEmpty(p))
-      xte = atof(p);
-    p = strchr(p, ',') + 1;
+      xte = parseDecimal(p);
+    p = field(nmea, 3);
     if (!isEmpty(p))
       xteDir = *p;
-    p = strchr(p, ',') + 1;
     if (xte < 10000.0f && xteDir != 'X') {
       if (xteDir == 'L')
         xte *= -1.0f;
       newDataValue(NMEA_XTE, xte);
     } // skip units
-
-  } else if (!strcmp(thisSentence, "ZDA")) { //*****************************ZDA
-    // from Actisense NGW-1
-    return false;
+    break;
   }
 #endif // NMEA_EXTENSIONS
 
-  else {
+  default:
     return false; // didn't find the required sentence definition
   }
 
@@ -554,83 +535,165 @@ bool Adafruit_GPS::parse(char *nmea) {
     @brief Check an NMEA string for basic format, valid source ID and valid
     and valid sentence ID. Update the values of thisCheck, thisSource and
     thisSentence.
+
+    This is a single pass over the sentence: the checksum is accumulated and
+    the start of each field after the sentence ID is recorded on the way to
+    the final '*', so parse() can go straight to any field afterwards. The
+    source and sentence IDs are then classified with a switch() on their
+    packed characters rather than by comparing strings against lists.
+    Sentences longer than 255 characters are rejected; the NMEA-183 limit is
+    82.
     @param nmea Pointer to the NMEA string
     @return True if well formed, false if it has problems
 */
 /**************************************************************************/
 bool Adafruit_GPS::check(char *nmea) {
   thisCheck = 0; // new check
+  thisId = 0;
+  fieldCount = 0;
   *thisSentence = *thisSource = 0;
   if (*nmea != '$' && *nmea != '!')
     return false; // doesn't start with $ or !
   else
     thisCheck += NMEA_HAS_DOLLAR;
   // do checksum check -- first look if we even have one -- ignore all but last
-  // *
-  char *ast = nmea; // not strchr(nmea,'*'); for first *
-  while (*ast)
-    ast++; // go to the end
-  while (*ast != '*' && ast > nmea)
-    ast--; // then back to * if it's there
-  if (*ast != '*')
-    return false; // there is no asterisk
-  else {
-    uint16_t sum = parseHex(*(ast + 1)) * 16; // extract checksum
-    sum += parseHex(*(ast + 2));
-    char *p = nmea; // check checksum
-    for (char *p1 = p + 1; p1 < ast; p1++)
-      sum ^= *p1;
-    if (sum != 0)
-      return false; // bad checksum :(
-    else
-      thisCheck += NMEA_HAS_CHECKSUM;
+  // *, so keep the running sum and field count as of each one seen
+  uint8_t sum = 0, starSum = 0;
+  uint8_t n = 0, starFields = 0;
+  char *ast = NULL;
+  for (char *p1 = nmea + 1; *p1; p1++) {
+    if (p1 - nmea > 255)
+      return false; // too long for the 8 bit field offsets
+    if (*p1 == '*') {
+      ast = p1;
+      starSum = sum;
+      starFields = n;
+    } else if (*p1 == ',' && n < NMEA_MAX_FIELDS) {
+      fieldStart[n++] = p1 + 1 - nmea;
+    }
+    sum ^= *p1;
   }
+  if (ast == NULL)
+    return false; // there is no asterisk
+  starSum ^= parseHex(*(ast + 1)) * 16; // extract checksum
+  if (*(ast + 1))
+    starSum ^= parseHex(*(ast + 2));
+  if (starSum != 0)
+    return false; // bad checksum :(
+  else
+    thisCheck += NMEA_HAS_CHECKSUM;
+  fieldCount = starFields;
+  starOffset = ast - nmea;
+
   // extract source of variable length
   char *p = nmea + 1;
-  const char *src = tokenOnList(p, sources);
-  if (src) {
-    strcpy(thisSource, src);
-    thisCheck += NMEA_HAS_SOURCE;
-  } else
+  uint8_t srcLen = 0;
+  if (p[0] && p[1]) {
+    switch (((uint16_t)(uint8_t)p[0] << 8) | (uint8_t)p[1]) {
+    case ('I' << 8) | 'I':
+    case ('W' << 8) | 'I':
+    case ('G' << 8) | 'P':
+    case ('P' << 8) | 'G':
+    case ('G' << 8) | 'N':
+      srcLen = 2;
+      break;
+    }
+  }
+  if (!srcLen && p[0] == 'P')
+    srcLen = 1;
+  if (!srcLen)
     return false;
-  p += strlen(src);
+  strncpy(thisSource, p, srcLen);
+  thisSource[srcLen] = 0;
+  thisCheck += NMEA_HAS_SOURCE;
+  p += srcLen;
+
   // extract sentence id and check if parsed
-  const char *snc = tokenOnList(p, sentences_parsed);
-  if (snc) {
-    strcpy(thisSentence, snc);
-    thisCheck += NMEA_HAS_SENTENCE_P + NMEA_HAS_SENTENCE;
-  } else { // check if known
-    snc = tokenOnList(p, sentences_known);
-    if (snc) {
-      strcpy(thisSentence, snc);
-      thisCheck += NMEA_HAS_SENTENCE;
+  uint32_t id = 0;
+  uint8_t i = 0;
+  for (; i < 3 && p[i]; i++)
+    id = (id << 8) | (uint8_t)p[i];
+  uint8_t kind = (i == 3) ? sentenceKind(id) : 0;
+  if (kind) {
+    strncpy(thisSentence, p, 3);
+    thisSentence[3] = 0;
+    thisCheck += NMEA_HAS_SENTENCE;
+    if (kind == 1)
       return false; // known but not parsed
-    } else {
-      parseStr(thisSentence, p, NMEA_MAX_SENTENCE_ID);
-      return false; // unknown
-    }
+    thisCheck += NMEA_HAS_SENTENCE_P;
+    thisId = id;
+  } else {
+    parseStr(thisSentence, p, NMEA_MAX_SENTENCE_ID);
+    return false; // unknown
   }
   return true; // passed all the tests
 }
 
 /**************************************************************************/
 /*!
-    @brief Check if a token at the start of a string is on a list.
-    @param token Pointer to the string
-    @param list A list of strings, with the final entry starting "ZZ"
-    @return Pointer to the found token, or NULL if it fails
+    @brief Classify a packed sentence ID, replacing the lists of parsed and
+    known sentences previously searched with strncmp().
+    @param id Sentence ID packed by NMEA_ID()
+    @return 2 if parse() handles it, 1 if known but not parsed, 0 if unknown
 */
 /**************************************************************************/
-const char *Adafruit_GPS::tokenOnList(char *token, const char **list) {
-  int i = 0; // index in the list
-  while (strncmp(list[i], "ZZ", 2) &&
-         i < 1000) { // stop at terminator and don't crash without it
-    // test for a match on the sentence name
-    if (!strncmp((const char *)list[i], (const char *)token, strlen(list[i])))
-      return list[i];
-    i++;
+uint8_t Adafruit_GPS::sentenceKind(uint32_t id) {
+  switch (id) {
+  case NMEA_ID('G', 'G', 'A'):
+  case NMEA_ID('G', 'L', 'L'):
+  case NMEA_ID('G', 'S', 'A'):
+  case NMEA_ID('R', 'M', 'C'):
+  case NMEA_ID('T', 'O', 'P'):
+#ifdef NMEA_EXTENSIONS
+  case NMEA_ID('D', 'B', 'T'):
+  case NMEA_ID('H', 'D', 'M'):
+  case NMEA_ID('H', 'D', 'T'):
+  case NMEA_ID('M', 'D', 'A'):
+  case NMEA_ID('M', 'T', 'W'):
+  case NMEA_ID('M', 'W', 'V'):
+  case NMEA_ID('R', 'M', 'B'):
+  case NMEA_ID('T', 'X', 'T'):
+  case NMEA_ID('V', 'H', 'W'):
+  case NMEA_ID('V', 'L', 'W'):
+  case NMEA_ID('V', 'P', 'W'):
+  case NMEA_ID('V', 'W', 'R'):
+  case NMEA_ID('W', 'C', 'V'):
+  case NMEA_ID('X', 'T', 'E'):
+#endif
+    return 2;
+#ifdef NMEA_EXTENSIONS
+  case NMEA_ID('A', 'P', 'B'):
+  case NMEA_ID('D', 'P', 'T'):
+  case NMEA_ID('G', 'S', 'V'):
+  case NMEA_ID('H', 'D', 'G'):
+  case NMEA_ID('M', 'W', 'D'):
+  case NMEA_ID('R', 'O', 'T'):
+  case NMEA_ID('R', 'P', 'M'):
+  case NMEA_ID('R', 'S', 'A'):
+  case NMEA_ID('V', 'D', 'R'):
+  case NMEA_ID('V', 'T', 'G'):
+  case NMEA_ID('Z', 'D', 'A'):
+#else
+  case NMEA_ID('D', 'B', 'T'):
+  case NMEA_ID('H', 'D', 'M'):
+  case NMEA_ID('H', 'D', 'T'):
+#endif
+    return 1;
   }
-  return NULL; // couldn't find a match
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief Find a field of the sentence most recently passed by check().
+    @param nmea Pointer to the NMEA string given to check()
+    @param i Field number, 0 for the first one after the sentence ID
+    @return Pointer to the start of the field, or to the '*' if the sentence
+    has fewer fields, so that isEmpty() is true for missing fields
+*/
+/**************************************************************************/
+char *Adafruit_GPS::field(char *nmea, uint8_t i) {
+  return nmea + (i < fieldCount ? fieldStart[i] : starOffset);
 }
 
 /**************************************************************************/
@@ -682,18 +745,29 @@ bool Adafruit_GPS::parseCoord(char *pStart, nmea_float_t *angleDegrees,
                               char *dir) {
   char *p = pStart;
   if (!isEmpty(p)) {
-    // get the number in DDDMM.mmmm format and break into components
-    char degreebuff[10] = {0}; // Ensure string is terminated after strncpy
-    char *e = strchr(p, '.');
-    if (e == NULL || e - p > 6)
-      return false;                // no decimal point in range
-    strncpy(degreebuff, p, e - p); // get DDDMM
-    long dddmm = atol(degreebuff);
-    long degrees = (dddmm / 100);         // truncate the minutes
-    long minutes = dddmm - degrees * 100; // remove the degrees
-    p = e;                                // start from the decimal point
-    nmea_float_t decminutes = atof(e); // the fraction after the decimal point
-    p = strchr(p, ',') + 1;            // go to the next field
+    // get the number in DDDMM.mmmm format and break into components, all in
+    // integers so nothing is lost to float rounding on the way to fixed
+    int32_t dddmm = 0;
+    uint8_t digits = 0;
+    for (; *p >= '0' && *p <= '9'; p++, digits++)
+      dddmm = dddmm * 10 + (*p - '0');
+    if (*p != '.' || digits > 6)
+      return false;                       // no decimal point in range
+    int32_t degrees = (dddmm / 100);       // truncate the minutes
+    int32_t minutes = dddmm - degrees * 100; // remove the degrees
+    // the fraction after the decimal point in 1/10000000 minute, ignoring
+    // any digits past that
+    int32_t decminutes = 0;
+    int32_t scale = 1000000;
+    for (p++; *p >= '0' && *p <= '9'; p++) {
+      decminutes += (*p - '0') * scale;
+      scale /= 10;
+    }
+    while (*p != ',' && *p != '*' && *p)
+      p++; // go to the next field
+    if (*p != ',')
+      return false; // no direction provided
+    p++;
 
     // get the NSEW direction as a character
     char nsew = 'X';
@@ -703,9 +777,9 @@ bool Adafruit_GPS::parseCoord(char *pStart, nmea_float_t *angleDegrees,
       return false; // no direction provided
 
     // set the various numerical formats to their values
-    long fixed = degrees * 10000000 + (minutes * 10000000) / 60 +
-                 (decminutes * 10000000) / 60;
-    nmea_float_t ang = degrees * 100 + minutes + decminutes;
+    int32_t fixed =
+        degrees * 10000000 + (minutes * 10000000 + decminutes) / 60;
+    nmea_float_t ang = degrees * 100 + minutes + decminutes / 10000000.;
     nmea_float_t deg = fixed / (nmea_float_t)10000000.;
     if (nsew == 'S' ||
         nsew == 'W') { // fixed and deg are signed, but DDDMM.mmmm is not
@@ -719,9 +793,9 @@ bool Adafruit_GPS::parseCoord(char *pStart, nmea_float_t *angleDegrees,
 
     // reject angles that are out of range
     if (nsew == 'N' || nsew == 'S')
-      if (abs(deg) > 90)
+      if (abs(fixed) > 900000000L)
         return false;
-    if (abs(deg) > 180)
+    if (abs(fixed) > 1800000000L)
       return false;
 
     // store in locations passed as args
@@ -760,10 +834,11 @@ char *Adafruit_GPS::parseStr(char *buff, char *p, int n) {
     if (e) {
       len = min(int(e - p), n - 1);
       strncpy(buff, p, len); // or up to the *
-      buff[e - p] = 0;
+      buff[len] = 0;
     } else {
       len = min((int)strlen(p), n - 1);
       strncpy(buff, p, len); // or to the end or max capacity
+      buff[len] = 0;
     }
   }
   return buff;
@@ -779,16 +854,20 @@ char *Adafruit_GPS::parseStr(char *buff, char *p, int n) {
 /**************************************************************************/
 bool Adafruit_GPS::parseTime(char *p) {
   if (!isEmpty(p)) { // get time
-    uint32_t time = atol(p);
+    uint32_t time = 0;
+    for (; *p >= '0' && *p <= '9'; p++)
+      time = time * 10 + (*p - '0');
     hour = time / 10000;
     minute = (time % 10000) / 100;
     seconds = (time % 100);
-    char *dec = strchr(p, '.');
-    char *comstar = min(strchr(p, ','), strchr(p, '*'));
-    if (dec != NULL && comstar != NULL && dec < comstar)
-      milliseconds = atof(dec) * 1000;
-    else
-      milliseconds = 0;
+    milliseconds = 0;
+    if (*p == '.') { // up to three decimal places, as milliseconds
+      uint16_t scale = 100;
+      for (p++; *p >= '0' && *p <= '9' && scale; p++) {
+        milliseconds += (*p - '0') * scale;
+        scale /= 10;
+      }
+    }
     lastTime = sentTime;
     return true;
   }
@@ -854,6 +933,65 @@ bool Adafruit_GPS::isEmpty(char *pStart) {
     return true;
 }
 
+/**************************************************************************/
+/*!
+    @brief Parse an integer field, in place of atol(). Stops at the first
+    character that isn't a digit, so it works directly on a field in the
+    middle of a sentence.
+    @param p Pointer to the location of the token in the NMEA string
+    @return The value, 0 if there are no digits
+*/
+/**************************************************************************/
+int32_t Adafruit_GPS::parseInteger(const char *p) {
+  bool neg = (*p == '-');
+  if (neg || *p == '+')
+    p++;
+  int32_t v = 0;
+  for (; *p >= '0' && *p <= '9'; p++)
+    v = v * 10 + (*p - '0');
+  return neg ? -v : v;
+}
+
+/**************************************************************************/
+/*!
+    @brief Parse a decimal field, in place of atof(). The digits are
+    collected as one integer and scaled by a single division at the end,
+    which is much faster than atof() and as precise as nmea_float_t for the
+    up to nine significant digits NMEA fields carry. No exponents.
+    @param p Pointer to the location of the token in the NMEA string
+    @return The value, 0 if there are no digits
+*/
+/**************************************************************************/
+nmea_float_t Adafruit_GPS::parseDecimal(const char *p) {
+  static const nmea_float_t pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4,
+                                       1e5, 1e6, 1e7, 1e8, 1e9};
+  bool neg = (*p == '-');
+  if (neg || *p == '+')
+    p++;
+  uint32_t m = 0;      // significant digits
+  int8_t exponent = 0; // power of ten to apply to m
+  for (; *p >= '0' && *p <= '9'; p++) {
+    if (m < 100000000UL)
+      m = m * 10 + (*p - '0');
+    else
+      exponent++; // integer digits beyond what m holds
+  }
+  if (*p == '.') {
+    for (p++; *p >= '0' && *p <= '9'; p++) {
+      if (m < 100000000UL && exponent > -9) {
+        m = m * 10 + (*p - '0');
+        exponent--;
+      } // else ignore digits that make no difference
+    }
+  }
+  nmea_float_t v = m;
+  if (exponent < 0)
+    v /= pow10[-exponent];
+  else if (exponent > 0)
+    v *= pow10[exponent < 9 ? exponent : 9];
+  return neg ? -v : v;
+}
+
 /**************************************************************************/
 /*!
     @brief Parse a hex character and return the appropriate decimal value
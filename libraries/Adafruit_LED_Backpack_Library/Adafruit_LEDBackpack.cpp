@@ -294,6 +294,8 @@ bool Adafruit_LEDBackpack::begin(uint8_t _addr, TwoWire *theWire) {
   i2c_dev = new Adafruit_I2CDevice(_addr, theWire);
   if (!i2c_dev->begin())
     return false;
+  shadowValid = false;
+  savedBytes = 0;
 
   // turn on oscillator
   uint8_t buffer[1] = {0x21};
@@ -316,14 +318,35 @@ bool Adafruit_LEDBackpack::begin(uint8_t _addr, TwoWire *theWire) {
 void Adafruit_LEDBackpack::writeDisplay(void) {
   uint8_t buffer[17];
 
-  buffer[0] = 0x00; // start at address $00
-
   for (uint8_t i = 0; i < 8; i++) {
     buffer[1 + 2 * i] = displaybuffer[i] & 0xFF;
     buffer[2 + 2 * i] = displaybuffer[i] >> 8;
   }
 
-  i2c_dev->write(buffer, 17);
+  // Find the first and last display RAM bytes that changed since the
+  // last write; the HT16K33 auto-increments, so one write covers them.
+  uint8_t first = 0, last = 15;
+  if (shadowValid) {
+    while ((first < 16) && (buffer[1 + first] == shadowbuffer[first]))
+      first++;
+    if (first == 16) { // Nothing changed
+      savedBytes += sizeof(buffer);
+      return;
+    }
+    while (buffer[1 + last] == shadowbuffer[last])
+      last--;
+  }
+
+  buffer[first] = first; // start at address of first changed byte
+  uint8_t len = last - first + 2;
+  if (!i2c_dev->write(&buffer[first], len)) {
+    shadowValid = false; // Unknown state, resend everything next time
+    return;
+  }
+  savedBytes += sizeof(buffer) - len;
+
+  memcpy(&shadowbuffer[first], &buffer[first + 1], len - 1);
+  shadowValid = true;
 }
 
 void Adafruit_LEDBackpack::clear(void) {
@@ -332,6 +355,32 @@ void Adafruit_LEDBackpack::clear(void) {
   }
 }
 
+/******************************* BACKPACK GROUP OBJECT */
+
+bool Adafruit_LEDBackpackGroup::add(Adafruit_LEDBackpack *backpack) {
+  if (count >= LEDBACKPACK_GROUP_MAX)
+    return false;
+  backpacks[count++] = backpack;
+  return true;
+}
+
+void Adafruit_LEDBackpackGroup::writeDisplay(void) {
+  for (uint8_t i = 0; i < count; i++)
+    backpacks[i]->writeDisplay();
+}
+
+void Adafruit_LEDBackpackGroup::invalidateDisplay(void) {
+  for (uint8_t i = 0; i < count; i++)
+    backpacks[i]->invalidateDisplay();
+}
+
+uint32_t Adafruit_LEDBackpackGroup::bytesSaved(void) const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < count; i++)
+    total += backpacks[i]->bytesSaved();
+  return total;
+}
+
 /******************************* QUAD ALPHANUM OBJECT */
 
 Adafruit_AlphaNum4::Adafruit_AlphaNum4(void) {}
@@ -699,7 +748,13 @@ void Adafruit_7segment::writeColon(void) {
   buffer[1] = displaybuffer[2] & 0xFF;
   buffer[2] = displaybuffer[2] >> 8;
 
-  i2c_dev->write(buffer, 3);
+  // Keep writeDisplay()'s copy of display RAM in step
+  if (!i2c_dev->write(buffer, 3)) {
+    shadowValid = false;
+    return;
+  }
+  shadowbuffer[4] = buffer[1];
+  shadowbuffer[5] = buffer[2];
 }
 
 void Adafruit_7segment::writeDigitNum(uint8_t d, uint8_t num, bool dot) {
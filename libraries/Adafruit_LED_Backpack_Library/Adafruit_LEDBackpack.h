@@ -128,10 +128,25 @@ public:
   void blinkRate(uint8_t b);
 
   /*!
-    @brief  Issue buffered data in RAM to display.
+    @brief  Issue buffered data in RAM to display. Only the contiguous
+            range of display RAM that differs from what was last sent is
+            transmitted; nothing is sent if the buffer is unchanged.
   */
   void writeDisplay(void);
 
+  /*!
+    @brief  Forget what was last sent, so the next writeDisplay() sends all
+            16 bytes of display RAM (e.g. after the backpack lost power).
+  */
+  void invalidateDisplay(void) { shadowValid = false; }
+
+  /*!
+    @brief  Running total of I2C bytes writeDisplay() avoided sending,
+            compared with rewriting all of display RAM every time.
+    @return  Bytes saved since begin().
+  */
+  uint32_t bytesSaved(void) const { return savedBytes; }
+
   /*!
     @brief  Clear display.
   */
@@ -141,6 +156,54 @@ public:
 
 protected:
   Adafruit_I2CDevice *i2c_dev = NULL; ///< Pointer to I2C bus interface
+  uint8_t shadowbuffer[16];           ///< Display RAM as last transmitted
+  bool shadowValid = false;           ///< shadowbuffer matches the device
+  uint32_t savedBytes = 0;            ///< Bytes not sent thanks to shadow
+};
+
+#ifndef LEDBACKPACK_GROUP_MAX
+#define LEDBACKPACK_GROUP_MAX 8 ///< Backpacks per Adafruit_LEDBackpackGroup
+#endif
+
+/*!
+    @brief  Updates several backpacks (any mix of matrices, 7-segment and
+            alphanumeric displays, usually sharing one I2C bus) in a single
+            pass, each sending only its changed display RAM.
+*/
+class Adafruit_LEDBackpackGroup {
+public:
+  /*!
+    @brief  Constructor for an empty group.
+  */
+  Adafruit_LEDBackpackGroup(void) : count(0) {}
+
+  /*!
+    @brief  Add a backpack to the group. It must already be begin()'d.
+    @param  backpack  Display to add.
+    @return  true if added, false if the group is full.
+  */
+  bool add(Adafruit_LEDBackpack *backpack);
+
+  /*!
+    @brief  writeDisplay() every backpack in the group, in the order added.
+  */
+  void writeDisplay(void);
+
+  /*!
+    @brief  Make the next writeDisplay() resend all display RAM of every
+            backpack in the group.
+  */
+  void invalidateDisplay(void);
+
+  /*!
+    @brief  Total I2C bytes saved by change detection across the group.
+    @return  Sum of bytesSaved() for every backpack.
+  */
+  uint32_t bytesSaved(void) const;
+
+private:
+  Adafruit_LEDBackpack *backpacks[LEDBACKPACK_GROUP_MAX];
+  uint8_t count;
 };
 
 /*!
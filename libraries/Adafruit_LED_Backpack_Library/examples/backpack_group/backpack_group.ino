@@ -0,0 +1,51 @@
+/***************************************************
+  Drives a sign made of several backpacks on one I2C bus -- here two
+  quad alphanumeric displays and a 7-segment clock display -- through an
+  Adafruit_LEDBackpackGroup.
+
+  writeDisplay() only sends the part of each backpack's display RAM that
+  changed since the last update, so a ticking counter touches one or two
+  digits instead of rewriting all 17 bytes on every display. The sketch
+  prints how many I2C bytes that saved.
+
+  Set the address jumpers so each backpack has its own address.
+ ****************************************************/
+
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include "Adafruit_LEDBackpack.h"
+
+Adafruit_AlphaNum4 left = Adafruit_AlphaNum4();
+Adafruit_AlphaNum4 right = Adafruit_AlphaNum4();
+Adafruit_7segment digits = Adafruit_7segment();
+Adafruit_LEDBackpackGroup sign;
+
+uint32_t count = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  left.begin(0x70);
+  right.begin(0x71);
+  digits.begin(0x72);
+  sign.add(&left);
+  sign.add(&right);
+  sign.add(&digits);
+
+  const char *title = "COUNTING";
+  for (uint8_t i = 0; i < 4; i++) {
+    left.writeDigitAscii(i, title[i]);
+    right.writeDigitAscii(i, title[i + 4]);
+  }
+}
+
+void loop() {
+  digits.print(count % 10000);
+  sign.writeDisplay(); // Title is unchanged, so only the digits are sent
+
+  if ((++count % 100) == 0) {
+    Serial.print(F("I2C bytes saved so far: "));
+    Serial.println(sign.bytesSaved());
+  }
+  delay(10);
+}
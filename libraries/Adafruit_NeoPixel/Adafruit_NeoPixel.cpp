@@ -82,7 +82,10 @@
   @return  Adafruit_NeoPixel object. Call the begin() function before use.
 */
 Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
-    : begun(false), brightness(0), pixels(NULL), endTime(0) {
+    : begun(false), brightness(0), pixels(NULL), endTime(0), lut(NULL),
+      outBuf(NULL), lutCount(0), lutBrightness(255), lutGamma(false),
+      lutDirty(false) {
+  memset(balance, 255, sizeof(balance));
   updateType(t);
   updateLength(n);
   setPin(p);
@@ -119,7 +122,10 @@ Adafruit_NeoPixel::Adafruit_NeoPixel()
       is800KHz(true),
 #endif
       begun(false), numLEDs(0), numBytes(0), pin(-1), brightness(0),
-      pixels(NULL), rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0) {
+      pixels(NULL), rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0),
+      lut(NULL), outBuf(NULL), lutCount(0), lutBrightness(255),
+      lutGamma(false), lutDirty(false) {
+  memset(balance, 255, sizeof(balance));
 }
 
 /*!
@@ -134,6 +140,8 @@ Adafruit_NeoPixel::~Adafruit_NeoPixel() {
   show();
 #endif
   free(pixels);
+  free(outBuf);
+  free(lut);
   if (pin >= 0)
     pinMode(pin, INPUT);
 }
@@ -161,6 +169,8 @@ void Adafruit_NeoPixel::begin(void) {
 */
 void Adafruit_NeoPixel::updateLength(uint16_t n) {
   free(pixels); // Free existing data (if any)
+  free(outBuf); // Output copy is reallocated by show() if needed
+  outBuf = NULL;
 
   // Allocate new data -- note: ALL PIXELS ARE CLEARED
   numBytes = n * ((wOffset == rOffset) ? 3 : 4);
@@ -200,6 +210,8 @@ void Adafruit_NeoPixel::updateType(neoPixelType t) {
   is800KHz = (t < 256); // 400 KHz flag is 1<<8
 #endif
 
+  lutDirty = true; // Channel count/order may differ; rebuild tables
+
   // If bytes-per-pixel has changed (and pixel data was previously
   // allocated), re-allocate to new size. Will clear any data.
   if (pixels) {
@@ -236,6 +248,20 @@ void  Adafruit_NeoPixel::rp2040Show(uint8_t pin, uint8_t *pixels, uint32_t numBy
     this->init = false;
   }
 
+  if (lut) {
+    // Output tables are applied here rather than in a copy of the buffer;
+    // pio_sm_put_blocking() spends most of its time waiting on the FIFO,
+    // so the extra lookup per byte is free.
+    const uint8_t *t[4];
+    lutTables(t);
+    uint8_t bpp = (wOffset == rOffset) ? 3 : 4, i = 0;
+    while(numBytes--) {
+      pio_sm_put_blocking(pio, sm, ((uint32_t)t[i][*pixels++]) << 24);
+      if (++i >= bpp) i = 0;
+    }
+    return;
+  }
+
   while(numBytes--)
     // Bits for transmission must be shifted to top 8 bits
     pio_sm_put_blocking(pio, sm, ((uint32_t)*pixels++)<< 24);
@@ -432,6 +458,44 @@ void Adafruit_NeoPixel::show(void) {
   if (!pixels)
     return;
 
+  // With output tables active, brightness, gamma and color balance are
+  // applied here so the pixel data in RAM stays at full precision. The
+  // bit-bang loops below have no spare cycles for a table lookup per byte,
+  // so most architectures get a translated copy of the buffer, built while
+  // the previous latch interval is still running. RP2040 does the lookup
+  // inline in rp2040Show() instead.
+  uint8_t *src = pixels;
+  if (lut && numBytes) {
+    if (lutDirty && !buildLUT())
+      return;
+#if !defined(ARDUINO_ARCH_RP2040)
+    if (!outBuf && numBytes && !(outBuf = (uint8_t *)malloc(numBytes)))
+      return; // Skip frame rather than send it at full brightness
+    const uint8_t *t[4];
+    lutTables(t);
+    uint8_t *in = src, *out = outBuf, *end = src + numBytes;
+    if (wOffset == rOffset) {
+      while (in < end) {
+        out[0] = t[0][in[0]];
+        out[1] = t[1][in[1]];
+        out[2] = t[2][in[2]];
+        in += 3;
+        out += 3;
+      }
+    } else {
+      while (in < end) {
+        out[0] = t[0][in[0]];
+        out[1] = t[1][in[1]];
+        out[2] = t[2][in[2]];
+        out[3] = t[3][in[3]];
+        in += 4;
+        out += 4;
+      }
+    }
+    pixels = outBuf; // Restored after the data is issued
+#endif
+  }
+
   // Data latch = 300+ microsecond pause in the output stream. Rather than
   // put a delay at the end of the function, the ending time is noted and
   // the function will simply hold off (if needed) on issuing the
@@ -3333,6 +3397,7 @@ if(is800KHz) {
   interrupts();
 #endif
 
+  pixels = src;
   endTime = micros(); // Save EOD time for latch on next call
 }
 
@@ -3488,8 +3553,53 @@ void Adafruit_NeoPixel::fill(uint32_t c, uint16_t first, uint16_t count) {
       end = numLEDs;
   }
 
-  for (i = first; i < end; i++) {
-    this->setPixelColor(i, c);
+  // Set the first pixel (color order, brightness), then replicate its
+  // bytes, doubling the copied span each pass.
+  this->setPixelColor(first, c);
+  uint8_t bpp = (wOffset == rOffset) ? 3 : 4;
+  uint8_t *p = &pixels[first * bpp];
+  uint16_t done = bpp, total = (end - first) * bpp;
+  while (done < total) {
+    i = (done < total - done) ? done : total - done;
+    memcpy(&p[done], p, i);
+    done += i;
+  }
+}
+
+// Not a user API. Map a hexcone hue 0-1530 (see ColorHSV()) to fully
+// saturated R,G,B. Nested ifs are faster than divide+mod+switch.
+static inline void hexcone(uint16_t hue, uint8_t &r, uint8_t &g,
+                           uint8_t &b) {
+  if (hue < 510) { // Red to Green-1
+    b = 0;
+    if (hue < 255) { //   Red to Yellow-1
+      r = 255;
+      g = hue;       //     g = 0 to 254
+    } else {         //   Yellow to Green-1
+      r = 510 - hue; //     r = 255 to 1
+      g = 255;
+    }
+  } else if (hue < 1020) { // Green to Blue-1
+    r = 0;
+    if (hue < 765) { //   Green to Cyan-1
+      g = 255;
+      b = hue - 510;  //     b = 0 to 254
+    } else {          //   Cyan to Blue-1
+      g = 1020 - hue; //     g = 255 to 1
+      b = 255;
+    }
+  } else if (hue < 1530) { // Blue to Red-1
+    g = 0;
+    if (hue < 1275) { //   Blue to Magenta-1
+      r = hue - 1020; //     r = 0 to 254
+      b = 255;
+    } else { //   Magenta to Red-1
+      r = 255;
+      b = 1530 - hue; //     b = 255 to 1
+    }
+  } else { // Last 0.5 Red (quicker than % operator)
+    r = 255;
+    g = b = 0;
   }
 }
 
@@ -3550,38 +3660,7 @@ uint32_t Adafruit_NeoPixel::ColorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
   // and so forth. Hence, 1530 distinct hues (0 to 1529), and hence why
   // the constants below are not the multiples of 256 you might expect.
 
-  // Convert hue to R,G,B (nested ifs faster than divide+mod+switch):
-  if (hue < 510) { // Red to Green-1
-    b = 0;
-    if (hue < 255) { //   Red to Yellow-1
-      r = 255;
-      g = hue;       //     g = 0 to 254
-    } else {         //   Yellow to Green-1
-      r = 510 - hue; //     r = 255 to 1
-      g = 255;
-    }
-  } else if (hue < 1020) { // Green to Blue-1
-    r = 0;
-    if (hue < 765) { //   Green to Cyan-1
-      g = 255;
-      b = hue - 510;  //     b = 0 to 254
-    } else {          //   Cyan to Blue-1
-      g = 1020 - hue; //     g = 255 to 1
-      b = 255;
-    }
-  } else if (hue < 1530) { // Blue to Red-1
-    g = 0;
-    if (hue < 1275) { //   Blue to Magenta-1
-      r = hue - 1020; //     r = 0 to 254
-      b = 255;
-    } else { //   Magenta to Red-1
-      r = 255;
-      b = 1530 - hue; //     b = 255 to 1
-    }
-  } else { // Last 0.5 Red (quicker than % operator)
-    r = 255;
-    g = b = 0;
-  }
+  hexcone(hue, r, g, b);
 
   // Apply saturation and value to R,G,B, pack into 32-bit result:
   uint32_t v1 = 1 + val;  // 1 to 256; allows >>8 instead of /255
@@ -3653,8 +3732,16 @@ uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
            problem. Smart programs therefore treat the strip as a
            write-only resource, maintaining their own state to render each
            frame of an animation, not relying on read-modify-write.
+           For lossless brightness changes, see setOutputLUT().
 */
 void Adafruit_NeoPixel::setBrightness(uint8_t b) {
+  if (lut) { // Output tables active -- pixel data is left untouched
+    if (b != lutBrightness) {
+      lutBrightness = b;
+      lutDirty = true; // Rebuilt once, on the next show()
+    }
+    return;
+  }
   // Stored brightness value is different than what's passed.
   // This simplifies the actual scaling math later, allowing a fast
   // 8x8-bit multiply and taking the MSB. 'brightness' is a uint8_t,
@@ -3694,7 +3781,136 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
   @brief   Retrieve the last-set brightness value for the strip.
   @return  Brightness value: 0 = minimum (off), 255 = maximum.
 */
-uint8_t Adafruit_NeoPixel::getBrightness(void) const { return brightness - 1; }
+uint8_t Adafruit_NeoPixel::getBrightness(void) const {
+  return lut ? lutBrightness : brightness - 1;
+}
+
+/*!
+  @brief   Switch between the default "premultiplied" brightness handling
+           and non-destructive output tables applied at show() time.
+  @param   enable  true to keep pixel data at full precision and apply
+                   brightness (plus optional gamma and color balance)
+                   through per-channel 256-byte lookup tables as data is
+                   issued, false to return to the default behavior.
+  @return  true on success, false if there wasn't enough RAM for the
+           tables (the strip is left in the default mode).
+  @note    With tables active, setBrightness() no longer rewrites the
+           pixel buffer and getPixelColor() returns exactly what was set,
+           so a fade costs one table rebuild per show() rather than a pass
+           over every pixel. The price is RAM: up to 1 KB of tables plus,
+           on most architectures, a second copy of the pixel buffer that
+           show() translates into (allocated on first use). Best called
+           once in setup(); any data already in RAM is rescaled to full
+           brightness, which is as lossy as setBrightness() always was.
+*/
+bool Adafruit_NeoPixel::setOutputLUT(bool enable) {
+  if (enable == (lut != NULL))
+    return true;
+  if (enable) {
+    uint8_t b = getBrightness();
+    setBrightness(255); // Undo premultiply; 'brightness' is now 0 (= none)
+    lutBrightness = b;
+    if (!buildLUT()) {
+      setBrightness(b);
+      return false;
+    }
+  } else {
+    uint8_t b = lutBrightness;
+    free(lut);
+    free(outBuf);
+    lut = outBuf = NULL;
+    lutCount = 0;
+    setBrightness(b); // Premultiply into RAM as before
+  }
+  return true;
+}
+
+/*!
+  @brief   Enable or disable gamma correction at show() time. Uses the
+           same curve as gamma8(), applied after brightness scaling so
+           fades look even across the whole range.
+  @param   enable  true to gamma-correct output, false for linear output.
+  @note    Only has an effect while output tables are active
+           (see setOutputLUT()).
+*/
+void Adafruit_NeoPixel::setGamma(bool enable) {
+  if (enable != lutGamma) {
+    lutGamma = enable;
+    lutDirty = true;
+  }
+}
+
+/*!
+  @brief   Set a per-channel output scale, e.g. to correct the white
+           point of a particular batch of LEDs. Applied after brightness
+           and gamma.
+  @param   r  Red scale, 0-255 (255 = unchanged).
+  @param   g  Green scale, 0-255.
+  @param   b  Blue scale, 0-255.
+  @param   w  White scale, 0-255 (ignored on RGB strips).
+  @note    Only has an effect while output tables are active
+           (see setOutputLUT()). Equal scales share a single table;
+           unequal ones take one 256-byte table per channel.
+*/
+void Adafruit_NeoPixel::setColorBalance(uint8_t r, uint8_t g, uint8_t b,
+                                        uint8_t w) {
+  if ((r != balance[0]) || (g != balance[1]) || (b != balance[2]) ||
+      (w != balance[3])) {
+    balance[0] = r;
+    balance[1] = g;
+    balance[2] = b;
+    balance[3] = w;
+    lutDirty = true;
+  }
+}
+
+// Not a user API. (Re)compute the output tables for the current
+// brightness, gamma and color balance. One table is shared by all
+// channels when the balance is neutral, otherwise each of R,G,B(,W) gets
+// its own, stored in that order.
+bool Adafruit_NeoPixel::buildLUT(void) {
+  uint8_t bpp = (wOffset == rOffset) ? 3 : 4, n = 1;
+  for (uint8_t c = 1; c < bpp; c++) {
+    if (balance[c] != balance[0])
+      n = bpp;
+  }
+  if (n != lutCount) {
+    uint8_t *t = (uint8_t *)realloc(lut, n * 256);
+    if (!t)
+      return false;
+    lut = t;
+    lutCount = n;
+  }
+  uint16_t scale = (uint16_t)lutBrightness + 1;
+  for (uint8_t c = 0; c < n; c++) {
+    uint8_t *t = &lut[c * 256];
+    uint16_t bal = (uint16_t)balance[c] + 1;
+    for (uint16_t i = 0; i < 256; i++) {
+      uint8_t v = (i * scale) >> 8;
+      if (lutGamma)
+        v = gamma8(v);
+      t[i] = (v * bal) >> 8;
+    }
+  }
+  lutDirty = false;
+  return true;
+}
+
+// Not a user API. Get the output table for each byte position within a
+// pixel, following the strip's native color order.
+void Adafruit_NeoPixel::lutTables(const uint8_t *t[4]) const {
+  if (lutCount == 1) {
+    t[0] = t[1] = t[2] = t[3] = lut;
+  } else {
+    t[rOffset] = &lut[0];
+    t[gOffset] = &lut[256];
+    t[bOffset] = &lut[512];
+    if (wOffset != rOffset)
+      t[wOffset] = &lut[768];
+    else
+      t[3] = lut; // Unused on RGB strips
+  }
+}
 
 /*!
   @brief   Fill the whole NeoPixel strip with 0 / black / off.
@@ -3738,11 +3954,191 @@ uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
 */
 void Adafruit_NeoPixel::rainbow(uint16_t first_hue, int8_t reps,
   uint8_t saturation, uint8_t brightness, bool gammify) {
-  for (uint16_t i=0; i<numLEDs; i++) {
-    uint16_t hue = first_hue + (i * reps * 65536) / numLEDs;
-    uint32_t color = ColorHSV(hue, saturation, brightness);
-    if (gammify) color = gamma32(color);
-    setPixelColor(i, color);
+  if (!numLEDs) return;
+  fillHSV(first_hue, ((int32_t)reps << 24) / numLEDs, 0, 0, saturation,
+          brightness, gammify);
+}
+
+/*!
+  @brief   Fill a range of pixels with a hue gradient. Equivalent to
+           calling ColorHSV(), optionally gamma32(), and setPixelColor()
+           for each pixel, but the hue is stepped incrementally in fixed
+           point, so there's no per-pixel 32-bit multiply or divide.
+  @param   first_hue  Hue of the first pixel, 0-65535 (see ColorHSV()).
+  @param   hue_step   Hue change from one pixel to the next, in 1/256ths
+                      of a ColorHSV() hue unit (so 256 = +1 hue, 65536 * 256
+                      = one full cycle of the wheel). Negative values run
+                      the other way around the wheel.
+  @param   first      Index of first pixel to fill, starting from 0.
+  @param   count      Number of pixels to fill, as a positive value.
+                      Passing 0 or leaving unspecified will fill to end
+                      of strip.
+  @param   sat        Saturation, 0-255 = gray to pure hue, default 255.
+  @param   val        Value, 0-255 = off to max, default 255. Applied in
+                      combination with the global strip brightness.
+  @param   gammify    If true (default), apply gamma correction to colors.
+*/
+void Adafruit_NeoPixel::fillHSV(uint16_t first_hue, int32_t hue_step,
+                                uint16_t first, uint16_t count, uint8_t sat,
+                                uint8_t val, bool gammify) {
+  if (first >= numLEDs)
+    return;
+  uint16_t end = ((count == 0) || (count > numLEDs - first)) ? numLEDs
+                                                             : first + count;
+
+  // Hue is tracked directly in ColorHSV()'s 0-1529 hexcone space, 16.16
+  // fixed point, so each pixel is a 32-bit add and compare. 1/256 hue step
+  // converts to 1530/256 hexcone (16.16) units; reduce it to one turn of
+  // the wheel first so the product fits in 32 bits.
+  const uint32_t wheel = 1530UL << 16;
+  uint32_t s = (uint32_t)hue_step & 0xFFFFFF; // 1 << 24 = full turn
+  uint32_t step = (s >> 8) * 1530 + (((s & 0xFF) * 1530) >> 8);
+  uint32_t acc = (uint32_t)first_hue * 1530;
+
+  uint16_t s1 = 1 + sat;  // Same saturation/value math as ColorHSV()
+  uint8_t s2 = 255 - sat;
+  uint16_t v1 = 1 + val;
+  uint8_t bpp = (wOffset == rOffset) ? 3 : 4, r, g, b;
+  uint8_t *p = &pixels[first * bpp];
+
+  for (uint16_t i = first; i < end; i++, p += bpp) {
+    hexcone((acc + 32768) >> 16, r, g, b); // +0.5 rounds like ColorHSV()
+    r = ((((r * s1) >> 8) + s2) * v1) >> 8;
+    g = ((((g * s1) >> 8) + s2) * v1) >> 8;
+    b = ((((b * s1) >> 8) + s2) * v1) >> 8;
+    if (gammify) {
+      r = gamma8(r);
+      g = gamma8(g);
+      b = gamma8(b);
+    }
+    if (brightness) { // See notes in setBrightness()
+      r = (r * brightness) >> 8;
+      g = (g * brightness) >> 8;
+      b = (b * brightness) >> 8;
+    }
+    if (bpp == 4)
+      p[wOffset] = 0;
+    p[rOffset] = r;
+    p[gOffset] = g;
+    p[bOffset] = b;
+    if ((acc += step) >= wheel)
+      acc -= wheel;
+  }
+}
+
+/*!
+  @brief   Set a run of pixels from an array of 'packed' 32-bit RGB or
+           WRGB values, as accepted by setPixelColor(). Color order and
+           brightness are handled on whole 32-bit words where possible
+           rather than byte by byte.
+  @param   colors  Array of packed colors (white in the most significant
+                   byte, ignored on RGB strips).
+  @param   count   Number of colors in array.
+  @param   first   Index of pixel to receive colors[0], default 0. Colors
+                   that would land past the end of the strip are ignored.
+*/
+void Adafruit_NeoPixel::setPixelColors(const uint32_t *colors,
+                                       uint16_t count, uint16_t first) {
+  if (first >= numLEDs)
+    return;
+  if (count > numLEDs - first)
+    count = numLEDs - first;
+
+  uint16_t scale = brightness;
+  if (wOffset == rOffset) { // RGB-type strip
+    uint8_t *p = &pixels[first * 3];
+    while (count--) {
+      uint32_t c = *colors++;
+      if (scale) { // Two channels per multiply; products can't overlap
+        c = ((((c & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF) |
+            ((((c >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00);
+      }
+      p[rOffset] = c >> 16;
+      p[gOffset] = c >> 8;
+      p[bOffset] = c;
+      p += 3;
+    }
+  } else { // WRGB-type strip
+    uint8_t *p = &pixels[first * 4];
+    // Common orders are one shift-and-mask swizzle from WRGB to the byte
+    // order in RAM (little-endian); the rest go byte by byte.
+    uint8_t order = (wOffset << 6) | (rOffset << 4) | (gOffset << 2) | bOffset;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    bool fast = (order == NEO_GRBW) || (order == NEO_RGBW);
+#else
+    bool fast = false;
+#endif
+    while (count--) {
+      uint32_t c = *colors++;
+      if (scale) {
+        c = ((((c & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF) |
+            ((((c >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00);
+      }
+      if (fast) {
+        if (order == NEO_GRBW) // RAM: G,R,B,W
+          c = (c & 0xFF000000) | ((c & 0xFF) << 16) | ((c >> 8) & 0xFFFF);
+        else // NEO_RGBW, RAM: R,G,B,W
+          c = (c & 0xFF00FF00) | ((c & 0xFF) << 16) | ((c >> 16) & 0xFF);
+        memcpy(p, &c, 4);
+      } else {
+        p[wOffset] = c >> 24;
+        p[rOffset] = c >> 16;
+        p[gOffset] = c >> 8;
+        p[bOffset] = c;
+      }
+      p += 4;
+    }
+  }
+}
+
+/*!
+  @brief   Copy a run of pixels to another position on the same strip.
+           Source and destination may overlap (e.g. for scrolling).
+  @param   dst    Index of first destination pixel.
+  @param   src    Index of first source pixel.
+  @param   count  Number of pixels to copy. Clipped to the strip.
+  @note    Pixel data is copied as stored, brightness included, so this
+           is exact and much faster than getPixelColor()/setPixelColor().
+*/
+void Adafruit_NeoPixel::copyPixels(uint16_t dst, uint16_t src,
+                                   uint16_t count) {
+  if ((dst >= numLEDs) || (src >= numLEDs))
+    return;
+  if (count > numLEDs - dst)
+    count = numLEDs - dst;
+  if (count > numLEDs - src)
+    count = numLEDs - src;
+  uint8_t bpp = (wOffset == rOffset) ? 3 : 4;
+  memmove(&pixels[dst * bpp], &pixels[src * bpp], count * bpp);
+}
+
+/*!
+  @brief   Cross-fade a run of pixels toward another run on the same strip.
+           Each channel of dst becomes dst + (src - dst) * amount / 255.
+  @param   dst     Index of first pixel to modify.
+  @param   src     Index of first pixel to blend toward. Ranges may
+                   overlap; the result is as if src were copied first.
+  @param   count   Number of pixels. Clipped to the strip.
+  @param   amount  0 = leave dst unchanged, 255 = copy src exactly.
+*/
+void Adafruit_NeoPixel::blendPixels(uint16_t dst, uint16_t src,
+                                    uint16_t count, uint8_t amount) {
+  if ((dst >= numLEDs) || (src >= numLEDs))
+    return;
+  if (count > numLEDs - dst)
+    count = numLEDs - dst;
+  if (count > numLEDs - src)
+    count = numLEDs - src;
+  uint8_t bpp = (wOffset == rOffset) ? 3 : 4;
+  uint16_t n = count * bpp;
+  uint16_t a = amount + (amount >> 7), ia = 256 - a; // 0-256, 255 -> 256
+  uint8_t *d = &pixels[dst * bpp], *s = &pixels[src * bpp];
+  if (d <= s) { // Forward, like memmove(), so overlap reads unmodified src
+    for (uint16_t i = 0; i < n; i++)
+      d[i] = (d[i] * ia + s[i] * a) >> 8;
+  } else {
+    for (uint16_t i = n; i--;)
+      d[i] = (d[i] * ia + s[i] * a) >> 8;
   }
 }
 
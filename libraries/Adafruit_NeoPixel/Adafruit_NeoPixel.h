@@ -241,6 +241,16 @@ public:
   void clear(void);
   void updateLength(uint16_t n);
   void updateType(neoPixelType t);
+  bool setOutputLUT(bool enable);
+  void setGamma(bool enable);
+  void setColorBalance(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 255);
+  /*!
+    @brief   Check whether non-destructive brightness/gamma output tables
+             are active (see setOutputLUT()).
+    @return  true if brightness, gamma and color balance are applied at
+             show() time, false if brightness is premultiplied into RAM.
+  */
+  bool getOutputLUT(void) const { return lut != NULL; }
   /*!
     @brief   Check whether a call to show() will start sending data
              immediately or will 'block' for a required interval. NeoPixels
@@ -379,10 +389,23 @@ public:
   void rainbow(uint16_t first_hue = 0, int8_t reps = 1,
                uint8_t saturation = 255, uint8_t brightness = 255,
                bool gammify = true);
+  void fillHSV(uint16_t first_hue, int32_t hue_step, uint16_t first = 0,
+               uint16_t count = 0, uint8_t sat = 255, uint8_t val = 255,
+               bool gammify = true);
+  void setPixelColors(const uint32_t *colors, uint16_t count,
+                      uint16_t first = 0);
+  void copyPixels(uint16_t dst, uint16_t src, uint16_t count);
+  void blendPixels(uint16_t dst, uint16_t src, uint16_t count,
+                   uint8_t amount);
 
   static neoPixelType str2order(const char *v);
 
 private:
+  friend class Adafruit_NeoPixel_Parallel; // Reads pixels & output tables
+  template <class FileT>
+  friend class Adafruit_NeoPixel_Player; // Decodes frames into pixels
+  bool buildLUT(void);
+  void lutTables(const uint8_t *t[4]) const;
 #if defined(ARDUINO_ARCH_RP2040)
   void  rp2040Init(uint8_t pin, bool is800KHz);
   void  rp2040Show(uint8_t pin, uint8_t *pixels, uint32_t numBytes, bool is800KHz);
@@ -403,6 +426,13 @@ protected:
   uint8_t bOffset;    ///< Index of blue byte
   uint8_t wOffset;    ///< Index of white (==rOffset if no white)
   uint32_t endTime;   ///< Latch timing reference
+  uint8_t *lut;       ///< Output tables (NULL = legacy premultiply mode)
+  uint8_t *outBuf;    ///< Encoded copy of 'pixels' sent by show()
+  uint8_t lutCount;   ///< Number of 256-byte tables in 'lut'
+  uint8_t lutBrightness; ///< Brightness 0-255 while output tables active
+  uint8_t balance[4]; ///< Per-channel R,G,B,W output scale, 255 = unity
+  bool lutGamma;      ///< true if gamma8() is applied by output tables
+  bool lutDirty;      ///< true if 'lut' must be rebuilt before next show()
 #ifdef __AVR__
   volatile uint8_t *port; ///< Output PORT register
   uint8_t pinMask;        ///< Output PORT bitmask
@@ -0,0 +1,206 @@
+/*!
+ * @file Adafruit_NeoPixel_AnimFormat.h
+ *
+ * Streaming decoder for NeoPixel animation files (.npxa), as written by
+ * extras/npxanim/npxanim.py and played by Adafruit_NeoPixel_Player. This
+ * part has no Arduino dependencies so it can be tested on a desktop.
+ *
+ * File layout (all values little-endian):
+ *
+ *   Header, 16 bytes:
+ *     "NPXA"        magic
+ *     uint8_t       version (NEOANIM_VERSION)
+ *     uint8_t       color order, as the low byte of a NEO_* type
+ *     uint16_t      pixels per frame
+ *     uint32_t      frame count
+ *     uint32_t      frame period, microseconds
+ *
+ *   Then one record per frame: uint8_t type, uint16_t payload length,
+ *   payload. Pixel bytes are stored in the strip's native color order so
+ *   they can be decoded straight into Adafruit_NeoPixel's buffer.
+ *
+ *     'K'  keyframe: the whole frame, verbatim. The first frame is always
+ *          a keyframe.
+ *     'D'  delta: the frame XORed with the previous one, as a run of
+ *          tokens. A token byte 0x00-0x7F skips (n + 1) unchanged bytes;
+ *          0x80-0xFF is followed by ((n & 0x7F) + 1) bytes to XOR into
+ *          the frame.
+ *     'R'  repeat: same as the previous frame, no payload.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_ANIMFORMAT_H
+#define ADAFRUIT_NEOPIXEL_ANIMFORMAT_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define NEOANIM_VERSION 1      ///< File format version
+#define NEOANIM_HEADER_SIZE 16 ///< Bytes before the first frame record
+#define NEOANIM_KEYFRAME 'K'   ///< Record type: whole frame
+#define NEOANIM_DELTA 'D'      ///< Record type: XOR/run-length delta
+#define NEOANIM_REPEAT 'R'     ///< Record type: unchanged frame
+
+/*!
+    @brief  Parsed .npxa file header.
+*/
+struct NeoAnimHeader {
+  uint8_t order;       ///< Color order (low byte of NEO_* type)
+  uint16_t numPixels;  ///< Pixels per frame
+  uint32_t frameCount; ///< Number of frame records
+  uint32_t frameUs;    ///< Frame period in microseconds
+
+  /*!
+    @brief   Decode and validate a raw header.
+    @param   raw  NEOANIM_HEADER_SIZE bytes from the start of the file.
+    @return  true if the magic and version are recognized.
+  */
+  bool parse(const uint8_t *raw) {
+    if (memcmp(raw, "NPXA", 4) || (raw[4] != NEOANIM_VERSION))
+      return false;
+    order = raw[5];
+    numPixels = raw[6] | (raw[7] << 8);
+    frameCount = raw[8] | ((uint32_t)raw[9] << 8) |
+                 ((uint32_t)raw[10] << 16) | ((uint32_t)raw[11] << 24);
+    frameUs = raw[12] | ((uint32_t)raw[13] << 8) |
+              ((uint32_t)raw[14] << 16) | ((uint32_t)raw[15] << 24);
+    return numPixels && frameCount;
+  }
+  /*!
+    @brief   Bytes per pixel implied by the color order.
+    @return  3 for RGB types, 4 for RGBW types.
+  */
+  uint8_t bytesPerPixel(void) const {
+    return (((order >> 6) & 3) == ((order >> 4) & 3)) ? 3 : 4;
+  }
+};
+
+/*!
+    @brief  Applies .npxa frame records to a frame buffer, fed in chunks
+            of any size so a whole record never needs to be in RAM.
+*/
+class NeoAnimDecoder {
+public:
+  /*!
+    @brief   Set the frame buffer that records are applied to.
+    @param   buf       Frame buffer; holds the previous frame between
+                       records.
+    @param   numBytes  Frame size in bytes.
+  */
+  void begin(uint8_t *buf, uint16_t numBytes) {
+    frame = buf;
+    size = numBytes;
+    remaining = 0;
+  }
+
+  /*!
+    @brief   Start applying a record.
+    @param   recType  Record type byte.
+    @param   length   Payload length that will follow via feed().
+    @return  false if the type is unknown or the length is impossible.
+  */
+  bool start(uint8_t recType, uint16_t length) {
+    type = recType;
+    remaining = length;
+    pos = 0;
+    run = 0;
+    if (type == NEOANIM_KEYFRAME)
+      return length == size;
+    if (type == NEOANIM_REPEAT)
+      return length == 0;
+    return type == NEOANIM_DELTA;
+  }
+
+  /*!
+    @brief   Apply the next piece of the current record's payload.
+    @param   data  Payload bytes.
+    @param   n     Number of bytes, at most what the record has left.
+    @return  false if the payload is malformed (runs past the frame).
+  */
+  bool feed(const uint8_t *data, uint16_t n) {
+    if (n > remaining)
+      return false;
+    remaining -= n;
+    if (type == NEOANIM_KEYFRAME) {
+      memcpy(&frame[pos], data, n);
+      pos += n;
+      return true;
+    }
+    while (n) {
+      if (!run) { // Token byte
+        uint8_t c = *data++;
+        n--;
+        if (c & 0x80) {
+          run = (c & 0x7F) + 1;
+          if (run > size - pos)
+            return false;
+        } else {
+          if (c >= size - pos)
+            return false;
+          pos += c + 1;
+        }
+      } else { // XOR run, possibly split across feeds
+        uint16_t k = (run < n) ? run : n;
+        uint8_t *f = &frame[pos];
+        run -= k;
+        n -= k;
+        pos += k;
+        while (k--)
+          *f++ ^= *data++;
+      }
+    }
+    return true;
+  }
+
+  /*!
+    @brief   Check whether the current record has been fully applied.
+    @return  true if no payload or pending XOR run remains.
+  */
+  bool done(void) const { return !remaining && !run; }
+
+  /*!
+    @brief   Read one complete record from a file and apply it.
+    @param   file     Any object with int read(void *, size_t), e.g. an
+                      SdFat FsFile or SD File, positioned at a record.
+    @param   buf      Scratch buffer for file reads.
+    @param   bufSize  Size of buf; larger means fewer, bigger reads.
+    @return  true on success, false on a short read or bad record.
+  */
+  template <class FileT>
+  bool readRecord(FileT &file, uint8_t *buf, uint16_t bufSize) {
+    uint8_t hdr[3];
+    if ((file.read(hdr, 3) != 3) || !start(hdr[0], hdr[1] | (hdr[2] << 8)))
+      return false;
+    while (remaining) {
+      uint16_t n = (remaining < bufSize) ? remaining : bufSize;
+      if ((file.read(buf, n) != (int)n) || !feed(buf, n))
+        return false;
+    }
+    return !run;
+  }
+
+private:
+  uint8_t *frame;     // Frame being updated
+  uint16_t size;      // Frame size, bytes
+  uint16_t pos;       // Next frame byte the record applies to
+  uint16_t remaining; // Payload bytes not yet fed
+  uint8_t run;        // XOR bytes left in current token
+  uint8_t type;       // Current record type
+};
+
+#endif // ADAFRUIT_NEOPIXEL_ANIMFORMAT_H
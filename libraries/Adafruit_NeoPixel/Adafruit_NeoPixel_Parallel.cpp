@@ -0,0 +1,432 @@
+/*!
+ * @file Adafruit_NeoPixel_Parallel.cpp
+ *
+ * Parallel (port-wide) output for groups of Adafruit_NeoPixel strips.
+ * See Adafruit_NeoPixel_Parallel.h for usage notes.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Adafruit_NeoPixel_Parallel.h"
+
+#if defined(__AVR__) && (F_CPU == 16000000L)
+#define NEOPIXEL_PARALLEL_AVR ///< 16 MHz AVR port-wide output available
+#endif
+
+#if defined(ARDUINO_ARCH_RP2040)
+// Parallel WS2812 program, one bit-plane per 'out'. Lanes are the OUT pin
+// group; all go high, the ones sending 0 drop after T1, the rest after
+// T1+T2. Same 2/5/3 timing as the single-pin program in rp2040_pio.h.
+// Hand-assembled from:
+//   .wrap_target
+//       out  x, 8            ; or 16 for 9-16 lanes (autopull at 32)
+//       mov  pins, !null [1]
+//       mov  pins, x     [4]
+//       mov  pins, null  [1]
+//   .wrap
+#define ws2812_parallel_cycles_per_bit 10
+static const uint16_t ws2812_parallel_instructions[] = {
+    0x6028, //  0: out    x, 8 (bit count patched for 16 lanes)
+    0xa10b, //  1: mov    pins, !null [1]
+    0xa401, //  2: mov    pins, x     [4]
+    0xa103, //  3: mov    pins, null  [1]
+};
+#endif
+
+/*!
+  @brief   Parallel NeoPixel group constructor. Add strips with
+           addStrip(), then call begin().
+  @return  Adafruit_NeoPixel_Parallel object.
+*/
+Adafruit_NeoPixel_Parallel::Adafruit_NeoPixel_Parallel(void)
+    : count(0), lanes(8), parallel(false), endTime(0)
+#if defined(__AVR__)
+      ,
+      port(NULL), portMask(0), planes(NULL), planeBytes(0)
+#endif
+#if defined(ARDUINO_ARCH_RP2040)
+      ,
+      pio(pio0), sm(-1), offset(-1), basePin(0)
+#endif
+{
+}
+
+/*!
+  @brief   Deallocate Adafruit_NeoPixel_Parallel object. The member strips
+           themselves are not affected.
+*/
+Adafruit_NeoPixel_Parallel::~Adafruit_NeoPixel_Parallel() {
+#if defined(__AVR__)
+  free(planes);
+#endif
+#if defined(ARDUINO_ARCH_RP2040)
+  unloadProgram();
+  if (sm >= 0)
+    pio_sm_unclaim(pio, sm);
+#endif
+}
+
+/*!
+  @brief   Add a strip to the group. Strips are drawn to as usual through
+           their own setPixelColor() etc.; only show() moves to the group.
+  @param   strip  Adafruit_NeoPixel object. Lengths and color orders may
+                  differ between strips; shorter strips simply finish early.
+  @return  true on success, false if the group is full.
+*/
+bool Adafruit_NeoPixel_Parallel::addStrip(Adafruit_NeoPixel &strip) {
+  if (count >= NEOPIXEL_PARALLEL_MAX)
+    return false;
+  strips[count++] = &strip;
+  parallel = false; // begin() must re-check the pin layout
+  return true;
+}
+
+/*!
+  @brief   Configure output pins and decide whether the group can be issued
+           in parallel. Calls begin() on each member strip.
+  @return  true if show() will drive all strips at once, false if it will
+           fall back to updating them one at a time (see class notes).
+*/
+bool Adafruit_NeoPixel_Parallel::begin(void) {
+  parallel = false;
+#if defined(ARDUINO_ARCH_RP2040)
+  unloadProgram(); // Lane count may differ this time
+#endif
+  if (!count)
+    return false;
+
+  for (uint8_t k = 0; k < count; k++) {
+    strips[k]->begin();
+#ifdef NEO_KHZ400
+    if (!strips[k]->is800KHz)
+      return false;
+#endif
+    if (strips[k]->pin < 0)
+      return false;
+  }
+
+#if defined(NEOPIXEL_PARALLEL_AVR)
+  // All strips must share one PORT; each strip's pin bit is its lane, so
+  // a bit-plane is written to the PORT as-is.
+  port = portOutputRegister(digitalPinToPort(strips[0]->pin));
+  portMask = 0;
+  for (uint8_t k = 0; k < count; k++) {
+    uint8_t mask = digitalPinToBitMask(strips[k]->pin);
+    if ((portOutputRegister(digitalPinToPort(strips[k]->pin)) != port) ||
+        (portMask & mask))
+      return false;
+    portMask |= mask;
+    for (lane[k] = 0; !(mask & 1); mask >>= 1)
+      lane[k]++;
+  }
+  lanes = 8;
+  parallel = true;
+#elif defined(ARDUINO_ARCH_RP2040)
+  // Strips must occupy a run of consecutive GPIOs (any order); lane N is
+  // GPIO basePin+N.
+  int16_t lowest = strips[0]->pin;
+  for (uint8_t k = 1; k < count; k++) {
+    if (strips[k]->pin < lowest)
+      lowest = strips[k]->pin;
+  }
+  uint16_t used = 0;
+  for (uint8_t k = 0; k < count; k++) {
+    uint8_t l = strips[k]->pin - lowest;
+    if ((l >= count) || (used & (1 << l)))
+      return false; // Gap or duplicate pin
+    used |= 1 << l;
+    lane[k] = l;
+  }
+  basePin = lowest;
+  lanes = (count > 8) ? 16 : 8;
+
+  if (sm < 0) {
+    sm = pio_claim_unused_sm(pio, false);
+    if (sm < 0) {
+      pio = pio1;
+      sm = pio_claim_unused_sm(pio, false);
+      if (sm < 0)
+        return false;
+    }
+  }
+  uint16_t instructions[4];
+  memcpy(instructions, ws2812_parallel_instructions, sizeof(instructions));
+  instructions[0] = 0x6020 | lanes; // out x, <lanes>
+  struct pio_program program = {instructions, 4, -1};
+  if (!pio_can_add_program(pio, &program))
+    return false;
+  offset = pio_add_program(pio, &program);
+
+  for (uint8_t k = 0; k < count; k++)
+    pio_gpio_init(pio, basePin + k);
+  pio_sm_set_consecutive_pindirs(pio, sm, basePin, count, true);
+  pio_sm_config c = pio_get_default_sm_config();
+  sm_config_set_wrap(&c, offset, offset + 3);
+  sm_config_set_out_pins(&c, basePin, count);
+  sm_config_set_out_shift(&c, true, true, 32); // LSB plane first
+  sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+  sm_config_set_clkdiv(&c, clock_get_hz(clk_sys) /
+                               (800000.0f * ws2812_parallel_cycles_per_bit));
+  pio_sm_init(pio, sm, offset, &c);
+  pio_sm_set_enabled(pio, sm, true);
+  parallel = true;
+#endif
+
+  return parallel;
+}
+
+#if defined(ARDUINO_ARCH_RP2040)
+/*!
+  @brief   Stop the state machine and free the instruction memory taken by
+           a previous begin(), if any. The state machine stays claimed.
+*/
+void Adafruit_NeoPixel_Parallel::unloadProgram(void) {
+  if (offset < 0)
+    return;
+  struct pio_program program = {ws2812_parallel_instructions, 4, -1};
+  pio_sm_set_enabled(pio, sm, false);
+  pio_remove_program(pio, &program, offset);
+  offset = -1;
+}
+#endif
+
+/*!
+  @brief   Check whether a call to show() will start sending data
+           immediately or will 'block' for the latch interval. See
+           Adafruit_NeoPixel::canShow().
+  @return  true if show() will start sending immediately.
+*/
+bool Adafruit_NeoPixel_Parallel::canShow(void) {
+  uint32_t now = micros();
+  if (endTime > now)
+    endTime = now;
+  return (now - endTime) >= 300L;
+}
+
+/*!
+  @brief   Transpose one byte from each of 8 lanes into 8 bit-planes.
+  @param   in      Input bytes, in[k] = next byte for lane k.
+  @param   planes  Output, planes[0] = MSB of every lane (bit k = lane k)
+                   down to planes[7] = LSB of every lane. This is the order
+                   NeoPixel data goes out on the wire.
+  @note    Standard 8x8 bit-matrix transpose in three rounds of masked
+           swaps (Hacker's Delight, 7-3), working on two 32-bit halves.
+           Portable and independent of the output hardware.
+*/
+void Adafruit_NeoPixel_Parallel::transpose8(const uint8_t in[8],
+                                            uint8_t planes[8]) {
+  // Lane 7 in the top row so that lane k lands in bit k of each plane
+  uint32_t x = ((uint32_t)in[7] << 24) | ((uint32_t)in[6] << 16) |
+               ((uint32_t)in[5] << 8) | in[4];
+  uint32_t y = ((uint32_t)in[3] << 24) | ((uint32_t)in[2] << 16) |
+               ((uint32_t)in[1] << 8) | in[0];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA; // Swap 1x1 blocks
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; // Swap 2x2 blocks
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F); // Swap 4x4 blocks
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+
+  planes[0] = t >> 24;
+  planes[1] = t >> 16;
+  planes[2] = t >> 8;
+  planes[3] = t;
+  planes[4] = y >> 24;
+  planes[5] = y >> 16;
+  planes[6] = y >> 8;
+  planes[7] = y;
+}
+
+/*!
+  @brief   Transpose a whole frame of up to 8 equal-length lanes.
+  @param   lanes   Pointers to each lane's bytes; NULL entries send zeros.
+  @param   nBytes  Bytes per lane.
+  @param   planes  Output buffer, 8 * nBytes bytes; byte i of every lane
+                   becomes planes[i * 8] through planes[i * 8 + 7].
+*/
+void Adafruit_NeoPixel_Parallel::transposeFrame(const uint8_t *const lanes[8],
+                                                uint16_t nBytes,
+                                                uint8_t *planes) {
+  uint8_t in[8];
+  for (uint16_t i = 0; i < nBytes; i++, planes += 8) {
+    for (uint8_t k = 0; k < 8; k++)
+      in[k] = lanes[k] ? lanes[k][i] : 0;
+    transpose8(in, planes);
+  }
+}
+
+// Not a user API. Collect byte i of every strip into its lane, applying
+// the strip's output tables if it has them. Lanes without a strip, and
+// strips shorter than i, contribute 0.
+void Adafruit_NeoPixel_Parallel::gather(uint16_t i,
+                                        uint8_t in[NEOPIXEL_PARALLEL_MAX]) {
+  memset(in, 0, lanes);
+  for (uint8_t k = 0; k < count; k++) {
+    Adafruit_NeoPixel *s = strips[k];
+    if (i < s->numBytes) {
+      uint8_t c = s->pixels[i];
+      if (tables[k][0])
+        c = tables[k][i % ((s->wOffset == s->rOffset) ? 3 : 4)][c];
+      in[lane[k]] = c;
+    }
+  }
+}
+
+// Not a user API. Length of the longest strip, in bytes.
+uint16_t Adafruit_NeoPixel_Parallel::frameBytes(void) const {
+  uint16_t n = 0;
+  for (uint8_t k = 0; k < count; k++) {
+    if (strips[k]->numBytes > n)
+      n = strips[k]->numBytes;
+  }
+  return n;
+}
+
+/*!
+  @brief   Transmit pixel data of all strips in the group. Each strip's
+           brightness and output tables are honored as in its own show().
+  @note    Interrupts are disabled for about 30 microseconds per pixel of
+           the LONGEST strip (AVR), independent of how many strips there
+           are. On AVR the transposed frame needs 8 bytes of RAM per byte
+           of the longest strip, allocated on first use; if that fails the
+           strips are shown one at a time.
+*/
+void Adafruit_NeoPixel_Parallel::show(void) {
+  if (!parallel) {
+    for (uint8_t k = 0; k < count; k++)
+      strips[k]->show();
+    return;
+  }
+
+  for (uint8_t k = 0; k < count; k++) {
+    Adafruit_NeoPixel *s = strips[k];
+    if (s->lut) {
+      if (s->lutDirty && !s->buildLUT())
+        return;
+      s->lutTables(tables[k]);
+    } else {
+      tables[k][0] = NULL;
+    }
+  }
+
+#if defined(NEOPIXEL_PARALLEL_AVR)
+  uint16_t n = frameBytes();
+  uint8_t in[NEOPIXEL_PARALLEL_MAX];
+  if (!n)
+    return; // The output loop sends at least one plane, and planes is NULL
+  if (planeBytes != n * 8) {
+    free(planes);
+    // +1: the output loop prefetches one byte past the end
+    if (!(planes = (uint8_t *)malloc(n * 8 + 1))) {
+      planeBytes = 0;
+      for (uint8_t k = 0; k < count; k++)
+        strips[k]->show();
+      return;
+    }
+    planeBytes = n * 8;
+  }
+  // Transpose while the previous frame's latch interval runs out
+  for (uint16_t i = 0; i < n; i++) {
+    gather(i, in);
+    transpose8(in, &planes[i * 8]);
+  }
+
+  while (!canShow())
+    ;
+
+  noInterrupts();
+
+  // One bit-plane per 20-cycle (1.25 us) bit. All lanes go high, lanes
+  // sending 0 drop at 6 cycles (375 ns), the rest at 13 (812 ns). Same
+  // PORT snapshot approach as Adafruit_NeoPixel::show(); plane bytes are
+  // merged with the 'lo' state one bit ahead of when they're needed.
+  uint8_t hi = *port | portMask, lo = *port & ~portMask;
+  uint8_t *ptr = planes;
+  uint8_t next = *ptr++ | lo;
+  uint16_t i = planeBytes;
+
+  asm volatile("headP%=:"
+               "\n\t"
+               "st   %a[port], %[hi]" // 0-1  all lanes high
+               "\n\t"
+               "rjmp .+0" // 2-3
+               "\n\t"
+               "nop" // 4
+               "\n\t"
+               "nop" // 5
+               "\n\t"
+               "st   %a[port], %[next]" // 6-7  '0' lanes low
+               "\n\t"
+               "ld   %[next], %a[ptr]+" // 8-9
+               "\n\t"
+               "sbiw %[count], 1" // 10-11
+               "\n\t"
+               "or   %[next], %[lo]" // 12
+               "\n\t"
+               "st   %a[port], %[lo]" // 13-14  all lanes low
+               "\n\t"
+               "rjmp .+0" // 15-16
+               "\n\t"
+               "nop" // 17
+               "\n\t"
+               "brne headP%=" // 18-19
+               "\n"
+               : [ptr] "+e"(ptr), [next] "+r"(next), [count] "+w"(i)
+               : [port] "e"(port), [hi] "r"(hi), [lo] "r"(lo));
+
+  interrupts();
+#elif defined(ARDUINO_ARCH_RP2040)
+  uint16_t n = frameBytes();
+  uint8_t in[NEOPIXEL_PARALLEL_MAX];
+
+  while (!canShow())
+    ;
+
+  // The state machine pulls 32 bits at a time, so pack 4 planes (8 lanes)
+  // or 2 planes (16 lanes) per FIFO word, first plane in the low bits.
+  // Transposing here is free; put_blocking() mostly waits on the FIFO.
+  uint8_t p[8], q[8];
+  for (uint16_t i = 0; i < n; i++) {
+    gather(i, in);
+    transpose8(in, p);
+    if (lanes == 8) {
+      pio_sm_put_blocking(pio, sm,
+                          p[0] | (p[1] << 8) | (p[2] << 16) |
+                              ((uint32_t)p[3] << 24));
+      pio_sm_put_blocking(pio, sm,
+                          p[4] | (p[5] << 8) | (p[6] << 16) |
+                              ((uint32_t)p[7] << 24));
+    } else {
+      transpose8(&in[8], q);
+      for (uint8_t b = 0; b < 8; b += 2)
+        pio_sm_put_blocking(pio, sm,
+                            p[b] | (q[b] << 8) | (p[b + 1] << 16) |
+                                ((uint32_t)q[b + 1] << 24));
+    }
+  }
+  while (!pio_sm_is_tx_fifo_empty(pio, sm))
+    ;
+#endif
+
+  endTime = micros(); // Save EOD time for latch on next call
+}
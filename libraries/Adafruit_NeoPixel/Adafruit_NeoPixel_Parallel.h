@@ -0,0 +1,105 @@
+/*!
+ * @file Adafruit_NeoPixel_Parallel.h
+ *
+ * Drive several NeoPixel strips at once from a single GPIO port (AVR) or
+ * PIO state machine (RP2040). Each strip is still an ordinary
+ * Adafruit_NeoPixel object for drawing; this class only replaces show(),
+ * transposing the strips' bytes into port-wide bit-planes so that all
+ * strips are clocked out simultaneously. Frame time therefore depends on
+ * the longest strip rather than the total pixel count.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_PARALLEL_H
+#define ADAFRUIT_NEOPIXEL_PARALLEL_H
+
+#include "Adafruit_NeoPixel.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+#define NEOPIXEL_PARALLEL_MAX 16 ///< Strips per group (consecutive GPIOs)
+#else
+#define NEOPIXEL_PARALLEL_MAX 8 ///< Strips per group (one 8-bit port)
+#endif
+
+/*!
+    @brief  Class that issues data to a group of Adafruit_NeoPixel strips
+            in parallel.
+    @note   Supported outputs are AVR at 16 MHz (all strips on the same
+            PORT; strip data goes out on that port's pins) and RP2040 (all
+            strips on consecutive GPIO numbers, driven by one PIO state
+            machine). Only 800 KHz strips are supported. Anywhere else, or
+            if the strips don't meet those rules, show() falls back to
+            calling each strip's own show() in turn -- same result, no
+            speedup. isParallel() reports which one you got.
+*/
+class Adafruit_NeoPixel_Parallel {
+
+public:
+  Adafruit_NeoPixel_Parallel(void);
+  ~Adafruit_NeoPixel_Parallel();
+
+  bool addStrip(Adafruit_NeoPixel &strip);
+  bool begin(void);
+  void show(void);
+  bool canShow(void);
+  /*!
+    @brief   Return the number of strips added to this group.
+    @return  Strip count, 0 to NEOPIXEL_PARALLEL_MAX.
+  */
+  uint8_t numStrips(void) const { return count; }
+  /*!
+    @brief   Check whether show() issues all strips at once.
+    @return  true if the group is driven in parallel, false if begin()
+             hasn't been called or the strips couldn't be grouped (in
+             which case show() updates them one after another).
+  */
+  bool isParallel(void) const { return parallel; }
+
+  static void transpose8(const uint8_t in[8], uint8_t planes[8]);
+  static void transposeFrame(const uint8_t *const lanes[8], uint16_t nBytes,
+                             uint8_t *planes);
+
+protected:
+  void gather(uint16_t i, uint8_t in[NEOPIXEL_PARALLEL_MAX]);
+  uint16_t frameBytes(void) const;
+#if defined(ARDUINO_ARCH_RP2040)
+  void unloadProgram(void);
+#endif
+
+  Adafruit_NeoPixel *strips[NEOPIXEL_PARALLEL_MAX]; ///< Member strips
+  uint8_t lane[NEOPIXEL_PARALLEL_MAX]; ///< Output bit for each strip
+  const uint8_t *tables[NEOPIXEL_PARALLEL_MAX][4]; ///< Per-show() LUTs
+  uint8_t count;     ///< Number of strips in 'strips'
+  uint8_t lanes;     ///< Bits per bit-plane (8 or 16)
+  bool parallel;     ///< true if begin() found a parallel output
+  uint32_t endTime;  ///< Latch timing reference
+#if defined(__AVR__)
+  volatile uint8_t *port; ///< Output PORT register shared by all strips
+  uint8_t portMask;       ///< Bits of 'port' used by strips
+  uint8_t *planes;        ///< Transposed frame, 8 bytes per strip byte
+  uint16_t planeBytes;    ///< Size of 'planes' buffer
+#endif
+#if defined(ARDUINO_ARCH_RP2040)
+  PIO pio;         ///< PIO block driving the group
+  int sm;          ///< State machine within 'pio' (-1 = none)
+  int offset;      ///< Program address in 'pio' (-1 = not loaded)
+  uint8_t basePin; ///< GPIO of lane 0
+#endif
+};
+
+#endif // ADAFRUIT_NEOPIXEL_PARALLEL_H
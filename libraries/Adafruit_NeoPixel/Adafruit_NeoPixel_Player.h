@@ -0,0 +1,193 @@
+/*!
+ * @file Adafruit_NeoPixel_Player.h
+ *
+ * Plays .npxa animation files (see Adafruit_NeoPixel_AnimFormat.h) from an
+ * SD card or other file system onto an Adafruit_NeoPixel strip, one frame
+ * at a time, at the frame rate stored in the file. Only one frame of
+ * pixel data is ever held in RAM, the strip's own buffer, so the length of
+ * an animation is limited by the card rather than the microcontroller.
+ *
+ * Header-only and templated on the file type, so the NeoPixel library
+ * doesn't depend on any particular SD library. Works with SdFat's FsFile,
+ * File32 and ExFile, and the Arduino SD library's File.
+ *
+ * This file is part of the Adafruit_NeoPixel library.
+ *
+ * Adafruit_NeoPixel is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Adafruit_NeoPixel is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with NeoPixel.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADAFRUIT_NEOPIXEL_PLAYER_H
+#define ADAFRUIT_NEOPIXEL_PLAYER_H
+
+#include "Adafruit_NeoPixel.h"
+#include "Adafruit_NeoPixel_AnimFormat.h"
+
+#ifndef NEOANIM_CHUNK
+#if defined(__AVR__)
+#define NEOANIM_CHUNK 64 ///< File read size; one SD sector elsewhere
+#else
+#define NEOANIM_CHUNK 512 ///< File read size, one SD sector
+#endif
+#endif
+
+/*!
+    @brief  Class that streams a .npxa animation file to a NeoPixel strip.
+    @note   The strip's pixel buffer receives file data verbatim, so the
+            strip must be declared with the color order the file was
+            encoded for. Frames after the first are XORed into that
+            buffer, so with the default premultiplied brightness,
+            setBrightness() (or setOutputLUT()) must not be called on the
+            strip while a clip plays: it rescales the buffer in place and
+            every later frame would be decoded against the wrong data.
+            update() stops playback if it finds this has happened. Use
+            setOutputLUT(true) in setup() to have brightness (and gamma)
+            applied as data is sent; setBrightness() is then safe at any
+            time.
+*/
+template <class FileT> class Adafruit_NeoPixel_Player {
+public:
+  /*!
+    @brief   Player constructor.
+    @param   s  Strip to play onto. Must be at least as long as the
+                animation and use the same color order.
+  */
+  Adafruit_NeoPixel_Player(Adafruit_NeoPixel &s)
+      : strip(s), file(NULL), frames(0), period(0), index(0), late(0),
+        looping(true), playing(false) {}
+
+  /*!
+    @brief   Start playing an open animation file. Decodes the first frame
+             into the strip; it's shown on the next update().
+    @param   f  Open file, positioned anywhere. Must stay open while
+                playing.
+    @return  true on success, false if the file isn't a valid animation
+             for this strip.
+  */
+  bool begin(FileT &f) {
+    uint8_t raw[NEOANIM_HEADER_SIZE];
+    NeoAnimHeader hdr;
+    playing = false;
+    file = &f;
+    if (!file->seek(0) ||
+        (file->read(raw, NEOANIM_HEADER_SIZE) != NEOANIM_HEADER_SIZE) ||
+        !hdr.parse(raw))
+      return false;
+    uint8_t order = (strip.wOffset << 6) | (strip.rOffset << 4) |
+                    (strip.gOffset << 2) | strip.bOffset;
+    if ((hdr.order != order) || (hdr.numPixels > strip.numLEDs))
+      return false;
+    frames = hdr.frameCount;
+    period = hdr.frameUs;
+    decoder.begin(strip.pixels, hdr.numPixels * hdr.bytesPerPixel());
+    late = 0;
+    if (!rewind())
+      return false;
+    due = micros();
+    bright = strip.brightness;
+    return playing = true;
+  }
+
+  /*!
+    @brief   Call as often as possible from loop(). When the current
+             frame is due it is shown, and the next frame is immediately
+             read and decoded into the strip's buffer, so SD access happens
+             while the LEDs display the current frame rather than delaying
+             the next one.
+    @return  true while playing, false once a non-looping animation has
+             ended, on a read error, or if the strip's premultiplied
+             brightness was changed during playback (see isPlaying()).
+  */
+  bool update(void) {
+    if (!playing)
+      return false;
+    if (strip.brightness != bright)
+      return playing = false; // Pixel buffer rescaled under the decoder
+    uint32_t now = micros();
+    if ((int32_t)(now - due) < 0)
+      return true; // Not time yet
+    strip.show();
+    // Advance by whole periods to hold the file's frame rate on average;
+    // if we've fallen more than a frame behind, count it and resync
+    // rather than racing to catch up.
+    if ((uint32_t)(now - due) > period) {
+      late++;
+      due = now + period;
+    } else {
+      due += period;
+    }
+    if (++index >= frames) {
+      if (!looping)
+        return playing = false;
+      return playing = rewind();
+    }
+    return playing = decoder.readRecord(*file, buf, sizeof(buf));
+  }
+
+  /*!
+    @brief   Choose whether the animation restarts after its last frame.
+    @param   on  true to loop (default), false to stop.
+  */
+  void setLoop(bool on) { looping = on; }
+  /*!
+    @brief   Check whether the animation is still playing.
+    @return  true if update() will keep showing frames.
+  */
+  bool isPlaying(void) const { return playing; }
+  /*!
+    @brief   Number of frames in the animation.
+    @return  Frame count from the file header.
+  */
+  uint32_t frameCount(void) const { return frames; }
+  /*!
+    @brief   Index of the frame that will be shown next.
+    @return  0 to frameCount() - 1.
+  */
+  uint32_t frameIndex(void) const { return index; }
+  /*!
+    @brief   Frame period stored in the file.
+    @return  Microseconds per frame.
+  */
+  uint32_t framePeriod(void) const { return period; }
+  /*!
+    @brief   Number of times playback fell more than a frame behind
+             schedule (SD card too slow, loop() doing too much, or strip
+             too long for the frame rate).
+    @return  Late frame count since begin().
+  */
+  uint32_t lateFrames(void) const { return late; }
+
+private:
+  // Seek to the first record (always a keyframe) and decode it
+  bool rewind(void) {
+    index = 0;
+    return file->seek(NEOANIM_HEADER_SIZE) &&
+           decoder.readRecord(*file, buf, sizeof(buf));
+  }
+
+  Adafruit_NeoPixel &strip;
+  FileT *file;
+  NeoAnimDecoder decoder;
+  uint8_t buf[NEOANIM_CHUNK];
+  uint32_t frames; // Frames in file
+  uint32_t period; // Microseconds per frame
+  uint32_t index;  // Frame decoded into strip, shown on next due time
+  uint32_t due;    // micros() when that frame should be shown
+  uint32_t late;   // Frames shown more than a period late
+  uint8_t bright;  // strip.brightness when begun; pixels rescaled if changed
+  bool looping;
+  bool playing;
+};
+
+#endif // ADAFRUIT_NEOPIXEL_PLAYER_H
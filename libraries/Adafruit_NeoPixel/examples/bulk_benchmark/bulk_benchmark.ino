@@ -0,0 +1,73 @@
+// Bulk pixel operations benchmark for the Adafruit NeoPixel library.
+// Released under the GPLv3 license to match the rest of the
+// Adafruit NeoPixel library
+
+// Prints CPU cycles per pixel for the per-pixel idioms used in most
+// sketches next to their bulk equivalents (fillHSV(), setPixelColors(),
+// fill(), copyPixels(), blendPixels()). Nothing needs to be connected;
+// show() is never called.
+
+#include <Adafruit_NeoPixel.h>
+
+#define PIN        6
+#define NUMPIXELS 150
+#define REPS      10
+
+Adafruit_NeoPixel strip(NUMPIXELS, PIN, NEO_GRB + NEO_KHZ800);
+uint32_t colors[NUMPIXELS];
+
+// Print average cycles per pixel given total microseconds for REPS passes
+void report(const __FlashStringHelper *label, uint32_t us, uint16_t n) {
+  Serial.print(label);
+  Serial.print(F(": "));
+  Serial.print((float)us * (F_CPU / 1000000L) / ((uint32_t)REPS * n), 1);
+  Serial.println(F(" cycles/pixel"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial && millis() < 3000);
+  strip.begin();
+  strip.setBrightness(128); // Exercise the brightness path too
+  for (uint16_t i = 0; i < NUMPIXELS; i++) {
+    colors[i] = Adafruit_NeoPixel::ColorHSV(i * 437);
+  }
+
+  uint32_t t = micros();
+  for (uint8_t r = 0; r < REPS; r++) {
+    for (uint16_t i = 0; i < NUMPIXELS; i++) {
+      uint16_t hue = r * 1000 + (i * 65536L) / NUMPIXELS;
+      strip.setPixelColor(i, strip.gamma32(strip.ColorHSV(hue)));
+    }
+  }
+  report(F("ColorHSV+gamma32+setPixelColor loop"), micros() - t, NUMPIXELS);
+
+  t = micros();
+  for (uint8_t r = 0; r < REPS; r++) strip.rainbow(r * 1000);
+  report(F("rainbow() (uses fillHSV)        "), micros() - t, NUMPIXELS);
+
+  t = micros();
+  for (uint8_t r = 0; r < REPS; r++) {
+    for (uint16_t i = 0; i < NUMPIXELS; i++) strip.setPixelColor(i, colors[i]);
+  }
+  report(F("setPixelColor loop              "), micros() - t, NUMPIXELS);
+
+  t = micros();
+  for (uint8_t r = 0; r < REPS; r++) strip.setPixelColors(colors, NUMPIXELS);
+  report(F("setPixelColors()                "), micros() - t, NUMPIXELS);
+
+  t = micros();
+  for (uint8_t r = 0; r < REPS; r++) strip.fill(colors[r]);
+  report(F("fill()                          "), micros() - t, NUMPIXELS);
+
+  t = micros();
+  for (uint8_t r = 0; r < REPS; r++) strip.copyPixels(1, 0, NUMPIXELS - 1);
+  report(F("copyPixels() (scroll by 1)      "), micros() - t, NUMPIXELS - 1);
+
+  t = micros();
+  for (uint8_t r = 0; r < REPS; r++)
+    strip.blendPixels(0, NUMPIXELS / 2, NUMPIXELS / 2, 64);
+  report(F("blendPixels()                   "), micros() - t, NUMPIXELS / 2);
+}
+
+void loop() {}
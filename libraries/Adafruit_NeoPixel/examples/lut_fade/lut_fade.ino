@@ -0,0 +1,44 @@
+// Lossless fade demo for the Adafruit NeoPixel library.
+// Released under the GPLv3 license to match the rest of the
+// Adafruit NeoPixel library
+
+// With setOutputLUT(true), brightness and gamma are applied as data is
+// sent, so the rainbow is drawn ONCE in setup() and the fade below only
+// changes the brightness. Each show() rebuilds a 256-byte table instead
+// of rescaling every pixel, and the colors come back intact at full
+// brightness. Compare against the default mode by commenting out the
+// setOutputLUT() line: the rainbow gets visibly posterized after a few
+// fades.
+
+#include <Adafruit_NeoPixel.h>
+
+#define PIN        6
+#define NUMPIXELS 60
+
+Adafruit_NeoPixel strip(NUMPIXELS, PIN, NEO_GRB + NEO_KHZ800);
+
+void setup() {
+  Serial.begin(115200);
+  strip.begin();
+  if (!strip.setOutputLUT(true)) {
+    Serial.println(F("Not enough RAM for output tables"));
+  }
+  strip.setGamma(true); // Perceptually even fade
+  strip.rainbow(0, 1, 255, 255, false); // Linear colors; gamma at output
+}
+
+void loop() {
+  uint32_t t = micros();
+  for (int b = 255; b >= 0; b -= 5) {
+    strip.setBrightness(b);
+    strip.show();
+    delay(10);
+  }
+  for (int b = 0; b <= 255; b += 5) {
+    strip.setBrightness(b);
+    strip.show();
+    delay(10);
+  }
+  Serial.print(F("Fade cycle (us, incl. delays): "));
+  Serial.println(micros() - t);
+}
@@ -0,0 +1,64 @@
+// SD card animation player for the Adafruit NeoPixel library.
+// Released under the GPLv3 license to match the rest of the
+// Adafruit NeoPixel library
+
+// Plays ANIM.NPXA from the root of an SD card, looping. Make the file on
+// a computer with extras/npxanim/npxanim.py, e.g. for a 150-pixel GRB
+// strip at 60 frames per second:
+//
+//   npxanim.py encode show.raw ANIM.NPXA --pixels 150 --order GRB --fps 60
+//
+// (or 'npxanim.py synth show.raw --pixels 150' first, for a demo). Frames
+// are streamed from the card as they're needed, so animations can be as
+// long as the card allows even on an Arduino Uno. The serial monitor
+// reports frames that couldn't be shown on time.
+//
+// Requires the SdFat library.
+
+#include <SdFat.h>
+#include <Adafruit_NeoPixel.h>
+#include <Adafruit_NeoPixel_Player.h>
+
+#define PIN        6
+#define NUMPIXELS 150
+#define SD_CS     10
+
+SdFs sd;
+FsFile file;
+Adafruit_NeoPixel strip(NUMPIXELS, PIN, NEO_GRB + NEO_KHZ800);
+Adafruit_NeoPixel_Player<FsFile> player(strip);
+
+void setup() {
+  Serial.begin(115200);
+  strip.begin();
+  // Brightness is applied as data is sent, not to the decoded frames
+  strip.setOutputLUT(true);
+  strip.setBrightness(64);
+
+  if (!sd.begin(SD_CS, SD_SCK_MHZ(25))) {
+    Serial.println(F("SD card not found"));
+    while (1);
+  }
+  if (!file.open("ANIM.NPXA", O_RDONLY) || !player.begin(file)) {
+    Serial.println(F("ANIM.NPXA missing, or not made for this strip"));
+    while (1);
+  }
+  Serial.print(player.frameCount());
+  Serial.print(F(" frames, "));
+  Serial.print(1000000.0 / player.framePeriod());
+  Serial.println(F(" fps"));
+}
+
+uint32_t reported = 0;
+
+void loop() {
+  if (!player.update()) {
+    Serial.println(F("Read error"));
+    while (1);
+  }
+  if (player.lateFrames() != reported) {
+    reported = player.lateFrames();
+    Serial.print(F("Late frames: "));
+    Serial.println(reported);
+  }
+}
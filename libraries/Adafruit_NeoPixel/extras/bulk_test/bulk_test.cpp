@@ -0,0 +1,237 @@
+// Host test and benchmark for the bulk pixel operations. For RGB and RGBW
+// color orders at several brightness levels, checks that the pixel buffer
+// is byte-identical to doing the same thing pixel by pixel:
+// - fill() against setPixelColor() in a loop
+// - setPixelColors() against setPixelColor() per color
+// - fillHSV() with whole hue steps against ColorHSV(), gamma32() and
+//   setPixelColor()
+// - copyPixels() against setPixelColor(getPixelColor()) from a snapshot,
+//   overlapping both ways (at brightness 0, where getPixelColor() is exact)
+// and that blendPixels() is within 1 of dst + (src - dst) * amount / 255,
+// exact at 0 and 255. rainbow() is compared with the old per-pixel formula,
+// which truncated the hue, so it may differ by a rounding step.
+// Then times each bulk operation against its per-pixel loop, in ns per
+// pixel (the bulk_benchmark example gives cycles on the target).
+//
+// Usage: bulk_test   (see Makefile)
+
+#include "Adafruit_NeoPixel.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+// show() isn't called, but the host build links against the ESP32 path
+extern "C" void espShow(uint16_t, uint8_t *, uint32_t, uint8_t) {}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+enum { N = 300 };
+static uint32_t colors[N];
+
+static const struct {
+  neoPixelType type;
+  const char *name;
+} orders[] = {{NEO_GRB, "GRB"},   {NEO_RGB, "RGB"},   {NEO_BGR, "BGR"},
+              {NEO_GRBW, "GRBW"}, {NEO_RGBW, "RGBW"}, {NEO_WRGB, "WRGB"},
+              {NEO_BRGW, "BRGW"}};
+static const uint8_t levels[] = {0, 255, 100, 1};
+static const uint8_t amounts[] = {0, 1, 128, 254, 255};
+static const uint16_t lengths[] = {7, 60, 300, 1000};
+static const int8_t repeats[] = {1, 3, -2};
+
+static void checkOrder(neoPixelType type, const char *name, uint8_t bpp) {
+  for (uint8_t br : levels) {
+    Adafruit_NeoPixel a(N, 5, type), b(N, 5, type);
+    a.setBrightness(br);
+    b.setBrightness(br);
+    size_t const bytes = N * bpp;
+
+    for (int i = 0; i < N - 7; i++)
+      a.setPixelColor(i + 7, colors[i]);
+    b.setPixelColors(colors, N, 7); // the last 7 fall off the end
+    CHECK(!memcmp(a.getPixels(), b.getPixels(), bytes),
+          "%s brightness %u: setPixelColors", name, br);
+
+    for (int i = 5; i < 105; i++)
+      a.setPixelColor(i, colors[0]);
+    b.fill(colors[0], 5, 100);
+    CHECK(!memcmp(a.getPixels(), b.getPixels(), bytes),
+          "%s brightness %u: fill", name, br);
+
+    for (int i = 0; i < N; i++)
+      a.setPixelColor(i, Adafruit_NeoPixel::gamma32(
+                             Adafruit_NeoPixel::ColorHSV(1000 + i * 217, 200,
+                                                         180)));
+    b.fillHSV(1000, 217 * 256, 0, 0, 200, 180, true);
+    CHECK(!memcmp(a.getPixels(), b.getPixels(), bytes),
+          "%s brightness %u: fillHSV", name, br);
+
+    for (int i = 0; i < N; i++)
+      a.setPixelColor(i, Adafruit_NeoPixel::ColorHSV(40000 - i * 300));
+    b.fillHSV(40000, -300 * 256, 0, 0, 255, 255, false);
+    CHECK(!memcmp(a.getPixels(), b.getPixels(), bytes),
+          "%s brightness %u: fillHSV backwards, no gamma", name, br);
+  }
+
+  // copy and blend work on stored bytes; at brightness 0 (none)
+  // getPixelColor() returns them exactly, so it can be the reference
+  Adafruit_NeoPixel a(N, 5, type), b(N, 5, type), snap(N, 5, type);
+  static const int moves[][3] = {{10, 0, 200}, {0, 10, 200}, {50, 250, 100}};
+  for (auto &m : moves) {
+    a.setPixelColors(colors, N);
+    b.setPixelColors(colors, N);
+    snap.setPixelColors(colors, N);
+    for (int i = 0; i < m[2] && m[0] + i < N && m[1] + i < N; i++)
+      a.setPixelColor(m[0] + i, snap.getPixelColor(m[1] + i));
+    b.copyPixels(m[0], m[1], m[2]);
+    CHECK(!memcmp(a.getPixels(), b.getPixels(), N * bpp),
+          "%s: copyPixels(%d, %d, %d)", name, m[0], m[1], m[2]);
+
+    for (int amount : amounts) {
+      b.setPixelColors(colors, N);
+      b.blendPixels(m[0], m[1], m[2], amount);
+      int worst = 0;
+      for (int i = 0; i < N; i++) {
+        uint32_t const got = b.getPixelColor(i), d = snap.getPixelColor(i);
+        int const j = m[1] + i - m[0]; // source pixel, if i is in the run
+        if ((i < m[0]) || (i >= m[0] + m[2]) || (j >= N)) {
+          worst = (got != d) ? 99 : worst; // outside the run, untouched
+          continue;
+        }
+        uint32_t const s = snap.getPixelColor(j);
+        for (int sh = 0; sh < 32; sh += 8) {
+          int const dc = (d >> sh) & 0xFF, sc = (s >> sh) & 0xFF;
+          int const exact = dc + (int)lround((sc - dc) * amount / 255.0);
+          int const err = abs((int)((got >> sh) & 0xFF) - exact);
+          if (err && ((amount == 0) || (amount == 255)))
+            worst = 99; // these two must be exact
+          worst = (err > worst) ? err : worst;
+        }
+      }
+      CHECK(worst <= 1, "%s: blendPixels(%d, %d, %d, %d) off by %d", name,
+            m[0], m[1], m[2], amount, worst);
+    }
+  }
+}
+
+static void checkRainbow(void) {
+  int worst = 0, differ = 0, total = 0;
+  for (int n : lengths) {
+    for (int reps : repeats) {
+      Adafruit_NeoPixel a(n, 5), b(n, 5);
+      for (int i = 0; i < n; i++) {
+        uint16_t const hue = 12345 + (i * reps * 65536L) / n;
+        a.setPixelColor(i, Adafruit_NeoPixel::gamma32(
+                               Adafruit_NeoPixel::ColorHSV(hue)));
+      }
+      b.rainbow(12345, reps);
+      for (int i = 0; i < n * 3; i++) {
+        int const d = abs(a.getPixels()[i] - b.getPixels()[i]);
+        differ += d != 0;
+        worst = d > worst ? d : worst;
+      }
+      total += n * 3;
+    }
+  }
+  printf("rainbow: %d of %d bytes differ from the old formula, by up to %d\n",
+         differ, total, worst);
+  CHECK(worst <= 3, "rainbow differs by %d", worst);
+}
+
+static void bench(void) {
+  enum { P = 1000, R = 2000 };
+  static uint32_t big[P];
+  for (int i = 0; i < P; i++)
+    big[i] = colors[i % N];
+  double t0, t1, t2;
+
+  Adafruit_NeoPixel s(P, 5), w(P, 5, NEO_GRBW + NEO_KHZ800);
+  s.setBrightness(200);
+  w.setBrightness(200);
+
+  t0 = now();
+  for (int r = 0; r < R; r++)
+    for (uint16_t i = 0; i < P; i++)
+      s.setPixelColor(i, Adafruit_NeoPixel::gamma32(Adafruit_NeoPixel::ColorHSV(
+                             r + (i * 65536L) / P)));
+  t1 = now();
+  for (int r = 0; r < R; r++)
+    s.rainbow(r);
+  t2 = now();
+  printf("rainbow          %6.2f -> %6.2f ns/pixel\n", (t1 - t0) / R / P,
+         (t2 - t1) / R / P);
+
+  Adafruit_NeoPixel *const strips[] = {&s, &w};
+  for (Adafruit_NeoPixel *x : strips) {
+    t0 = now();
+    for (int r = 0; r < R; r++)
+      for (uint16_t i = 0; i < P; i++)
+        x->setPixelColor(i, big[i]);
+    t1 = now();
+    for (int r = 0; r < R; r++)
+      x->setPixelColors(big, P);
+    t2 = now();
+    printf("%-16s %6.2f -> %6.2f ns/pixel\n",
+           x == &s ? "setPixelColors" : "setPixelColors W", (t1 - t0) / R / P,
+           (t2 - t1) / R / P);
+  }
+
+  t0 = now();
+  for (int r = 0; r < R; r++)
+    for (uint16_t i = 0; i < P; i++)
+      s.setPixelColor(i, big[r % P]);
+  t1 = now();
+  for (int r = 0; r < R; r++)
+    s.fill(big[r % P]);
+  t2 = now();
+  printf("fill             %6.2f -> %6.2f ns/pixel\n", (t1 - t0) / R / P,
+         (t2 - t1) / R / P);
+
+  t0 = now();
+  for (int r = 0; r < R; r++)
+    for (uint16_t i = P - 1; i > 0; i--)
+      s.setPixelColor(i, s.getPixelColor(i - 1));
+  t1 = now();
+  for (int r = 0; r < R; r++)
+    s.copyPixels(1, 0, P - 1);
+  t2 = now();
+  printf("copyPixels       %6.2f -> %6.2f ns/pixel\n", (t1 - t0) / R / P,
+         (t2 - t1) / R / P);
+
+  t0 = now();
+  for (int r = 0; r < R; r++)
+    s.blendPixels(0, P / 2, P / 2, r);
+  t1 = now();
+  printf("blendPixels      %6.2f ns/pixel\n", (t1 - t0) / R / (P / 2));
+}
+
+int main(void) {
+  srand(3);
+  for (int i = 0; i < N; i++)
+    colors[i] = ((uint32_t)rand() << 16) ^ rand();
+
+  for (auto &o : orders) {
+    bool const rgbw = ((o.type >> 6) & 3) != ((o.type >> 4) & 3);
+    checkOrder(o.type, o.name, rgbw ? 4 : 3);
+  }
+  checkRainbow();
+  bench();
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+
+# Encoder for NeoPixel animation files (.npxa), played from SD card by
+# Adafruit_NeoPixel_Player. See Adafruit_NeoPixel_AnimFormat.h for the
+# file layout: a keyframe, then each frame as an XOR/run-length delta
+# against the one before it.
+#
+# Usage:
+#   npxanim.py encode show.raw show.npxa --pixels 300 --order GRB --fps 60
+#   npxanim.py decode show.npxa check.raw
+#   npxanim.py info show.npxa
+#   npxanim.py synth demo.raw --pixels 300 --frames 600
+#
+# Raw input is consecutive frames of R,G,B (or R,G,B,W with --rgbw) bytes
+# per pixel, e.g. from a render script or ffmpeg -pix_fmt rgb24. --order
+# must match the NEO_* order the strip is declared with (GRB for most
+# NeoPixels); pixel data is stored in that order so the player can copy
+# it straight into the strip's buffer. 'decode' writes R,G,B(,W) frames
+# again, for checking a round trip.
+
+import argparse
+import math
+import struct
+import sys
+
+MAGIC = b"NPXA"
+VERSION = 1
+KEYFRAME, DELTA, REPEAT = b"K", b"D", b"R"
+
+
+def order_byte(order):
+    """NEO_* color order constant for a string like "GRB", as str2order()."""
+    order = order.lower()
+    pos = {c: order.index(c) for c in "rgb"}
+    pos["w"] = order.index("w") if "w" in order else pos["r"]
+    return (pos["w"] << 6) | (pos["r"] << 4) | (pos["g"] << 2) | pos["b"]
+
+
+def offsets(order):
+    """Native byte offsets of R,G,B(,W) within a pixel, from an order byte."""
+    w, r, g, b = (order >> 6) & 3, (order >> 4) & 3, (order >> 2) & 3, order & 3
+    return (r, g, b) if w == r else (r, g, b, w)
+
+
+def to_native(frame, offs):
+    bpp = len(offs)
+    out = bytearray(len(frame))
+    for c, o in enumerate(offs):
+        out[o::bpp] = frame[c::bpp]
+    return bytes(out)
+
+
+def from_native(frame, offs):
+    bpp = len(offs)
+    out = bytearray(len(frame))
+    for c, o in enumerate(offs):
+        out[c::bpp] = frame[o::bpp]
+    return bytes(out)
+
+
+def delta(prev, cur):
+    """Token stream turning prev into cur: skip and XOR-literal runs."""
+    x = bytes(a ^ b for a, b in zip(prev, cur))
+    end = len(x)
+    while end and not x[end - 1]:
+        end -= 1  # Trailing unchanged bytes need no token
+    out, i = bytearray(), 0
+    while i < end:
+        if not x[i]:
+            j = i
+            while j < end and not x[j]:
+                j += 1
+            run = j - i
+            while run:
+                k = min(run, 128)
+                out.append(k - 1)
+                run -= k
+        else:
+            # Literal; a lone unchanged byte between changes is cheaper to
+            # XOR with 0 than to split into skip + new literal token
+            j = i
+            while j < end and j - i < 128:
+                if x[j] or (j + 1 < end and x[j + 1]):
+                    j += 1
+                else:
+                    break
+            out.append(0x80 | (j - i - 1))
+            out += x[i:j]
+        i = j
+    return bytes(out)
+
+
+def apply_delta(frame, tokens):
+    frame, pos, i = bytearray(frame), 0, 0
+    while i < len(tokens):
+        c = tokens[i]
+        i += 1
+        if c & 0x80:
+            n = (c & 0x7F) + 1
+            for k in range(n):
+                frame[pos + k] ^= tokens[i + k]
+            i += n
+            pos += n
+        else:
+            pos += c + 1
+    return bytes(frame)
+
+
+def encode(args):
+    offs = offsets(order_byte(args.order))
+    if (len(offs) == 4) != args.rgbw:
+        sys.exit("--order and --rgbw disagree on bytes per pixel")
+    size = args.pixels * len(offs)
+    data = open(args.input, "rb").read()
+    if not data or len(data) % size:
+        sys.exit("input is not a whole number of %d-byte frames" % size)
+    if size > 0xFFFF:
+        sys.exit("frames over 65535 bytes aren't supported")
+    frames = [to_native(data[i:i + size], offs)
+              for i in range(0, len(data), size)]
+
+    out = bytearray(MAGIC)
+    out += struct.pack("<BBHII", VERSION, order_byte(args.order), args.pixels,
+                       len(frames), round(1000000 / args.fps))
+    counts = {KEYFRAME: 0, DELTA: 0, REPEAT: 0}
+    prev = None
+    for n, cur in enumerate(frames):
+        if prev is None or (args.keyframe and n % args.keyframe == 0):
+            kind, payload = KEYFRAME, cur
+        else:
+            payload = delta(prev, cur)
+            if not payload:
+                kind = REPEAT
+            elif len(payload) >= size:
+                kind, payload = KEYFRAME, cur
+            else:
+                kind = DELTA
+        counts[kind] += 1
+        out += kind + struct.pack("<H", len(payload)) + payload
+        prev = cur
+    open(args.output, "wb").write(out)
+    print("%d frames: %d keyframes, %d deltas, %d repeats; %d -> %d bytes "
+          "(%.1f%%), %.1f KB/s at %g fps"
+          % (len(frames), counts[KEYFRAME], counts[DELTA], counts[REPEAT],
+             len(data), len(out), 100.0 * len(out) / len(data),
+             len(out) / len(frames) * args.fps / 1024, args.fps),
+          file=sys.stderr)
+
+
+def read_file(path):
+    """Return (order, pixels, frame period us, [native frames])."""
+    data = open(path, "rb").read()
+    if data[:4] != MAGIC or data[4] != VERSION:
+        sys.exit("%s: not a version %d .npxa file" % (path, VERSION))
+    _, order, pixels, count, period = struct.unpack("<BBHII", data[4:16])
+    size = pixels * len(offsets(order))
+    frames, pos, frame = [], 16, bytes(size)
+    for _ in range(count):
+        kind = data[pos:pos + 1]
+        length = struct.unpack("<H", data[pos + 1:pos + 3])[0]
+        payload = data[pos + 3:pos + 3 + length]
+        pos += 3 + length
+        if kind == KEYFRAME:
+            frame = payload
+        elif kind == DELTA:
+            frame = apply_delta(frame, payload)
+        frames.append(frame)
+    return order, pixels, period, frames
+
+
+def decode(args):
+    order, _, _, frames = read_file(args.input)
+    offs = offsets(order)
+    with open(args.output, "wb") as f:
+        for frame in frames:
+            f.write(from_native(frame, offs))
+
+
+def info(args):
+    order, pixels, period, frames = read_file(args.input)
+    size = len(open(args.input, "rb").read())
+    print("%d pixels (%s), %d frames at %.2f fps, %d bytes (%.1f bytes/frame)"
+          % (pixels, "RGBW" if len(offsets(order)) == 4 else "RGB",
+             len(frames), 1000000.0 / period, size, size / len(frames)))
+
+
+def synth(args):
+    """Demo animation: a few comets with fading tails over a slow color
+    wash on one end of the strip. Mostly black, like most real shows."""
+    bpp = 4 if args.rgbw else 3
+    n = args.pixels
+    out = bytearray()
+    for f in range(args.frames):
+        frame = bytearray(n * bpp)
+        for p in range(n // 8):
+            hue = (f * 0.01 + p / n) % 1.0
+            for c in range(3):
+                v = 0.5 + 0.5 * math.sin(2 * math.pi * (hue + c / 3.0))
+                frame[p * bpp + c] = int(v * 64)
+        for k in range(3):
+            head = (f * (k + 1) + k * n // 3) % n
+            for t in range(12):
+                p = (head - t) % n
+                frame[p * bpp + k] = max(frame[p * bpp + k], 255 >> t)
+        out += frame
+    open(args.output, "wb").write(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="NeoPixel animation encoder")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    e = sub.add_parser("encode", help="raw frames -> .npxa")
+    e.add_argument("input")
+    e.add_argument("output")
+    e.add_argument("--pixels", type=int, required=True)
+    e.add_argument("--rgbw", action="store_true", help="4 bytes per pixel")
+    e.add_argument("--order", default=None,
+                   help="strip color order, default GRB (GRBW with --rgbw)")
+    e.add_argument("--fps", type=float, default=30.0)
+    e.add_argument("--keyframe", type=int, default=0, metavar="N",
+                   help="also store every Nth frame whole (0 = first only)")
+    d = sub.add_parser("decode", help=".npxa -> raw frames")
+    d.add_argument("input")
+    d.add_argument("output")
+    i = sub.add_parser("info", help="describe a .npxa file")
+    i.add_argument("input")
+    s = sub.add_parser("synth", help="write a demo raw animation")
+    s.add_argument("output")
+    s.add_argument("--pixels", type=int, required=True)
+    s.add_argument("--frames", type=int, default=300)
+    s.add_argument("--rgbw", action="store_true")
+    args = ap.parse_args()
+    if args.cmd == "encode" and args.order is None:
+        args.order = "GRBW" if args.rgbw else "GRB"
+    {"encode": encode, "decode": decode, "info": info, "synth": synth}[
+        args.cmd](args)
+
+
+if __name__ == "__main__":
+    main()
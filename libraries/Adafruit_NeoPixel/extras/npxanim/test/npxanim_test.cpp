@@ -0,0 +1,131 @@
+// Host test for the .npxa decoder used by Adafruit_NeoPixel_Player.
+// Decodes a file written by npxanim.py through NeoAnimDecoder, reading it
+// the way the player does, and checks every frame against the raw input.
+// Read sizes from 1 byte up exercise tokens and XOR runs split across
+// reads. Also checks that damaged files are rejected rather than
+// overrunning the frame buffer.
+//
+// Usage: npxanim_test file.npxa frames.raw   (see Makefile)
+
+#include "Adafruit_NeoPixel_AnimFormat.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+// Minimal stand-in for an SdFat/SD file: read() and seek() from memory
+struct MemFile {
+  const std::vector<uint8_t> &data;
+  size_t pos;
+  MemFile(const std::vector<uint8_t> &d) : data(d), pos(0) {}
+  int read(void *buf, size_t n) {
+    if (n > data.size() - pos)
+      n = data.size() - pos;
+    memcpy(buf, &data[pos], n);
+    pos += n;
+    return (int)n;
+  }
+  bool seek(size_t p) { return (p <= data.size()) ? (pos = p, true) : false; }
+};
+
+static std::vector<uint8_t> load(const char *path) {
+  std::vector<uint8_t> v;
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    exit(2);
+  }
+  int c;
+  while ((c = fgetc(f)) != EOF)
+    v.push_back(c);
+  fclose(f);
+  return v;
+}
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+// Decode the whole file; returns frames decoded (stops at first error)
+static uint32_t play(const std::vector<uint8_t> &file, uint16_t chunk,
+                     std::vector<uint8_t> &frame, const NeoAnimHeader &hdr,
+                     const std::vector<uint8_t> *raw) {
+  MemFile f(file);
+  NeoAnimDecoder dec;
+  std::vector<uint8_t> buf(chunk);
+  uint8_t bpp = hdr.bytesPerPixel(), offs[4];
+  offs[0] = (hdr.order >> 4) & 3; // R,G,B,W native offsets
+  offs[1] = (hdr.order >> 2) & 3;
+  offs[2] = hdr.order & 3;
+  offs[3] = (hdr.order >> 6) & 3;
+  uint16_t size = hdr.numPixels * bpp;
+  dec.begin(frame.data(), size);
+  f.seek(NEOANIM_HEADER_SIZE);
+  for (uint32_t n = 0; n < hdr.frameCount; n++) {
+    if (!dec.readRecord(f, buf.data(), chunk))
+      return n;
+    if (raw) { // Compare against raw R,G,B(,W) input
+      for (uint16_t i = 0; i < size; i++) {
+        uint8_t want = (*raw)[n * size + (i / bpp) * bpp + i % bpp];
+        uint8_t got = frame[(i / bpp) * bpp + offs[i % bpp]];
+        if (want != got) {
+          CHECK(false, "chunk %u frame %u byte %u: %u != %u", chunk, n, i,
+                want, got);
+          return n;
+        }
+      }
+    }
+  }
+  return hdr.frameCount;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s file.npxa frames.raw\n", argv[0]);
+    return 2;
+  }
+  std::vector<uint8_t> file = load(argv[1]), raw = load(argv[2]);
+  NeoAnimHeader hdr;
+  CHECK(hdr.parse(file.data()), "header");
+  uint16_t size = hdr.numPixels * hdr.bytesPerPixel();
+  CHECK(raw.size() == (size_t)size * hdr.frameCount, "raw size");
+  std::vector<uint8_t> frame(size);
+
+  const uint16_t chunks[] = {1, 2, 3, 7, 64, 129, 512, 4096};
+  for (uint16_t chunk : chunks)
+    CHECK(play(file, chunk, frame, hdr, &raw) == hdr.frameCount,
+          "chunk %u did not decode every frame", chunk);
+
+  // Truncated file: must stop with an error, not read garbage
+  std::vector<uint8_t> cut(file.begin(), file.end() - 5);
+  CHECK(play(cut, 64, frame, hdr, NULL) == hdr.frameCount - 1,
+        "truncated file not detected");
+
+  // Records that would write outside the frame must be refused
+  NeoAnimDecoder dec;
+  uint8_t tiny[100];
+  const uint8_t skip[] = {0x7F}, literal[] = {0xFF}, ok[] = {0x62, 0x80, 1};
+  dec.begin(tiny, sizeof(tiny));
+  CHECK(!dec.start(NEOANIM_KEYFRAME, 99), "short keyframe accepted");
+  CHECK(!dec.start('X', 0), "unknown record type accepted");
+  CHECK(dec.start(NEOANIM_DELTA, 1) && !dec.feed(skip, 1),
+        "skip past end accepted");
+  CHECK(dec.start(NEOANIM_DELTA, 1) && !dec.feed(literal, 1),
+        "XOR run past end accepted");
+  CHECK(dec.start(NEOANIM_DELTA, 2) && !dec.feed(ok, 3),
+        "more payload than record length accepted");
+  memset(tiny, 0, sizeof(tiny));
+  CHECK(dec.start(NEOANIM_DELTA, 3) && dec.feed(ok, 3) && dec.done() &&
+            (tiny[99] == 1),
+        "XOR of last byte");
+
+  printf("%s: %u frames, %u pixels, %zu bytes (%.1f%% of raw): %s\n", argv[1],
+         (unsigned)hdr.frameCount, hdr.numPixels, file.size(),
+         100.0 * file.size() / raw.size(), failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+// Host test and benchmark for the bit-plane transpose used by
+// Adafruit_NeoPixel_Parallel. Checks transpose8() against a naive
+// bit-at-a-time transpose for random and single-bit inputs, and
+// transposeFrame() the same way with some lanes missing (NULL). Then times
+// both per strip byte. On the host the group can't be driven in parallel,
+// so it also checks that show() falls back to each strip's own show(),
+// empty strips included.
+//
+// Usage: parallel_test   (see Makefile)
+
+#include "Adafruit_NeoPixel_Parallel.h"
+#include <stdio.h>
+#include <time.h>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+// The host build takes the ESP32 show() path; count what it's sent
+static int shows = 0;
+static uint32_t shownBytes = 0;
+extern "C" void espShow(uint16_t, uint8_t *, uint32_t numBytes, uint8_t) {
+  shows++;
+  shownBytes += numBytes;
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// planes[b] bit k = bit (7 - b) of lane k, one bit at a time
+static void naive8(const uint8_t in[8], uint8_t planes[8]) {
+  for (uint8_t b = 0; b < 8; b++) {
+    planes[b] = 0;
+    for (uint8_t k = 0; k < 8; k++) {
+      if (in[k] & (0x80 >> b))
+        planes[b] |= 1 << k;
+    }
+  }
+}
+
+static void naiveFrame(const uint8_t *const lanes[8], uint16_t nBytes,
+                       uint8_t *planes) {
+  uint8_t in[8];
+  for (uint16_t i = 0; i < nBytes; i++, planes += 8) {
+    for (uint8_t k = 0; k < 8; k++)
+      in[k] = lanes[k] ? lanes[k][i] : 0;
+    naive8(in, planes);
+  }
+}
+
+static void checkTranspose8(void) {
+  uint8_t in[8], got[8], want[8];
+  long bad = 0;
+
+  // every single set bit lands in exactly one place
+  for (uint8_t k = 0; k < 8; k++) {
+    for (uint8_t b = 0; b < 8; b++) {
+      memset(in, 0, sizeof(in));
+      in[k] = 1 << b;
+      Adafruit_NeoPixel_Parallel::transpose8(in, got);
+      naive8(in, want);
+      bad += memcmp(got, want, 8) != 0;
+    }
+  }
+  CHECK(!bad, "transpose8 moves %ld single bits wrongly", bad);
+
+  for (long r = 0; r < 1000000; r++) {
+    for (uint8_t k = 0; k < 8; k++)
+      in[k] = rand();
+    Adafruit_NeoPixel_Parallel::transpose8(in, got);
+    naive8(in, want);
+    bad += memcmp(got, want, 8) != 0;
+  }
+  CHECK(!bad, "transpose8 differs from naive for %ld random inputs", bad);
+}
+
+static void checkFrame(void) {
+  enum { N = 900 }; // 300 RGB pixels
+  static uint8_t buf[8][N], got[8 * N], want[8 * N];
+  const uint8_t *lanes[8];
+
+  for (uint8_t k = 0; k < 8; k++) {
+    for (int i = 0; i < N; i++)
+      buf[k][i] = rand();
+    lanes[k] = buf[k];
+  }
+  lanes[3] = NULL;
+  lanes[6] = NULL;
+
+  Adafruit_NeoPixel_Parallel::transposeFrame(lanes, N, got);
+  naiveFrame(lanes, N, want);
+  CHECK(!memcmp(got, want, sizeof(got)), "transposeFrame differs from naive");
+
+  const int R = 2000;
+  double t0 = now();
+  for (int r = 0; r < R; r++)
+    Adafruit_NeoPixel_Parallel::transposeFrame(lanes, N, got);
+  double t1 = now();
+  for (int r = 0; r < R; r++)
+    naiveFrame(lanes, N, want);
+  double t2 = now();
+
+  // bytes per lane times 8 lanes
+  printf("transposeFrame: %.2f ns per strip byte, naive %.2f\n",
+         (t1 - t0) / R / N / 8, (t2 - t1) / R / N / 8);
+  CHECK(!memcmp(got, want, sizeof(got)), "timed frames differ");
+}
+
+static void checkFallback(void) {
+  Adafruit_NeoPixel a(10, 2), b(0, 3), c(4, 4, NEO_GRBW + NEO_KHZ800);
+  Adafruit_NeoPixel_Parallel group;
+
+  CHECK(group.addStrip(a) && group.addStrip(b) && group.addStrip(c),
+        "addStrip");
+  CHECK(!group.begin() && !group.isParallel(),
+        "begin() claims parallel output on a host");
+
+  shows = 0;
+  shownBytes = 0;
+  group.show();
+  CHECK(shows == 3 && shownBytes == 10 * 3 + 4 * 4,
+        "fallback show() sent %d strips, %u bytes", shows, shownBytes);
+}
+
+int main(void) {
+  srand(1);
+
+  checkTranspose8();
+  checkFrame();
+  checkFallback();
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,39 @@
+// Just enough of Arduino.h to build the library on a host, for the tests
+// under extras/. The Makefiles define ESP32, so Adafruit_NeoPixel.cpp takes
+// the ESP32 path, where show() calls an external espShow(); each test
+// program defines espShow() to capture or drop the data.
+#ifndef ARDUINO_H_STUB
+#define ARDUINO_H_STUB
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#define ESP_IDF_VERSION 0 // before 5.0: no espInit()
+#define ESP_IDF_VERSION_VAL(major, minor, patch)                               \
+  (((major) << 16) | ((minor) << 8) | (patch))
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+
+typedef bool boolean;
+
+static inline void pinMode(int, int) {}
+static inline void digitalWrite(int, int) {}
+static inline void noInterrupts(void) {}
+static inline void interrupts(void) {}
+
+static inline unsigned long micros(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000UL + t.tv_nsec / 1000;
+}
+
+#endif
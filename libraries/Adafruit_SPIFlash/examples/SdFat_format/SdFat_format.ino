@@ -101,6 +101,10 @@ void setup() {
 
   Serial.println(F("Adafruit SPI Flash FatFs Format Example"));
 
+  // Uncomment to format for the flash translation layer. Sketches using the
+  // filesystem must then call flash.setFTL(true) before flash.begin() too.
+  // flash.setFTL(true);
+
   // Initialize flash library and check its chip ID.
   if (!flash.begin()) {
     Serial.println(F("Error, failed to initialize flash chip!"));
@@ -192,7 +196,7 @@ DRESULT disk_ioctl(BYTE pdrv, /* Physical drive nmuber (0..) */
     return RES_OK;
 
   case GET_SECTOR_COUNT:
-    *((DWORD *)buff) = flash.size() / 512;
+    *((DWORD *)buff) = flash.sectorCount();
     return RES_OK;
 
   case GET_SECTOR_SIZE:
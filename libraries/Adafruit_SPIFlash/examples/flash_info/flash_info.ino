@@ -44,6 +44,7 @@ Adafruit_SPIFlash flash(&flashTransport);
         .supports_fast_read = true, .supports_qspi = true,                   \
         .supports_qspi_writes = false, .write_status_register_split = false, \
         .single_status_byte = false, .is_fram = false,                       \
+        .supports_block32_erase = true,                                      \
       }
  */
 
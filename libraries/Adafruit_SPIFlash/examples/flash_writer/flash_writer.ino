@@ -0,0 +1,85 @@
+// The MIT License (MIT)
+// Copyright (c) 2019 Ha Thach for Adafruit Industries
+
+// Log records to a region of raw flash with Adafruit_FlashWriter, which
+// erases the region ahead of the data with the largest erases that fit and
+// gathers the records into whole pages.
+//
+// !! This overwrites the region set below, don't run it on a flash with a
+// filesystem you want to keep !!
+
+#include "SdFat_Adafruit_Fork.h"
+#include <SPI.h>
+
+#include "Adafruit_SPIFlash.h"
+
+// for flashTransport definition
+#include "flash_config.h"
+
+Adafruit_SPIFlash flash(&flashTransport);
+Adafruit_FlashWriter writer(&flash);
+
+#define LOG_ADDR 0x10000      // start of the log region
+#define LOG_SIZE (128 * 1024) // size of the log region
+
+typedef struct {
+  uint32_t ms;
+  uint32_t count;
+  int32_t value[6];
+} record_t;
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) {
+    delay(100); // wait for native usb
+  }
+
+  if (!flash.begin()) {
+    Serial.println("Error, failed to initialize flash chip!");
+    while (1) {
+      yield();
+    }
+  }
+
+  Serial.println("Adafruit Serial Flash Writer example");
+
+  if (!writer.begin(LOG_ADDR, LOG_SIZE)) {
+    Serial.println("Log region doesn't fit the flash");
+    while (1) {
+      yield();
+    }
+  }
+
+  uint32_t const start = millis();
+  record_t rec;
+  uint32_t count = 0;
+
+  // the flash programs each page while the next records are gathered
+  do {
+    rec.ms = millis();
+    rec.count = count++;
+    for (int i = 0; i < 6; i++) {
+      rec.value[i] = (int32_t)micros() * (i + 1);
+    }
+  } while (writer.write(&rec, sizeof(rec)) == sizeof(rec));
+
+  writer.end();
+
+  uint32_t const ms = millis() - start;
+
+  Serial.print("Logged ");
+  Serial.print(count - 1);
+  Serial.print(" records in ");
+  Serial.print(ms);
+  Serial.println(" ms");
+
+  // check the last full record
+  uint32_t const last = LOG_ADDR + (count - 2) * sizeof(record_t);
+  flash.readBuffer(last, (uint8_t *)&rec, sizeof(rec));
+  Serial.print("Last record count = ");
+  Serial.println(rec.count);
+}
+
+void loop() {
+  // nothing to do
+}
@@ -0,0 +1,250 @@
+// Host test for Adafruit_FlashCache, on a RAM-backed transport that behaves
+// like NOR flash (ram_transport.h). Checks that:
+// - a sector whose new data only clears bits is programmed without an erase
+// - a sector written back unchanged costs no erase or program
+// - after an erase, pages that are all 0xff aren't programmed
+// - the least recently written sector is the one evicted
+// - whole 32KB/64KB blocks bypass the cache and replace cached copies, and
+//   32KB erases are only sent to devices that support them
+// - a random FAT-like workload reads back and ends up on flash exactly as
+//   a plain byte array model says
+// Built with SPIFLASH_CACHE_SECTORS=1 (the default) and 2.
+//
+// Usage: cache_test   (see Makefile)
+
+#include "Adafruit_FlashCache.h"
+#include "Adafruit_SPIFlashBase.h"
+#include "ram_transport.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static RamTransport ram;
+static Adafruit_SPIFlashBase flash(&ram);
+static uint8_t model[RamTransport::SIZE];
+
+static bool flashIs(uint32_t addr, uint8_t const *data, uint32_t len) {
+  return !memcmp(ram.mem + addr, data, len);
+}
+
+static void programWithoutErase(void) {
+  Adafruit_FlashCache cache;
+  uint32_t const addr = 0x10000;
+
+  memset(ram.mem + addr, 0xa5, 4096);
+  ram.resetCounts();
+
+  // 0xa5 -> 0x21 only clears bits
+  uint8_t v = 0x21;
+  cache.write(&flash, addr + 300, &v, 1);
+  cache.sync(&flash);
+
+  CHECK(ram.erases == 0, "clearing bits erased %u times", ram.erases);
+  CHECK(ram.programs == 1, "clearing bits in one page took %u programs",
+        ram.programs);
+  CHECK(ram.mem[addr + 300] == 0x21, "cleared byte reads 0x%02x",
+        ram.mem[addr + 300]);
+}
+
+static void unchangedSector(void) {
+  Adafruit_FlashCache cache;
+  uint32_t const addr = 0x11000;
+  uint8_t buf[512];
+
+  for (uint32_t i = 0; i < 4096; i++) {
+    ram.mem[addr + i] = (uint8_t)(i * 7);
+  }
+  memcpy(buf, ram.mem + addr + 1024, sizeof(buf));
+  ram.resetCounts();
+
+  cache.write(&flash, addr + 1024, buf, sizeof(buf));
+  cache.sync(&flash);
+
+  CHECK(ram.erases == 0 && ram.programs == 0,
+        "unchanged sector took %u erases, %u programs", ram.erases,
+        ram.programs);
+}
+
+static void skipErasedPages(void) {
+  Adafruit_FlashCache cache;
+  uint32_t const addr = 0x12000;
+  uint8_t page[256];
+
+  // old data everywhere, new data is 0xff except for one page that needs
+  // a bit set, so the sector has to be erased
+  memset(ram.mem + addr, 0x00, 4096);
+  memset(page, 0x5a, sizeof(page));
+  ram.resetCounts();
+
+  uint8_t ff[4096];
+  memset(ff, 0xff, sizeof(ff));
+  cache.write(&flash, addr, ff, 1024);
+  cache.write(&flash, addr + 1024, page, sizeof(page));
+  cache.write(&flash, addr + 1280, ff, 4096 - 1280);
+  cache.sync(&flash);
+
+  CHECK(ram.erases == 1, "sector needing an erase erased %u times",
+        ram.erases);
+  CHECK(ram.programs == 1, "one non-0xff page took %u programs",
+        ram.programs);
+  CHECK(flashIs(addr, ff, 1024) && flashIs(addr + 1024, page, 256) &&
+            flashIs(addr + 1280, ff, 4096 - 1280),
+        "erased sector contents wrong");
+}
+
+static void leastRecentlyWritten(void) {
+  Adafruit_FlashCache cache;
+  uint32_t const a = 0x20000, b = 0x21000, c = 0x22000;
+
+  memset(ram.mem + a, 0xff, 3 * 4096);
+  ram.resetCounts();
+
+  uint8_t va = 0x0a, vb = 0x0b, vc = 0x0c;
+  cache.write(&flash, a, &va, 1);
+  cache.write(&flash, b, &vb, 1);
+  cache.write(&flash, a + 1, &va, 1); // a is now the most recent
+  cache.write(&flash, c, &vc, 1);
+
+#if SPIFLASH_CACHE_SECTORS == 1
+  // every switch of sector writes the previous one back
+  CHECK(ram.mem[a] == 0x0a && ram.mem[a + 1] == 0x0a && ram.mem[b] == 0x0b,
+        "one slot: a and b not written back on switching sector");
+  CHECK(ram.mem[c] == 0xff, "one slot: c written back before sync");
+#elif SPIFLASH_CACHE_SECTORS == 2
+  CHECK(ram.mem[b] == 0x0b, "two slots: b wasn't evicted for c");
+  CHECK(ram.mem[a] == 0xff && ram.mem[c] == 0xff,
+        "two slots: a or c written back before sync");
+  CHECK(ram.programs == 1, "two slots: %u programs before sync",
+        ram.programs);
+#endif
+
+  // reads see the cached data whether or not it has been written back
+  uint8_t rd[3 * 4096];
+  cache.read(&flash, a, rd, sizeof(rd));
+  CHECK(rd[0] == 0x0a && rd[1] == 0x0a && rd[4096] == 0x0b &&
+            rd[8192] == 0x0c,
+        "read across cached sectors wrong");
+
+  cache.sync(&flash);
+  CHECK(ram.mem[a] == 0x0a && ram.mem[a + 1] == 0x0a && ram.mem[b] == 0x0b &&
+            ram.mem[c] == 0x0c,
+        "sectors not on flash after sync");
+  CHECK(ram.erases == 0, "writes into erased sectors erased %u times",
+        ram.erases);
+}
+
+static void bulkBypass(Adafruit_SPIFlashBase &fl,
+                       RamTransport::Block32 block32, unsigned expected_erases,
+                       const char *name) {
+  Adafruit_FlashCache cache;
+  uint32_t const addr = 0x40000, len = 0x18000; // 96KB: one 64KB + one 32KB
+  static uint8_t data[0x18000];
+
+  ram.block32 = block32;
+  for (uint32_t i = 0; i < len; i++) {
+    data[i] = (uint8_t)rand();
+  }
+  memset(ram.mem + addr, 0x00, len);
+  ram.resetCounts();
+
+  // a cached sector inside the block must not be written back over it
+  uint8_t v = 0x77;
+  cache.write(&fl, addr + 0x9000, &v, 1);
+  cache.write(&fl, addr, data, len);
+  cache.sync(&fl);
+
+  CHECK(flashIs(addr, data, len), "bulk write (%s) contents wrong", name);
+  CHECK(ram.erases == expected_erases, "bulk write (%s) took %u erases", name,
+        ram.erases);
+  ram.block32 = RamTransport::BLOCK32_ERASES;
+}
+
+// Random mix of data appends, FAT entry updates, identical rewrites, reads
+// and syncs, checked against a byte array
+static void randomWorkload(void) {
+  Adafruit_FlashCache cache;
+  uint8_t blk[512];
+  static uint8_t rd[8192];
+
+  srand(1);
+  memset(model, 0xff, sizeof(model));
+  memset(model + 4096, 0, 4096);
+  for (uint32_t i = 64 * 1024; i < 1024 * 1024; i++) {
+    model[i] = (uint8_t)rand();
+  }
+  memcpy(ram.mem, model, sizeof(model));
+  ram.resetCounts();
+
+  uint32_t data = 64 * 1024;
+  for (int n = 0; n < 4000; n++) {
+    int const op = rand() % 10;
+    if (op < 4) {
+      for (int i = 0; i < 512; i++) {
+        blk[i] = (uint8_t)rand();
+      }
+      cache.write(&flash, data, blk, 512);
+      memcpy(model + data, blk, 512);
+      data += 512;
+      if (data >= 1024 * 1024) {
+        data = 64 * 1024;
+      }
+    } else if (op < 7) {
+      // FAT entry update, half of them only clearing bits
+      uint32_t const a = 4096 + rand() % 4096;
+      uint8_t const v = (rand() & 1) ? (model[a] & rand()) : rand();
+      cache.write(&flash, a, &v, 1);
+      model[a] = v;
+    } else if (op < 8) {
+      cache.write(&flash, 8192, model + 8192, 512);
+    } else if (op < 9) {
+      uint32_t const a = rand() % (1024 * 1024);
+      uint32_t const l = 1 + rand() % 8192;
+      cache.read(&flash, a, rd, l);
+      CHECK(!memcmp(rd, model + a, l), "read %u bytes at 0x%x wrong", l, a);
+    } else {
+      cache.sync(&flash);
+    }
+  }
+  cache.sync(&flash);
+
+  CHECK(!memcmp(ram.mem, model, sizeof(model)), "flash differs from model");
+  printf("workload: %u erases, %u programs, %u bytes read\n", ram.erases,
+         ram.programs, ram.readBytes);
+}
+
+int main(void) {
+  printf("SPIFLASH_CACHE_SECTORS=%d\n", SPIFLASH_CACHE_SECTORS);
+  if (!flash.begin()) {
+    printf("FAIL: begin\n");
+    return 1;
+  }
+
+  programWithoutErase();
+  unchangedSector();
+  skipErasedPages();
+  leastRecentlyWritten();
+  bulkBypass(flash, RamTransport::BLOCK32_ERASES, 2, "32KB erase");
+  bulkBypass(flash, RamTransport::BLOCK32_REFUSED, 9, "32KB refused");
+
+  // a device without 0x52 must not be sent it, as over SPI it would seem to
+  // work but leave the block as it was
+  SPIFlash_Device_t no_block32 = W25Q16JV_IQ;
+  no_block32.supports_block32_erase = false;
+  Adafruit_SPIFlashBase plain(&ram);
+  CHECK(plain.begin(&no_block32, 1), "begin without 32KB erase");
+  bulkBypass(plain, RamTransport::BLOCK32_IGNORED, 9, "no 32KB erase");
+  randomWorkload();
+
+  CHECK(ram.violations == 0, "%u transport violations", ram.violations);
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+// A FlashTransport backed by RAM that behaves like NOR flash: erases set
+// bytes to 0xff, programs can only clear bits, and both need a write
+// enable first. Counts erases, page programs and bytes read, and counts
+// any misuse (no write enable, a program crossing a page, an unknown erase
+// command) as a violation. Programs can be made to fail after a number of
+// them. The JEDEC ID is a W25Q16 (2MB).
+
+#ifndef RAM_TRANSPORT_H_
+#define RAM_TRANSPORT_H_
+
+#include "Adafruit_FlashTransport.h"
+#include <stdio.h>
+#include <string.h>
+
+class RamTransport : public Adafruit_FlashTransport {
+public:
+  enum { SIZE = 2 * 1024 * 1024 };
+
+  uint8_t mem[SIZE];
+  unsigned erases, programs, readBytes, violations;
+  unsigned block32Erases; // 0x52 commands received, whatever they did
+
+  // What a 32KB erase (0x52) does: erase, be refused as the nRF QSPI
+  // transport does, or be sent and return true but erase nothing, as over
+  // SPI to a device without the command
+  enum Block32 { BLOCK32_ERASES, BLOCK32_REFUSED, BLOCK32_IGNORED } block32;
+
+  // programs that succeed before the rest return false, -1 for all
+  long programsLeft;
+
+  RamTransport()
+      : violations(0), block32(BLOCK32_ERASES), programsLeft(-1),
+        _wel(false) {
+    memset(mem, 0xff, SIZE);
+    resetCounts();
+  }
+
+  void resetCounts(void) { erases = programs = readBytes = block32Erases = 0; }
+
+  void begin(void) {}
+  void end(void) {}
+  bool supportQuadMode(void) { return false; }
+  void setClockSpeed(uint32_t, uint32_t) {}
+
+  bool runCommand(uint8_t command) {
+    if (command == SFLASH_CMD_WRITE_ENABLE) {
+      _wel = true;
+    } else if (command == SFLASH_CMD_WRITE_DISABLE) {
+      _wel = false;
+    }
+    return true;
+  }
+
+  bool readCommand(uint8_t command, uint8_t *response, uint32_t len) {
+    memset(response, 0, len);
+    if (command == SFLASH_CMD_READ_JEDEC_ID && len >= 3) {
+      response[0] = 0xEF;
+      response[1] = 0x40;
+      response[2] = 0x15;
+    } else if (command == SFLASH_CMD_READ_STATUS) {
+      response[0] = _wel ? 0x02 : 0x00;
+    }
+    return true;
+  }
+
+  bool writeCommand(uint8_t, uint8_t const *, uint32_t) { return true; }
+
+  bool eraseCommand(uint8_t command, uint32_t address) {
+    uint32_t size;
+    switch (command) {
+    case SFLASH_CMD_ERASE_SECTOR:
+      size = 4096;
+      break;
+    case SFLASH_CMD_ERASE_BLOCK32:
+      block32Erases++;
+      if (block32 == BLOCK32_REFUSED) {
+        return false;
+      }
+      if (block32 == BLOCK32_IGNORED) {
+        _wel = false;
+        return true;
+      }
+      size = 32768;
+      break;
+    case SFLASH_CMD_ERASE_BLOCK:
+      size = 65536;
+      break;
+    case SFLASH_CMD_ERASE_CHIP:
+      size = SIZE;
+      break;
+    default:
+      return problem("unknown erase command 0x%02x", command);
+    }
+    if (!_wel) {
+      return problem("erase at 0x%x without write enable", address);
+    }
+    address &= ~(size - 1);
+    memset(mem + address, 0xff, size);
+    erases++;
+    _wel = false;
+    return true;
+  }
+
+  bool readMemory(uint32_t addr, uint8_t *buffer, uint32_t len) {
+    memcpy(buffer, mem + addr, len);
+    readBytes += len;
+    return true;
+  }
+
+  bool writeMemory(uint32_t addr, uint8_t const *data, uint32_t len) {
+    if (!_wel) {
+      return problem("program at 0x%x without write enable", addr);
+    }
+    if ((addr & 255) + len > 256) {
+      return problem("program at 0x%x, %u bytes crosses a page", addr, len);
+    }
+    if (programsLeft == 0) {
+      _wel = false;
+      return false;
+    }
+    if (programsLeft > 0) {
+      programsLeft--;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+      mem[addr + i] &= data[i];
+    }
+    programs++;
+    _wel = false;
+    return true;
+  }
+
+private:
+  bool _wel;
+
+  bool problem(const char *fmt, unsigned a, unsigned b = 0) {
+    printf("transport: ");
+    printf(fmt, a, b);
+    printf("\n");
+    violations++;
+    return false;
+  }
+};
+
+#endif
@@ -0,0 +1,26 @@
+// Just enough of Arduino.h to build the flash sources on a host
+#ifndef ARDUINO_H_STUB
+#define ARDUINO_H_STUB
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define MSBFIRST 1
+#define SPI_MODE0 0
+#define F_CPU 120000000UL
+
+template <class T> T min(T a, T b) { return a < b ? a : b; }
+template <class T> T max(T a, T b) { return a > b ? a : b; }
+
+static inline void digitalWrite(int, int) {}
+static inline void pinMode(int, int) {}
+static inline void delay(int) {}
+static inline void delayMicroseconds(int) {}
+static inline void yield(void) {}
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef SPI_H_STUB
+#define SPI_H_STUB
+
+#include "Arduino.h"
+
+struct SPISettings {
+  SPISettings(uint32_t, int, int) {}
+};
+
+struct SPIClass {
+  void beginTransaction(SPISettings) {}
+  void endTransaction(void) {}
+};
+
+#endif
@@ -0,0 +1 @@
+// nothing needed on a host
@@ -0,0 +1,191 @@
+// A FlashTransport backed by a file that behaves like NOR flash: erases set
+// bytes to 0xff, programs can only clear bits, and both need a write enable
+// first. The image outlives the transport, so a test can remount it.
+//
+// Setting 'cut' to n simulates a power loss: the n+1'th erase or program
+// from then on is done only partly (the bytes after a random point are left
+// half erased, or one byte half programmed) and PowerCut is thrown.
+// The JEDEC ID is a W25Q16 (2MB).
+
+#ifndef FILE_TRANSPORT_H_
+#define FILE_TRANSPORT_H_
+
+#include "Adafruit_FlashTransport.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+struct PowerCut {};
+
+class FileTransport : public Adafruit_FlashTransport {
+public:
+  enum { SIZE = 2 * 1024 * 1024 };
+
+  unsigned long erases, programs, readBytes, violations;
+  long cut;
+
+  // last erase or program started, 'E' or 'P'
+  char lastOp;
+  uint32_t lastAddr;
+
+  // fresh: start from an erased image instead of what's in the file
+  FileTransport(const char *path, bool fresh)
+      : violations(0), cut(-1), lastOp(0), lastAddr(0), _wel(false) {
+    _fd = open(path, O_RDWR | O_CREAT | (fresh ? O_TRUNC : 0), 0644);
+    if (fresh) {
+      std::vector<uint8_t> ff(SIZE, 0xff);
+      put(0, ff.data(), SIZE);
+    }
+    resetCounts();
+  }
+  ~FileTransport() { close(_fd); }
+
+  bool ok(void) { return _fd >= 0; }
+  void resetCounts(void) { erases = programs = readBytes = 0; }
+
+  // what the chip does at power up
+  void powerUp(void) { _wel = false; }
+
+  void begin(void) {}
+  void end(void) {}
+  bool supportQuadMode(void) { return false; }
+  void setClockSpeed(uint32_t, uint32_t) {}
+
+  bool runCommand(uint8_t command) {
+    if (command == SFLASH_CMD_WRITE_ENABLE) {
+      _wel = true;
+    } else if (command == SFLASH_CMD_WRITE_DISABLE) {
+      _wel = false;
+    }
+    return true;
+  }
+
+  bool readCommand(uint8_t command, uint8_t *response, uint32_t len) {
+    memset(response, 0, len);
+    if (command == SFLASH_CMD_READ_JEDEC_ID && len >= 3) {
+      response[0] = 0xEF;
+      response[1] = 0x40;
+      response[2] = 0x15;
+    } else if (command == SFLASH_CMD_READ_STATUS) {
+      response[0] = _wel ? 0x02 : 0x00;
+    }
+    return true;
+  }
+
+  bool writeCommand(uint8_t, uint8_t const *, uint32_t) { return true; }
+
+  bool eraseCommand(uint8_t command, uint32_t address) {
+    uint32_t size;
+    switch (command) {
+    case SFLASH_CMD_ERASE_SECTOR:
+      size = 4096;
+      break;
+    case SFLASH_CMD_ERASE_BLOCK32:
+      size = 32768;
+      break;
+    case SFLASH_CMD_ERASE_BLOCK:
+      size = 65536;
+      break;
+    case SFLASH_CMD_ERASE_CHIP:
+      size = SIZE;
+      break;
+    default:
+      return problem("unknown erase command", command);
+    }
+    if (!_wel) {
+      return problem("erase without write enable", address);
+    }
+    address &= ~(size - 1);
+    lastOp = 'E';
+    lastAddr = address;
+
+    bool const torn = powerFails();
+    uint32_t const n = torn ? rand() % size : size;
+    std::vector<uint8_t> buf(size);
+    get(address, buf.data(), size);
+    memset(buf.data(), 0xff, n);
+    for (uint32_t i = n; i < size; i++) {
+      buf[i] |= rand(); // half erased
+    }
+    put(address, buf.data(), size);
+    if (torn) {
+      throw PowerCut();
+    }
+    erases++;
+    _wel = false;
+    return true;
+  }
+
+  bool readMemory(uint32_t addr, uint8_t *buffer, uint32_t len) {
+    get(addr, buffer, len);
+    readBytes += len;
+    return true;
+  }
+
+  bool writeMemory(uint32_t addr, uint8_t const *data, uint32_t len) {
+    if (!_wel) {
+      return problem("program without write enable", addr);
+    }
+    if ((addr & 255) + len > 256) {
+      return problem("program crossing a page", addr);
+    }
+    lastOp = 'P';
+    lastAddr = addr;
+
+    bool const torn = powerFails();
+    uint32_t const n = torn ? rand() % len : len;
+    std::vector<uint8_t> buf(len);
+    get(addr, buf.data(), len);
+    for (uint32_t i = 0; i < n; i++) {
+      buf[i] &= data[i];
+    }
+    if (n < len) {
+      buf[n] &= data[n] | rand(); // half programmed
+    }
+    put(addr, buf.data(), len);
+    if (torn) {
+      throw PowerCut();
+    }
+    programs++;
+    _wel = false;
+    return true;
+  }
+
+private:
+  int _fd;
+  bool _wel;
+
+  bool powerFails(void) {
+    if (cut == 0) {
+      cut = -1;
+      return true;
+    }
+    if (cut > 0) {
+      cut--;
+    }
+    return false;
+  }
+
+  void get(uint32_t addr, uint8_t *buf, uint32_t len) {
+    if (pread(_fd, buf, len, addr) != (ssize_t)len) {
+      problem("short read", addr);
+    }
+  }
+
+  void put(uint32_t addr, uint8_t const *buf, uint32_t len) {
+    if (pwrite(_fd, buf, len, addr) != (ssize_t)len) {
+      problem("short write", addr);
+    }
+  }
+
+  bool problem(const char *what, uint32_t value) {
+    printf("transport: %s (0x%x)\n", what, value);
+    violations++;
+    return false;
+  }
+};
+
+#endif
@@ -0,0 +1,100 @@
+// Compares Adafruit_FlashFTL with the sector cache (Adafruit_FlashCache,
+// synced every 4 writes) on a full 2MB flash, for a FAT-like mix of 512-byte
+// writes and for uniformly random ones. Prints erases and page programs per
+// write, and a time per write estimated from W25Q16JV typical timings: page
+// program 0.4 ms, 4KB erase 45 ms, reads at 4 MB/s (32 MHz SPI).
+//
+// Usage: ftl_bench   (see Makefile)
+
+#include "Adafruit_FlashCache.h"
+#include "Adafruit_FlashFTL.h"
+#include "Adafruit_SPIFlashBase.h"
+#include "file_transport.h"
+
+static const char *IMAGE = "ftl_bench.img";
+static const int WRITES = 20000;
+
+static uint32_t dataPtr;
+
+static uint32_t nextSector(uint32_t n, bool random) {
+  if (random) {
+    return rand() % n;
+  }
+  int const op = rand() % 10;
+  if (op < 5) {
+    return rand() % 48;
+  }
+  if (op < 9) {
+    uint32_t const s = 48 + dataPtr;
+    dataPtr = (dataPtr + 1) % (n - 48);
+    return s;
+  }
+  return rand() % n;
+}
+
+static double estimateMs(FileTransport &t) {
+  return t.programs * 0.4 + t.erases * 45.0 + t.readBytes / 4000.0;
+}
+
+static void run(bool random, bool use_ftl) {
+  FileTransport t(IMAGE, true);
+  Adafruit_SPIFlashBase fl(&t);
+  Adafruit_FlashFTL ftl;
+  static Adafruit_FlashCache cache;
+  uint8_t buf[512];
+
+  srand(7);
+  dataPtr = 0;
+  fl.begin();
+  ftl.begin(&fl);
+
+  // the same number of sectors for both, with every one written once
+  uint32_t const n = ftl.sectorCount();
+  for (uint32_t s = 0; s < n; s++) {
+    for (int i = 0; i < 512; i++) {
+      buf[i] = rand();
+    }
+    if (use_ftl) {
+      ftl.write(s, buf, 1);
+    } else {
+      cache.write(&fl, s * 512, buf, 512);
+    }
+  }
+  cache.sync(&fl);
+  t.resetCounts();
+
+  for (int i = 0; i < WRITES; i++) {
+    uint32_t const s = nextSector(n, random);
+    for (int j = 0; j < 512; j++) {
+      buf[j] = rand();
+    }
+    if (use_ftl) {
+      ftl.write(s, buf, 1);
+    } else {
+      cache.write(&fl, s * 512, buf, 512);
+      if (i % 4 == 3) {
+        cache.sync(&fl);
+      }
+    }
+  }
+  cache.sync(&fl);
+
+  printf("%s %-5s: %.3f erases/write, %.2f programs/write, %.1f ms/write",
+         random ? "random" : "FAT   ", use_ftl ? "FTL" : "cache",
+         (double)t.erases / WRITES, (double)t.programs / WRITES,
+         estimateMs(t) / WRITES);
+  if (use_ftl) {
+    uint32_t lo, hi;
+    ftl.getWear(&lo, &hi);
+    printf(", wear %u..%u", lo, hi);
+  }
+  printf("\n");
+}
+
+int main(void) {
+  for (int random = 0; random < 2; random++) {
+    run(random, false);
+    run(random, true);
+  }
+  return 0;
+}
@@ -0,0 +1,211 @@
+// Host test for Adafruit_FlashFTL, on a file-backed transport that behaves
+// like NOR flash (file_transport.h). Runs a FAT-like mix of writes (half to
+// the first 48 sectors, most of the rest appending file data) and checks:
+// - every sector reads back as last written, also after remounting
+// - the map and live slot counts match the slot headers on flash
+// - after a power cut part way through any erase or program, a remount
+//   finds every sector as last written, except the one being written,
+//   which may have either its old or its new data
+//
+// Includes Adafruit_FlashFTL.cpp to get at its layout and private state.
+//
+// Usage: ftl_test [power cut rounds] [seed]   (see Makefile)
+
+#define private public
+#include "Adafruit_FlashFTL.h"
+#undef private
+#include "Adafruit_FlashFTL.cpp"
+
+#include "file_transport.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static const char *IMAGE = "ftl_test.img";
+
+static std::vector<std::vector<uint8_t> > model;
+static uint32_t dataPtr;
+
+static uint32_t nextSector(uint32_t n) {
+  int const op = rand() % 10;
+  if (op < 5) {
+    return rand() % 48; // FAT and directory
+  }
+  if (op < 9) {
+    uint32_t const s = 48 + dataPtr; // file data
+    dataPtr = (dataPtr + 1) % (n - 48);
+    return s;
+  }
+  return rand() % n;
+}
+
+static void fill(uint8_t *buf, uint32_t sector) {
+  uint32_t const r = rand();
+  for (int i = 0; i < 512; i++) {
+    buf[i] = (uint8_t)(sector * 7 + r + i * (r & 15));
+  }
+  if (rand() % 4 == 0) {
+    memset(buf + 256, 0, 256);
+  }
+}
+
+// Map entries point at slots whose header names that sector, and each
+// block's live count is the number of map entries in it
+static bool consistent(Adafruit_SPIFlashBase &fl, Adafruit_FlashFTL &ftl) {
+  std::vector<int> live(ftl._blocks, 0);
+
+  for (uint32_t s = 0; s < ftl._sectors; s++) {
+    uint16_t const slot = ftl._map[s];
+    if (slot == FTL_UNMAPPED) {
+      continue;
+    }
+    ftl_slot_hdr_t hdr;
+    fl.readBuffer(slot_hdr_addr(slot), (uint8_t *)&hdr, sizeof(hdr));
+    if (hdr.sector != s) {
+      printf("sector %u maps to slot %u, whose header says %u\n", s, slot,
+             hdr.sector);
+      return false;
+    }
+    live[slot / FTL_SLOTS]++;
+  }
+
+  for (uint16_t b = 0; b < ftl._blocks; b++) {
+    if (live[b] != ftl._valid[b]) {
+      printf("block %u has %d live slots, counted %u\n", b, live[b],
+             ftl._valid[b]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Every sector matches the model. 'pending' is a sector whose write was cut
+// short, it may hold either the old data or 'pending_data'.
+static bool matches(Adafruit_FlashFTL &ftl, long pending = -1,
+                    uint8_t const *pending_data = NULL) {
+  uint8_t buf[512];
+
+  for (uint32_t s = 0; s < ftl.sectorCount(); s++) {
+    ftl.read(s, buf, 1);
+    if (!memcmp(buf, model[s].data(), 512)) {
+      continue;
+    }
+    if ((long)s == pending && !memcmp(buf, pending_data, 512)) {
+      memcpy(model[s].data(), buf, 512);
+      continue;
+    }
+    printf("sector %u differs\n", s);
+    return false;
+  }
+  return true;
+}
+
+static void functional(void) {
+  FileTransport t(IMAGE, true);
+  Adafruit_SPIFlashBase fl(&t);
+  Adafruit_FlashFTL ftl;
+
+  CHECK(t.ok() && fl.begin() && ftl.begin(&fl), "begin");
+  if (failures) {
+    return;
+  }
+
+  uint32_t const n = ftl.sectorCount();
+  printf("%u sectors (%u KB of %u KB)\n", n, n / 2, fl.size() / 1024);
+  model.assign(n, std::vector<uint8_t>(512, 0xff));
+
+  uint8_t buf[512];
+  for (int i = 0; i < 60000; i++) {
+    uint32_t const s = nextSector(n);
+    fill(buf, s);
+    if (!ftl.write(s, buf, 1)) {
+      CHECK(false, "write %d failed", i);
+      return;
+    }
+    memcpy(model[s].data(), buf, 512);
+
+    if (i % 20000 == 19999) {
+      Adafruit_FlashFTL remount;
+      CHECK(remount.begin(&fl) && matches(remount) &&
+                consistent(fl, remount),
+            "remount after %d writes", i + 1);
+    }
+  }
+  CHECK(matches(ftl) && consistent(fl, ftl), "after 60000 writes");
+
+  uint32_t lo, hi;
+  ftl.getWear(&lo, &hi);
+  printf("60000 writes: %lu erases, %lu programs, wear %u..%u\n", t.erases,
+         t.programs, lo, hi);
+  CHECK(t.violations == 0, "%lu transport violations", t.violations);
+}
+
+// Carries on from the image functional() left
+static void powerLoss(int rounds) {
+  FileTransport t(IMAGE, false);
+  Adafruit_SPIFlashBase fl(&t);
+  uint8_t buf[512];
+  int cuts = 0;
+
+  CHECK(t.ok() && fl.begin(), "begin");
+
+  for (int round = 0; round < rounds && !failures; round++) {
+    Adafruit_FlashFTL ftl;
+    if (!ftl.begin(&fl)) {
+      CHECK(false, "mount failed after %d cuts", cuts);
+      return;
+    }
+    uint32_t const n = ftl.sectorCount();
+    long pending = -1;
+
+    t.cut = rand() % 400;
+    try {
+      for (int i = 0; i < 1000; i++) {
+        uint32_t const s = nextSector(n);
+        fill(buf, s);
+        pending = s;
+        if (!ftl.write(s, buf, 1)) {
+          CHECK(false, "write failed after %d cuts", cuts);
+          return;
+        }
+        memcpy(model[s].data(), buf, 512);
+        pending = -1;
+      }
+      t.cut = -1;
+      CHECK(consistent(fl, ftl), "round %d", round);
+    } catch (PowerCut &) {
+      cuts++;
+      t.powerUp();
+
+      Adafruit_FlashFTL remount;
+      CHECK(remount.begin(&fl) && matches(remount, pending, buf) &&
+                consistent(fl, remount),
+            "power cut %d, during %s at 0x%x", cuts,
+            t.lastOp == 'E' ? "erase" : "program", t.lastAddr);
+    }
+  }
+
+  printf("%d power cuts\n", cuts);
+  CHECK(t.violations == 0, "%lu transport violations", t.violations);
+}
+
+int main(int argc, char **argv) {
+  int const rounds = argc > 1 ? atoi(argv[1]) : 1000;
+  srand(argc > 2 ? atoi(argv[2]) : 1);
+
+  functional();
+  if (!failures) {
+    powerLoss(rounds);
+  }
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
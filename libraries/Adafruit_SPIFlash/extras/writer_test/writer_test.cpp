@@ -0,0 +1,168 @@
+// Host test for Adafruit_FlashWriter and eraseRange(), on the RAM-backed
+// NOR flash transport from cache_test. Checks that:
+// - random regions written in random sized pieces read back, the sectors
+//   they start and end in are erased around them, and nothing outside those
+//   sectors changes
+// - 32KB erases are used on devices marked supports_block32_erase, and not
+//   on others, where over SPI they would seem to work but erase nothing
+// - when a page fails to program, write() counts only this call's bytes
+//   that reached flash, later writes take nothing and end() returns false
+//
+// Usage: writer_test   (see Makefile)
+
+#include "Adafruit_FlashWriter.h"
+#include "Adafruit_SPIFlashBase.h"
+#include "ram_transport.h"
+#include <vector>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static RamTransport ram;
+static std::vector<uint8_t> before(RamTransport::SIZE);
+
+static void randomize(void) {
+  for (uint32_t i = 0; i < RamTransport::SIZE; i++) {
+    ram.mem[i] = (uint8_t)rand();
+  }
+  memcpy(before.data(), ram.mem, RamTransport::SIZE);
+  ram.resetCounts();
+}
+
+// Stream a random region in pieces of 1 to 700 bytes. Returns the number of
+// 32KB block erases it took.
+static unsigned streamRegions(Adafruit_SPIFlashBase &fl, const char *name) {
+  unsigned block32 = 0;
+
+  for (int trial = 0; trial < 100; trial++) {
+    randomize();
+
+    uint32_t const start = rand() % (1 << 20);
+    uint32_t const len = 1 + rand() % 300000;
+    std::vector<uint8_t> data(len);
+    for (uint32_t i = 0; i < len; i++) {
+      data[i] = (uint8_t)rand();
+    }
+
+    Adafruit_FlashWriter w(&fl);
+    CHECK(w.begin(start, len), "%s: begin", name);
+
+    uint32_t done = 0;
+    while (done < len) {
+      uint32_t const n = w.write(&data[done], 1 + rand() % 700);
+      if (!n) {
+        break;
+      }
+      done += n;
+    }
+    CHECK(done == len, "%s: took %u of %u bytes", name, done, len);
+    CHECK(w.write(&data[0], 10) == 0, "%s: wrote past the end", name);
+    CHECK(w.end(), "%s: end", name);
+
+    uint32_t const s0 = start & ~(SFLASH_SECTOR_SIZE - 1);
+    uint32_t const s1 =
+        (start + len + SFLASH_SECTOR_SIZE - 1) & ~(SFLASH_SECTOR_SIZE - 1);
+
+    CHECK(!memcmp(ram.mem + start, data.data(), len), "%s: data differs",
+          name);
+    CHECK(!memcmp(ram.mem, before.data(), s0) &&
+              !memcmp(ram.mem + s1, &before[s1], RamTransport::SIZE - s1),
+          "%s: flash outside the region's sectors changed", name);
+
+    bool erased = true;
+    for (uint32_t a = s0; a < start; a++) {
+      erased = erased && ram.mem[a] == 0xff;
+    }
+    for (uint32_t a = start + len; a < s1; a++) {
+      erased = erased && ram.mem[a] == 0xff;
+    }
+    CHECK(erased, "%s: sector head or tail not erased", name);
+
+    if (failures) {
+      break;
+    }
+    block32 += ram.block32Erases;
+  }
+
+  return block32;
+}
+
+static void programFailure(Adafruit_SPIFlashBase &fl) {
+  uint8_t data[1000];
+  for (uint32_t i = 0; i < sizeof(data); i++) {
+    data[i] = (uint8_t)i;
+  }
+
+  randomize();
+  Adafruit_FlashWriter w(&fl);
+  CHECK(w.begin(0x10000, 4096), "begin");
+
+  // 100 bytes wait in the page buffer, then the first page program fails
+  // part way through this call's bytes
+  CHECK(w.write(data, 100) == 100, "first 100 bytes not taken");
+  ram.programsLeft = 0;
+  uint32_t const n = w.write(data + 100, 500);
+  ram.programsLeft = -1;
+
+  // 156 of them went into the failed page, nothing reached flash
+  CHECK(n == 0, "failed page: write() took %u", n);
+  CHECK(w.write(data, 300) == 0, "write() took more after a failure");
+  CHECK(!w.end(), "end() didn't report the failure");
+
+  // a second page failing: the first 256 bytes are on flash
+  randomize();
+  CHECK(w.begin(0x10000, 4096), "begin again");
+  ram.programsLeft = 1;
+  uint32_t const m = w.write(data, 700);
+  ram.programsLeft = -1;
+  CHECK(m == 256, "second page failed: write() took %u", m);
+  CHECK(!memcmp(ram.mem + 0x10000, data, 256), "first page not on flash");
+  CHECK(!w.end(), "end() didn't report the second page failing");
+
+  // begin() starts afresh
+  randomize();
+  CHECK(w.begin(0x10000, 4096), "begin after failure");
+  CHECK(w.write(data, 1000) == 1000 && w.end(), "write after failure");
+  CHECK(!memcmp(ram.mem + 0x10000, data, 1000), "data after failure");
+}
+
+int main(void) {
+  srand(1);
+
+  Adafruit_SPIFlashBase fl(&ram);
+  CHECK(fl.begin(), "begin");
+
+  unsigned const used = streamRegions(fl, "W25Q16");
+  CHECK(used > 0, "no 32KB erases on a device that has them");
+
+  // same device without 0x52: it's sent as an SPI transport would, and
+  // returns true without erasing anything
+  SPIFlash_Device_t no_block32 = W25Q16JV_IQ;
+  no_block32.supports_block32_erase = false;
+  Adafruit_SPIFlashBase plain(&ram);
+  CHECK(plain.begin(&no_block32, 1), "begin without 32KB erase");
+
+  ram.block32 = RamTransport::BLOCK32_IGNORED;
+  unsigned const sent = streamRegions(plain, "no 32KB erase");
+  CHECK(sent == 0, "0x52 sent %u times to a device without it", sent);
+
+  ram.block32 = RamTransport::BLOCK32_REFUSED;
+  streamRegions(fl, "32KB refused");
+  ram.block32 = RamTransport::BLOCK32_ERASES;
+
+  programFailure(fl);
+
+  printf("%u 32KB erases used, %u sent without support\n", used, sent);
+  CHECK(ram.violations == 0, "%u transport violations", ram.violations);
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
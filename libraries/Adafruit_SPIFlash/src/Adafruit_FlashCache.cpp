@@ -26,16 +26,16 @@
 #include "Adafruit_SPIFlashBase.h"
 
 #if SPIFLASH_DEBUG
-#define SPICACHE_LOG(_new_addr)                                                \
+#define SPICACHE_LOG(_old_addr, _new_addr)                                     \
   do {                                                                         \
     Serial.print(__FUNCTION__);                                                \
     Serial.print(": flush sector = ");                                         \
-    Serial.print(_addr / 512);                                                 \
+    Serial.print(_old_addr / 512);                                             \
     Serial.print(", new sector = ");                                           \
     Serial.println(_new_addr / 512);                                           \
   } while (0)
 #else
-#define SPICACHE_LOG(_new_addr)
+#define SPICACHE_LOG(_old_addr, _new_addr)
 #endif
 
 #define INVALID_ADDR 0xffffffff
@@ -48,19 +48,116 @@ static inline uint32_t offset_of(uint32_t addr) {
   return addr & (SFLASH_SECTOR_SIZE - 1);
 }
 
-Adafruit_FlashCache::Adafruit_FlashCache(void) { _addr = INVALID_ADDR; }
+Adafruit_FlashCache::Adafruit_FlashCache(void) {
+  for (uint8_t i = 0; i < SPIFLASH_CACHE_SECTORS; i++) {
+    _addr[i] = INVALID_ADDR;
+    _lru[i] = i;
+  }
+}
 
-bool Adafruit_FlashCache::sync(Adafruit_SPIFlashBase *fl) {
-  if (_addr == INVALID_ADDR) {
+// Slot holding a sector, or -1
+int Adafruit_FlashCache::find(uint32_t sector_addr) {
+  for (uint8_t i = 0; i < SPIFLASH_CACHE_SECTORS; i++) {
+    if (_addr[i] == sector_addr) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Move a slot to the front of the LRU list
+void Adafruit_FlashCache::touch(uint8_t slot) {
+  uint8_t i = 0;
+  while (_lru[i] != slot) {
+    i++;
+  }
+  for (; i > 0; i--) {
+    _lru[i] = _lru[i - 1];
+  }
+  _lru[0] = slot;
+}
+
+// Write a slot back to flash. The sector is compared with what's already
+// there a page at a time: pages that haven't changed aren't written, and if
+// the new data only clears bits (1 -> 0) it's programmed over the old without
+// erasing the sector first.
+bool Adafruit_FlashCache::flush(Adafruit_SPIFlashBase *fl, uint8_t slot) {
+  enum { PAGES = SFLASH_SECTOR_SIZE / SFLASH_PAGE_SIZE };
+
+  uint32_t const addr = _addr[slot];
+  uint8_t const *buf = _buf[slot];
+
+  if (addr == INVALID_ADDR) {
     return true;
   }
+  _addr[slot] = INVALID_ADDR;
 
-  fl->eraseSector(_addr / SFLASH_SECTOR_SIZE);
-  fl->writeBuffer(_addr, _buf, SFLASH_SECTOR_SIZE);
+  uint32_t page[SFLASH_PAGE_SIZE / 4];
+  uint32_t changed = 0; // bit per page
+  bool need_erase = false;
 
-  _addr = INVALID_ADDR;
+  for (uint8_t p = 0; p < PAGES; p++) {
+    uint32_t const *new32 = (uint32_t const *)(buf + p * SFLASH_PAGE_SIZE);
 
-  return true;
+    fl->readBuffer(addr + p * SFLASH_PAGE_SIZE, (uint8_t *)page,
+                   SFLASH_PAGE_SIZE);
+
+    for (uint16_t i = 0; i < SFLASH_PAGE_SIZE / 4; i++) {
+      if (page[i] != new32[i]) {
+        changed |= 1UL << p;
+        if ((page[i] & new32[i]) != new32[i]) {
+          need_erase = true;
+        }
+      }
+    }
+  }
+
+  if (!changed) {
+    return true;
+  }
+
+  bool ret = true;
+
+  if (need_erase) {
+    ret = fl->eraseSector(addr / SFLASH_SECTOR_SIZE);
+
+    // erased pages read back as 0xff, only program the others
+    changed = 0;
+    for (uint8_t p = 0; p < PAGES; p++) {
+      uint32_t const *new32 = (uint32_t const *)(buf + p * SFLASH_PAGE_SIZE);
+
+      for (uint16_t i = 0; i < SFLASH_PAGE_SIZE / 4; i++) {
+        if (new32[i] != 0xffffffff) {
+          changed |= 1UL << p;
+          break;
+        }
+      }
+    }
+  }
+
+  for (uint8_t p = 0; p < PAGES; p++) {
+    if (changed & (1UL << p)) {
+      uint32_t const off = p * SFLASH_PAGE_SIZE;
+      if (fl->writeBuffer(addr + off, buf + off, SFLASH_PAGE_SIZE) !=
+          SFLASH_PAGE_SIZE) {
+        ret = false;
+      }
+    }
+  }
+
+  return ret;
+}
+
+bool Adafruit_FlashCache::sync(Adafruit_SPIFlashBase *fl) {
+  bool ret = true;
+
+  for (uint8_t i = 0; i < SPIFLASH_CACHE_SECTORS; i++) {
+    if (!flush(fl, i)) {
+      ret = false;
+    }
+  }
+
+  return ret;
 }
 
 bool Adafruit_FlashCache::write(Adafruit_SPIFlashBase *fl, uint32_t address,
@@ -73,20 +170,54 @@ bool Adafruit_FlashCache::write(Adafruit_SPIFlashBase *fl, uint32_t address,
     uint32_t const sector_addr = sector_of(address);
     uint32_t const offset = offset_of(address);
 
+    // Whole 32KB or 64KB blocks skip the cache: one block erase does instead
+    // of reading back, erasing and writing each sector in turn
+    if (!(address & (SFLASH_BLOCK32_SIZE - 1)) &&
+        remain >= SFLASH_BLOCK32_SIZE) {
+      uint32_t const bulk = remain & ~(SFLASH_BLOCK32_SIZE - 1);
+
+      // cached copies of these sectors are overwritten anyway
+      for (uint8_t i = 0; i < SPIFLASH_CACHE_SECTORS; i++) {
+        if (_addr[i] != INVALID_ADDR && _addr[i] - address < bulk) {
+          _addr[i] = INVALID_ADDR;
+        }
+      }
+
+      if (!fl->eraseRange(address, bulk) ||
+          fl->writeBuffer(address, src8, bulk) != bulk) {
+        return false;
+      }
+
+      src8 += bulk;
+      remain -= bulk;
+      address += bulk;
+      continue;
+    }
+
     uint32_t wr_bytes = SFLASH_SECTOR_SIZE - offset;
     wr_bytes = min(remain, wr_bytes);
 
-    // Flash sector changes, flush old and update new cache
-    if (sector_addr != _addr) {
-      SPICACHE_LOG(sector_addr);
-      this->sync(fl);
-      _addr = sector_addr;
+    int slot = find(sector_addr);
+
+    // Sector not cached: use a free slot, or flush the least recently
+    // written one to make room
+    if (slot < 0) {
+      slot = find(INVALID_ADDR);
+      if (slot < 0) {
+        slot = _lru[SPIFLASH_CACHE_SECTORS - 1];
+      }
+      SPICACHE_LOG(_addr[slot], sector_addr);
+      this->flush(fl, slot);
+      _addr[slot] = sector_addr;
 
-      // read a whole page from flash
-      fl->readBuffer(sector_addr, _buf, SFLASH_SECTOR_SIZE);
+      // read a whole sector from flash, unless it's all being overwritten
+      if (wr_bytes < SFLASH_SECTOR_SIZE) {
+        fl->readBuffer(sector_addr, _buf[slot], SFLASH_SECTOR_SIZE);
+      }
     }
+    touch(slot);
 
-    memcpy(_buf + offset, src8, wr_bytes);
+    memcpy(_buf[slot] + offset, src8, wr_bytes);
 
     // adjust for next run
     src8 += wr_bytes;
@@ -99,36 +230,35 @@ bool Adafruit_FlashCache::write(Adafruit_SPIFlashBase *fl, uint32_t address,
 
 bool Adafruit_FlashCache::read(Adafruit_SPIFlashBase *fl, uint32_t address,
                                uint8_t *buffer, uint32_t count) {
-  // overwrite with cache value if available
-  if ((_addr != INVALID_ADDR) &&
-      !(address < _addr && address + count <= _addr) &&
-      !(address >= _addr + SFLASH_SECTOR_SIZE)) {
-    int32_t dst_off = _addr - address;
-    int32_t src_off = 0;
-
-    if (dst_off < 0) {
-      src_off = -dst_off;
-      dst_off = 0;
-    }
+  // Read sector by sector, from the cache where it has the sector. Runs of
+  // uncached sectors are read from flash in one go.
+  uint32_t uncached = 0;
 
-    int32_t cache_bytes = min((int32_t)(SFLASH_SECTOR_SIZE - src_off),
-                              (int32_t)(count - dst_off));
+  while (count) {
+    uint32_t const offset = offset_of(address);
 
-    // start to cached
-    if (dst_off) {
-      fl->readBuffer(address, buffer, dst_off);
-    }
+    uint32_t rd_bytes = SFLASH_SECTOR_SIZE - offset;
+    rd_bytes = min(count, rd_bytes);
 
-    // cached
-    memcpy(buffer + dst_off, _buf + src_off, cache_bytes);
+    int slot = find(sector_of(address));
 
-    // cached to end
-    uint32_t copied = (uint32_t)(dst_off + cache_bytes);
-    if (copied < count) {
-      fl->readBuffer(address + copied, buffer + copied, count - copied);
+    if (slot < 0) {
+      uncached += rd_bytes;
+    } else {
+      if (uncached) {
+        fl->readBuffer(address - uncached, buffer - uncached, uncached);
+        uncached = 0;
+      }
+      memcpy(buffer, _buf[slot] + offset, rd_bytes);
     }
-  } else {
-    fl->readBuffer(address, buffer, count);
+
+    buffer += rd_bytes;
+    count -= rd_bytes;
+    address += rd_bytes;
+  }
+
+  if (uncached) {
+    fl->readBuffer(address - uncached, buffer - uncached, uncached);
   }
 
   return true;
@@ -31,10 +31,27 @@
 // forward declaration
 class Adafruit_SPIFlashBase;
 
+// Number of 4KB sectors the cache holds. With more than one, FAT and data
+// sectors written in turn can stay cached together instead of each write
+// pushing the other out (and erasing it). Each costs 4KB of RAM, so the
+// default is one; boards or sketches with RAM to spare opt in by defining
+// e.g. SPIFLASH_CACHE_SECTORS=2 in their build flags.
+#ifndef SPIFLASH_CACHE_SECTORS
+#define SPIFLASH_CACHE_SECTORS 1
+#endif
+
 class Adafruit_FlashCache {
 private:
-  uint8_t _buf[4096] __attribute__((aligned(4))); // must be sector size
-  uint32_t _addr;
+  // must be sector size
+  uint8_t _buf[SPIFLASH_CACHE_SECTORS][4096] __attribute__((aligned(4)));
+  uint32_t _addr[SPIFLASH_CACHE_SECTORS];
+
+  // slot numbers, most recently written first
+  uint8_t _lru[SPIFLASH_CACHE_SECTORS];
+
+  int find(uint32_t sector_addr);
+  void touch(uint8_t slot);
+  bool flush(Adafruit_SPIFlashBase *fl, uint8_t slot);
 
 public:
   Adafruit_FlashCache(void);
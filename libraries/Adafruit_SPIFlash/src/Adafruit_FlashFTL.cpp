@@ -0,0 +1,461 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 hathach for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Adafruit_FlashFTL.h"
+#include "Adafruit_SPIFlashBase.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FTL_SECTOR_SIZE 512
+#define FTL_SLOTS (SFLASH_SECTOR_SIZE / FTL_SECTOR_SIZE - 1) // first is headers
+#define FTL_MAX_BLOCKS (0xfffe / FTL_SLOTS) // slot numbers must fit 16 bits
+#define FTL_MAGIC 0x314c5446                // "FTL1"
+
+#define FTL_UNMAPPED 0xffff
+#define FTL_NO_BLOCK 0xffff
+
+// Move cold data out of a block once it is this many erases behind the block
+// being filled, so that it gets reused too
+#define FTL_WEAR_DELTA 64
+
+typedef struct {
+  uint32_t magic;
+  uint32_t erase_count;
+  uint32_t check;
+} ftl_block_hdr_t;
+
+typedef struct {
+  uint32_t sector;
+  uint32_t seq;
+  uint32_t check;
+} ftl_slot_hdr_t;
+
+// Header page of an erase block. The block header is written when the block
+// is erased for use, each slot header once its data has been programmed.
+typedef struct {
+  ftl_block_hdr_t block;
+  ftl_slot_hdr_t slot[FTL_SLOTS];
+} ftl_header_t;
+
+// CRC32 of two words, so that a header cut short by power loss isn't taken
+// for a real one
+static uint32_t ftl_check(uint32_t a, uint32_t b) {
+  uint32_t const word[2] = {a, b};
+  uint8_t const *p = (uint8_t const *)word;
+  uint32_t crc = 0xffffffff;
+
+  for (uint8_t i = 0; i < sizeof(word); i++) {
+    crc ^= p[i];
+    for (uint8_t k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+
+  return ~crc;
+}
+
+static inline uint32_t block_addr(uint16_t block) {
+  return (uint32_t)block * SFLASH_SECTOR_SIZE;
+}
+
+static inline uint32_t slot_hdr_addr(uint16_t slot) {
+  return block_addr(slot / FTL_SLOTS) + sizeof(ftl_block_hdr_t) +
+         (slot % FTL_SLOTS) * sizeof(ftl_slot_hdr_t);
+}
+
+static inline uint32_t slot_data_addr(uint16_t slot) {
+  return block_addr(slot / FTL_SLOTS) +
+         (slot % FTL_SLOTS + 1) * FTL_SECTOR_SIZE;
+}
+
+Adafruit_FlashFTL::Adafruit_FlashFTL(void) {
+  _fl = NULL;
+  _map = NULL;
+  _valid = NULL;
+  _erase = NULL;
+  _blocks = 0;
+  _sectors = 0;
+  _seq = 0;
+  _active = FTL_NO_BLOCK;
+  _next = FTL_SLOTS;
+}
+
+Adafruit_FlashFTL::~Adafruit_FlashFTL() { end(); }
+
+bool Adafruit_FlashFTL::begin(Adafruit_SPIFlashBase *fl) {
+  end();
+
+  uint32_t blocks = fl->size() / SFLASH_SECTOR_SIZE;
+  if (blocks > FTL_MAX_BLOCKS) {
+    blocks = FTL_MAX_BLOCKS;
+  }
+
+  // too small to keep spare blocks
+  if (blocks < 8) {
+    return false;
+  }
+
+  // Spare blocks: with fewer live slots than (blocks - 1) * (FTL_SLOTS - 1),
+  // some block other than the active one always has at most FTL_SLOTS - 2
+  // live slots. So when the last free block has to be opened, collect() can
+  // empty one into it with a slot to spare for power loss part way through.
+  _fl = fl;
+  _blocks = blocks;
+  _sectors = (blocks - 2 - blocks / FTL_SLOTS) * FTL_SLOTS;
+
+  _map = (uint16_t *)malloc(_sectors * sizeof(uint16_t));
+  _valid = (uint8_t *)malloc(_blocks);
+  _erase = (uint32_t *)malloc(_blocks * sizeof(uint32_t));
+
+  if (!_map || !_valid || !_erase) {
+    end();
+    return false;
+  }
+
+  return mount();
+}
+
+void Adafruit_FlashFTL::end(void) {
+  free(_map);
+  free(_valid);
+  free(_erase);
+
+  _map = NULL;
+  _valid = NULL;
+  _erase = NULL;
+  _sectors = 0;
+  _blocks = 0;
+}
+
+// Rebuild the map from the headers of every block, keeping the copy of each
+// sector with the highest sequence number
+bool Adafruit_FlashFTL::mount(void) {
+  ftl_header_t hdr;
+  bool last_found = false;
+  uint16_t last = 0;
+
+  memset(_map, 0xff, _sectors * sizeof(uint16_t));
+  _seq = 0;
+
+  for (uint16_t b = 0; b < _blocks; b++) {
+    _valid[b] = 0;
+    _erase[b] = 0;
+
+    _fl->readBuffer(block_addr(b), (uint8_t *)&hdr, sizeof(hdr));
+
+    // never used, or erase cut short: free
+    if (hdr.block.magic != FTL_MAGIC ||
+        hdr.block.check != ftl_check(hdr.block.magic, hdr.block.erase_count)) {
+      continue;
+    }
+    _erase[b] = hdr.block.erase_count;
+
+    for (uint8_t i = 0; i < FTL_SLOTS; i++) {
+      ftl_slot_hdr_t const *sh = &hdr.slot[i];
+
+      if (sh->sector >= _sectors ||
+          sh->check != ftl_check(sh->sector, sh->seq)) {
+        continue;
+      }
+
+      // the newest slot of all is where writing left off
+      if (!last_found || sh->seq >= _seq) {
+        last_found = true;
+        last = b * FTL_SLOTS + i;
+        _seq = sh->seq + 1;
+      }
+
+      uint16_t const cur = _map[sh->sector];
+      if (cur != FTL_UNMAPPED) {
+        ftl_slot_hdr_t cur_hdr;
+        _fl->readBuffer(slot_hdr_addr(cur), (uint8_t *)&cur_hdr,
+                        sizeof(cur_hdr));
+        if (cur_hdr.seq > sh->seq) {
+          continue;
+        }
+      }
+
+      _map[sh->sector] = b * FTL_SLOTS + i;
+    }
+  }
+
+  for (uint32_t s = 0; s < _sectors; s++) {
+    if (_map[s] != FTL_UNMAPPED) {
+      _valid[_map[s] / FTL_SLOTS]++;
+    }
+  }
+
+  // Carry on filling the last block written. Slots after the newest may
+  // have been programmed partly before power was lost, skip those.
+  _active = FTL_NO_BLOCK;
+  _next = FTL_SLOTS;
+
+  if (last_found) {
+    _active = last / FTL_SLOTS;
+    _next = last % FTL_SLOTS + 1;
+    while (_next < FTL_SLOTS && !isErased(_active * FTL_SLOTS + _next)) {
+      _next++;
+    }
+  }
+
+  return true;
+}
+
+// Check that a slot's header and data are still as erased
+bool Adafruit_FlashFTL::isErased(uint16_t slot) {
+  ftl_slot_hdr_t sh;
+
+  _fl->readBuffer(slot_hdr_addr(slot), (uint8_t *)&sh, sizeof(sh));
+  if (sh.sector != 0xffffffff || sh.seq != 0xffffffff ||
+      sh.check != 0xffffffff) {
+    return false;
+  }
+
+  _fl->readBuffer(slot_data_addr(slot), _buf, FTL_SECTOR_SIZE);
+  for (uint16_t i = 0; i < FTL_SECTOR_SIZE; i++) {
+    if (_buf[i] != 0xff) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Adafruit_FlashFTL::read(uint32_t sector, uint8_t *dst, uint32_t count) {
+  if (sector + count > _sectors) {
+    return false;
+  }
+
+  while (count--) {
+    uint16_t const slot = _map[sector];
+
+    if (slot == FTL_UNMAPPED) {
+      memset(dst, 0xff, FTL_SECTOR_SIZE);
+    } else if (!_fl->readBuffer(slot_data_addr(slot), dst, FTL_SECTOR_SIZE)) {
+      return false;
+    }
+
+    sector++;
+    dst += FTL_SECTOR_SIZE;
+  }
+
+  return true;
+}
+
+bool Adafruit_FlashFTL::write(uint32_t sector, uint8_t const *src,
+                              uint32_t count) {
+  if (sector + count > _sectors) {
+    return false;
+  }
+
+  while (count--) {
+    if (!writeSector(sector, src)) {
+      return false;
+    }
+
+    sector++;
+    src += FTL_SECTOR_SIZE;
+  }
+
+  return true;
+}
+
+void Adafruit_FlashFTL::getWear(uint32_t *min_count, uint32_t *max_count) {
+  uint32_t lo = 0xffffffff, hi = 0;
+
+  for (uint16_t b = 0; b < _blocks; b++) {
+    lo = min(lo, _erase[b]);
+    hi = max(hi, _erase[b]);
+  }
+
+  *min_count = lo;
+  *max_count = hi;
+}
+
+bool Adafruit_FlashFTL::writeSector(uint32_t sector, uint8_t const *src) {
+  uint16_t const cur = _map[sector];
+
+  // FAT rewrites a lot of sectors unchanged, no need to use up a slot
+  if (cur != FTL_UNMAPPED) {
+    _fl->readBuffer(slot_data_addr(cur), _buf, FTL_SECTOR_SIZE);
+  } else {
+    memset(_buf, 0xff, FTL_SECTOR_SIZE);
+  }
+  if (!memcmp(_buf, src, FTL_SECTOR_SIZE)) {
+    return true;
+  }
+
+  if (!alloc()) {
+    return false;
+  }
+
+  return program(_active * FTL_SLOTS + _next++, sector, src);
+}
+
+// Make sure the active block has a free slot. Two free blocks are kept in
+// hand where possible, so that if power is lost part way through collect()
+// there is still one to open after begin().
+bool Adafruit_FlashFTL::alloc(void) {
+  for (;;) {
+    uint8_t const room = (_active == FTL_NO_BLOCK) ? 0 : FTL_SLOTS - _next;
+    uint16_t free_blocks = 0;
+
+    for (uint16_t b = 0; b < _blocks && free_blocks < 2; b++) {
+      if (b != _active && !_valid[b]) {
+        free_blocks++;
+      }
+    }
+
+    // collect() fails when there isn't room for any block's live slots
+    if (free_blocks < 2 && room && collect()) {
+      continue;
+    }
+
+    if (room) {
+      return true;
+    }
+
+    if (!free_blocks || !openBlock()) {
+      return false;
+    }
+  }
+}
+
+// Erase the least worn free block and start filling it
+bool Adafruit_FlashFTL::openBlock(void) {
+  uint16_t best = FTL_NO_BLOCK;
+
+  for (uint16_t b = 0; b < _blocks; b++) {
+    if (b == _active || _valid[b]) {
+      continue;
+    }
+    if (best == FTL_NO_BLOCK || _erase[best] > _erase[b]) {
+      best = b;
+    }
+  }
+
+  if (best == FTL_NO_BLOCK) {
+    return false;
+  }
+
+  if (!_fl->eraseSector(best)) {
+    return false;
+  }
+  _erase[best]++;
+
+  ftl_block_hdr_t hdr;
+  hdr.magic = FTL_MAGIC;
+  hdr.erase_count = _erase[best];
+  hdr.check = ftl_check(hdr.magic, hdr.erase_count);
+
+  if (_fl->writeBuffer(block_addr(best), (uint8_t const *)&hdr,
+                       sizeof(hdr)) != sizeof(hdr)) {
+    return false;
+  }
+
+  _active = best;
+  _next = 0;
+
+  return true;
+}
+
+// Copy the live slots of a block into the room left in the active block,
+// leaving it free. Normally that's the block with fewest live slots, which
+// the spare blocks ensure is less than a whole block. Now and then it's a
+// block of cold data that has fallen behind the others in erase count.
+bool Adafruit_FlashFTL::collect(void) {
+  uint16_t victim = FTL_NO_BLOCK;
+  uint16_t cold = FTL_NO_BLOCK;
+
+  for (uint16_t b = 0; b < _blocks; b++) {
+    if (b == _active || !_valid[b]) {
+      continue;
+    }
+    if (victim == FTL_NO_BLOCK || _valid[victim] > _valid[b]) {
+      victim = b;
+    }
+    if (cold == FTL_NO_BLOCK || _erase[cold] > _erase[b]) {
+      cold = b;
+    }
+  }
+
+  uint8_t const room = FTL_SLOTS - _next;
+
+  if (victim == FTL_NO_BLOCK || _valid[victim] > room) {
+    return false;
+  }
+
+  // Not if it would fill the room: if power is lost part way through, what
+  // is left of it must still fit after begin()
+  if (_erase[cold] + FTL_WEAR_DELTA < _erase[_active] &&
+      _valid[cold] < room) {
+    victim = cold;
+  }
+
+  for (uint8_t i = 0; i < FTL_SLOTS && _valid[victim]; i++) {
+    uint16_t const slot = victim * FTL_SLOTS + i;
+    ftl_slot_hdr_t sh;
+
+    _fl->readBuffer(slot_hdr_addr(slot), (uint8_t *)&sh, sizeof(sh));
+    if (sh.sector >= _sectors || _map[sh.sector] != slot) {
+      continue; // stale or unused
+    }
+
+    _fl->readBuffer(slot_data_addr(slot), _buf, FTL_SECTOR_SIZE);
+    if (!program(_active * FTL_SLOTS + _next++, sh.sector, _buf)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Write a sector's data to a slot, then its header, and point the map at it
+bool Adafruit_FlashFTL::program(uint16_t slot, uint32_t sector,
+                                uint8_t const *data) {
+  if (_fl->writeBuffer(slot_data_addr(slot), data, FTL_SECTOR_SIZE) !=
+      FTL_SECTOR_SIZE) {
+    return false;
+  }
+
+  ftl_slot_hdr_t sh;
+  sh.sector = sector;
+  sh.seq = _seq++;
+  sh.check = ftl_check(sh.sector, sh.seq);
+
+  if (_fl->writeBuffer(slot_hdr_addr(slot), (uint8_t const *)&sh,
+                       sizeof(sh)) != sizeof(sh)) {
+    return false;
+  }
+
+  uint16_t const old = _map[sector];
+  if (old != FTL_UNMAPPED) {
+    _valid[old / FTL_SLOTS]--;
+  }
+
+  _map[sector] = slot;
+  _valid[slot / FTL_SLOTS]++;
+
+  return true;
+}
@@ -0,0 +1,96 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 hathach for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ADAFRUIT_FLASHFTL_H_
+#define ADAFRUIT_FLASHFTL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// forward declaration
+class Adafruit_SPIFlashBase;
+
+// Flash translation layer: presents the flash as 512-byte logical sectors
+// that are written to fresh space each time instead of in place, so a small
+// write is a page program rather than a 4KB sector erase.
+//
+// Each 4KB erase block holds a header page followed by 7 data slots. A slot's
+// header (logical sector and sequence number) is programmed after its data,
+// and the map from logical sectors to slots is rebuilt from these headers at
+// begin(), keeping the newest copy of each. When free blocks run out, the
+// block with the fewest live slots is copied forward and reused, and blocks
+// are erased only when reused, least worn first.
+//
+// The layout is not compatible with plain (uncached or cached) use of the
+// flash, it must be formatted through the FTL. About 3/4 of the flash is
+// usable, the rest goes to headers and spare blocks.
+//
+// RAM use is about 2 bytes per logical sector (the map) plus 5 bytes per
+// erase block (live slot and erase counts), allocated by begin(): about 9KB
+// for a 2MB flash and 70KB for 16MB, more than a SAMD21 or nRF52832 has.
+// begin() returns false if it can't be allocated.
+class Adafruit_FlashFTL {
+public:
+  Adafruit_FlashFTL(void);
+  ~Adafruit_FlashFTL();
+
+  bool begin(Adafruit_SPIFlashBase *fl);
+  void end(void);
+
+  // Number of 512-byte logical sectors, less than the flash size since some
+  // blocks are kept spare for garbage collection
+  uint32_t sectorCount(void) { return _sectors; }
+
+  bool read(uint32_t sector, uint8_t *dst, uint32_t count);
+  bool write(uint32_t sector, uint8_t const *src, uint32_t count);
+
+  // Lowest and highest erase count of all blocks
+  void getWear(uint32_t *min_count, uint32_t *max_count);
+
+private:
+  Adafruit_SPIFlashBase *_fl;
+
+  uint16_t *_map;   // logical sector -> slot
+  uint8_t *_valid;  // live slots in each block
+  uint32_t *_erase; // erase count of each block
+
+  uint16_t _blocks;
+  uint32_t _sectors;
+  uint32_t _seq; // sequence number for the next slot written
+
+  uint16_t _active; // block being filled
+  uint8_t _next;    // next free slot in _active
+
+  uint8_t _buf[512] __attribute__((aligned(4)));
+
+  bool mount(void);
+  bool isErased(uint16_t slot);
+  bool writeSector(uint32_t sector, uint8_t const *src);
+  bool alloc(void);
+  bool openBlock(void);
+  bool collect(void);
+  bool program(uint16_t slot, uint32_t sector, uint8_t const *data);
+};
+
+#endif /* ADAFRUIT_FLASHFTL_H_ */
@@ -52,6 +52,7 @@ enum {
 
   SFLASH_CMD_ERASE_PAGE = 0x81,
   SFLASH_CMD_ERASE_SECTOR = 0x20,
+  SFLASH_CMD_ERASE_BLOCK32 = 0x52,
   SFLASH_CMD_ERASE_BLOCK = 0xD8,
   SFLASH_CMD_ERASE_CHIP = 0xC7,
 
@@ -62,6 +63,7 @@ enum {
 /// Constant that is (mostly) true to all external flash devices
 enum {
   SFLASH_BLOCK_SIZE = 64 * 1024UL,
+  SFLASH_BLOCK32_SIZE = 32 * 1024UL,
   SFLASH_SECTOR_SIZE = 4 * 1024,
   SFLASH_PAGE_SIZE = 256,
 };
@@ -100,7 +102,8 @@ public:
                             uint32_t len) = 0;
 
   /// Erase external flash by address
-  /// @param command  can be sector erase (0x20) or block erase 0xD8
+  /// @param command  can be sector erase (0x20), 32KB block erase (0x52) or
+  ///                 block erase 0xD8. Return false if not supported
   /// @param address  address to be erased
   /// @return true if success
   virtual bool eraseCommand(uint8_t command, uint32_t address) = 0;
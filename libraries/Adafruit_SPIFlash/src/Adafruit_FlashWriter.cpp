@@ -0,0 +1,120 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 hathach for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Adafruit_FlashWriter.h"
+#include "Adafruit_SPIFlashBase.h"
+#include <string.h>
+
+Adafruit_FlashWriter::Adafruit_FlashWriter(Adafruit_SPIFlashBase *fl) {
+  _fl = fl;
+  _addr = _end = _erased = 0;
+  _count = 0;
+  _failed = false;
+}
+
+bool Adafruit_FlashWriter::begin(uint32_t address, uint32_t len) {
+  if (address + len > _fl->size()) {
+    return false;
+  }
+
+  // A region not starting on a page starts with a part page, the bytes
+  // before it are left as they are (0xff after the erase)
+  _addr = address & ~(SFLASH_PAGE_SIZE - 1);
+  _count = address - _addr;
+  memset(_page, 0xff, _count);
+
+  _end = address + len;
+  _erased = address & ~(SFLASH_SECTOR_SIZE - 1);
+  _failed = false;
+
+  return true;
+}
+
+uint32_t Adafruit_FlashWriter::write(void const *data, uint32_t len) {
+  uint8_t const *data8 = (uint8_t const *)data;
+  uint32_t const left = _end - (_addr + _count);
+
+  if (_failed) {
+    return 0;
+  }
+
+  len = min(len, left);
+
+  uint32_t remain = len;
+  while (remain) {
+    uint32_t const n = min(remain, (uint32_t)(SFLASH_PAGE_SIZE - _count));
+
+    memcpy(_page + _count, data8, n);
+    _count += n;
+    data8 += n;
+    remain -= n;
+
+    if (_count == SFLASH_PAGE_SIZE && !program()) {
+      // the page had n bytes of this call, the rest from earlier ones
+      _failed = true;
+      return len - remain - n;
+    }
+  }
+
+  return len;
+}
+
+bool Adafruit_FlashWriter::end(void) {
+  bool ret = !_failed;
+
+  if (ret && _count) {
+    ret = program();
+  }
+  _failed = !ret;
+
+  _fl->waitUntilReady();
+
+  return ret;
+}
+
+// Program the page buffer, erasing ahead first if need be. Neither waits for
+// the flash to finish, writeBuffer() and eraseRange() wait before they start.
+bool Adafruit_FlashWriter::program(void) {
+  if (_addr >= _erased) {
+    // up to the next 64KB boundary, or the end of the region
+    uint32_t erase_len =
+        SFLASH_BLOCK_SIZE - (_erased & (SFLASH_BLOCK_SIZE - 1));
+    erase_len = min(erase_len, _end - _erased);
+
+    if (!_fl->eraseRange(_erased, erase_len)) {
+      return false;
+    }
+    _erased = (_erased + erase_len + SFLASH_SECTOR_SIZE - 1) &
+              ~(SFLASH_SECTOR_SIZE - 1);
+  }
+
+  if (_fl->writeBuffer(_addr, _page, _count) != _count) {
+    return false;
+  }
+
+  _addr += SFLASH_PAGE_SIZE;
+  _count = 0;
+
+  return true;
+}
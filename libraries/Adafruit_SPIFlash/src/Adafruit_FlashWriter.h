@@ -0,0 +1,75 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 hathach for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ADAFRUIT_FLASHWRITER_H_
+#define ADAFRUIT_FLASHWRITER_H_
+
+#include "Adafruit_FlashTransport.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// forward declaration
+class Adafruit_SPIFlashBase;
+
+// Writes a stream of data, such as a firmware image or a log dump, to
+// consecutive addresses in a region of the flash.
+//
+// The region is erased just ahead of the data, with 64KB (and where the
+// device has them, 32KB) block erases wherever it covers whole blocks. Data is gathered into whole pages,
+// and each page is programmed without waiting for it to finish, so the next
+// one is buffered while the flash is busy. Sectors the region starts or ends
+// part way through are erased too.
+class Adafruit_FlashWriter {
+public:
+  Adafruit_FlashWriter(Adafruit_SPIFlashBase *fl);
+
+  // Start writing at address, with up to len bytes to come
+  bool begin(uint32_t address, uint32_t len);
+
+  // Returns the number of bytes taken, less than len at the end of the
+  // region or on error. If a page fails to erase or program, the bytes of
+  // this call that were in it aren't counted, but those earlier calls left
+  // in it are lost too: the writer stops, later writes take nothing and
+  // end() returns false.
+  uint32_t write(void const *data, uint32_t len);
+
+  // Program what is left and wait for the flash to finish. False if any page
+  // failed since begin().
+  bool end(void);
+
+private:
+  Adafruit_SPIFlashBase *_fl;
+
+  uint32_t _addr;   // address of _page
+  uint32_t _end;    // end of the region
+  uint32_t _erased; // region is erased up to here
+  uint16_t _count;  // bytes in _page
+  bool _failed;     // a page failed, stop writing
+
+  uint8_t _page[SFLASH_PAGE_SIZE] __attribute__((aligned(4)));
+
+  bool program(void);
+};
+
+#endif /* ADAFRUIT_FLASHWRITER_H_ */
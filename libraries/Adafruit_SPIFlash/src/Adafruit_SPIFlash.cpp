@@ -49,6 +49,8 @@
 Adafruit_SPIFlash::Adafruit_SPIFlash() : Adafruit_SPIFlashBase() {
   _cache_en = true;
   _cache = NULL;
+  _ftl_en = false;
+  _ftl = NULL;
 }
 
 Adafruit_SPIFlash::Adafruit_SPIFlash(Adafruit_FlashTransport *transport,
@@ -56,6 +58,8 @@ Adafruit_SPIFlash::Adafruit_SPIFlash(Adafruit_FlashTransport *transport,
     : Adafruit_SPIFlashBase(transport) {
   _cache_en = useCache;
   _cache = NULL;
+  _ftl_en = false;
+  _ftl = NULL;
 }
 
 bool Adafruit_SPIFlash::begin(SPIFlash_Device_t const *flash_devs,
@@ -67,7 +71,16 @@ bool Adafruit_SPIFlash::begin(SPIFlash_Device_t const *flash_devs,
   // Note: Skip caching if AVR. Comment out since new cache on AVR seems to
   // corrupt memory rather than safely return NULL
   if (_flash_dev && !_flash_dev->is_fram) {
-    if (_cache_en && !_cache) {
+    if (_ftl_en) {
+      if (!_ftl) {
+        _ftl = new Adafruit_FlashFTL;
+      }
+      if (!_ftl->begin(this)) {
+        delete _ftl;
+        _ftl = NULL;
+        ret = false;
+      }
+    } else if (_cache_en && !_cache) {
       _cache = new Adafruit_FlashCache;
     }
   }
@@ -84,6 +97,11 @@ void Adafruit_SPIFlash::end(void) {
     delete _cache;
     _cache = NULL;
   }
+
+  if (_ftl != NULL) {
+    delete _ftl;
+    _ftl = NULL;
+  }
 }
 
 //--------------------------------------------------------------------+
@@ -94,13 +112,18 @@ void Adafruit_SPIFlash::end(void) {
 bool Adafruit_SPIFlash::isBusy() { return !Adafruit_SPIFlashBase::isReady(); }
 
 uint32_t Adafruit_SPIFlash::sectorCount() {
+  if (_ftl) {
+    return _ftl->sectorCount();
+  }
   return Adafruit_SPIFlashBase::size() / LOGICAL_BLOCK_SIZE;
 }
 
 bool Adafruit_SPIFlash::readSector(uint32_t block, uint8_t *dst) {
   SPIFLASH_LOG(block, 1);
 
-  if (_cache) {
+  if (_ftl) {
+    return _ftl->read(block, dst, 1);
+  } else if (_cache) {
     return _cache->read(this, block * LOGICAL_BLOCK_SIZE, dst,
                         LOGICAL_BLOCK_SIZE);
   } else {
@@ -123,7 +146,9 @@ bool Adafruit_SPIFlash::syncDevice() {
 bool Adafruit_SPIFlash::writeSector(uint32_t block, const uint8_t *src) {
   SPIFLASH_LOG(block, 1);
 
-  if (_cache) {
+  if (_ftl) {
+    return _ftl->write(block, src, 1);
+  } else if (_cache) {
     return _cache->write(this, block * LOGICAL_BLOCK_SIZE, src,
                          LOGICAL_BLOCK_SIZE);
   } else {
@@ -135,7 +160,9 @@ bool Adafruit_SPIFlash::writeSector(uint32_t block, const uint8_t *src) {
 bool Adafruit_SPIFlash::readSectors(uint32_t block, uint8_t *dst, size_t nb) {
   SPIFLASH_LOG(block, nb);
 
-  if (_cache) {
+  if (_ftl) {
+    return _ftl->read(block, dst, nb);
+  } else if (_cache) {
     return _cache->read(this, block * LOGICAL_BLOCK_SIZE, dst,
                         LOGICAL_BLOCK_SIZE * nb);
   } else {
@@ -147,7 +174,10 @@ bool Adafruit_SPIFlash::readSectors(uint32_t block, uint8_t *dst, size_t nb) {
 bool Adafruit_SPIFlash::writeSectors(uint32_t block, const uint8_t *src,
                                      size_t nb) {
   SPIFLASH_LOG(block, nb);
-  if (_cache) {
+
+  if (_ftl) {
+    return _ftl->write(block, src, nb);
+  } else if (_cache) {
     return _cache->write(this, block * LOGICAL_BLOCK_SIZE, src,
                          LOGICAL_BLOCK_SIZE * nb);
   } else {
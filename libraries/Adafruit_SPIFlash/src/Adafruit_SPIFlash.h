@@ -26,6 +26,8 @@
 #define ADAFRUIT_SPIFLASH_H_
 
 #include "Adafruit_FlashCache.h"
+#include "Adafruit_FlashFTL.h"
+#include "Adafruit_FlashWriter.h"
 #include "Adafruit_SPIFlashBase.h"
 
 // implement SdFat Block Driver
@@ -58,7 +60,8 @@
 // BaseBlockDriver interface. This allows it to be used with SdFat's
 // FatFileSystem class.
 //
-// Instances of this class will use 4kB of RAM as a block cache.
+// Instances of this class will use 4kB of RAM per cached sector (see
+// SPIFLASH_CACHE_SECTORS, one by default) as a block cache.
 class Adafruit_SPIFlash : public FsBlockDeviceInterface,
                           public Adafruit_SPIFlashBase {
 public:
@@ -71,6 +74,12 @@ public:
 
   bool isCached(void) { return _cache_en && (_cache != NULL); }
 
+  // Use the flash translation layer (see Adafruit_FlashFTL) instead of the
+  // cache. Must be called before begin(), and the flash formatted with it.
+  // Needs about 2 bytes of RAM per 512-byte sector, e.g 70KB for 16MB.
+  void setFTL(bool enable) { _ftl_en = enable; }
+  bool isFTL(void) { return _ftl != NULL; }
+
   //------------- SdFat v2 FsBlockDeviceInterface API -------------//
   virtual bool isBusy();
   virtual uint32_t sectorCount();
@@ -103,6 +112,9 @@ public:
 protected:
   bool _cache_en;
   Adafruit_FlashCache *_cache;
+
+  bool _ftl_en;
+  Adafruit_FlashFTL *_ftl;
 };
 
 #endif /* ADAFRUIT_SPIFLASH_H_ */
@@ -412,6 +412,66 @@ bool Adafruit_SPIFlashBase::eraseBlock(uint32_t blockNumber) {
   return ret;
 }
 
+bool Adafruit_SPIFlashBase::eraseRange(uint32_t address, uint32_t len) {
+  if (!_flash_dev) {
+    return false;
+  }
+
+  // skip erase for fram
+  if (_flash_dev->is_fram || !len) {
+    return true;
+  }
+
+  uint32_t addr = address & ~(SFLASH_SECTOR_SIZE - 1);
+  uint32_t const end = address + len;
+
+  // 32KB erases only where the device is known to have them: the SPI
+  // transport sends any opcode and returns true. Transports that can't send
+  // it at all (e.g nRF QSPI) return false, then sector erases are used.
+  bool try_block32 = _flash_dev->supports_block32_erase;
+  bool ret = true;
+
+  _indicator_on();
+
+  while (addr < end) {
+    uint32_t const remain = end - addr;
+    uint8_t cmd = SFLASH_CMD_ERASE_SECTOR;
+    uint32_t erase_sz = SFLASH_SECTOR_SIZE;
+
+    if (!(addr & (SFLASH_BLOCK_SIZE - 1)) && remain >= SFLASH_BLOCK_SIZE) {
+      cmd = SFLASH_CMD_ERASE_BLOCK;
+      erase_sz = SFLASH_BLOCK_SIZE;
+    } else if (try_block32 && !(addr & (SFLASH_BLOCK32_SIZE - 1)) &&
+               remain >= SFLASH_BLOCK32_SIZE) {
+      cmd = SFLASH_CMD_ERASE_BLOCK32;
+      erase_sz = SFLASH_BLOCK32_SIZE;
+    }
+
+    // Before we erase we need to wait for any writes to finish
+    waitUntilReady();
+    writeEnable();
+
+    SPIFLASH_LOG(addr, erase_sz);
+
+    if (!_trans->eraseCommand(cmd, addr)) {
+      if (cmd == SFLASH_CMD_ERASE_BLOCK32) {
+        // do it with sector erases instead
+        writeDisable();
+        try_block32 = false;
+        continue;
+      }
+      ret = false;
+      break;
+    }
+
+    addr += erase_sz;
+  }
+
+  _indicator_off();
+
+  return ret;
+}
+
 bool Adafruit_SPIFlashBase::eraseChip(void) {
   if (!_flash_dev) {
     return false;
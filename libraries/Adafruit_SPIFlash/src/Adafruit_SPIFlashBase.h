@@ -68,6 +68,12 @@ public:
   bool eraseBlock(uint32_t blockNumber);
   bool eraseChip(void);
 
+  // Erase every sector that [address, address + len) touches, with 64KB and
+  // (if the device supports_block32_erase) 32KB block erases for the parts
+  // covering whole blocks. Returns as soon as the last erase is started, like
+  // the other erase functions.
+  bool eraseRange(uint32_t address, uint32_t len);
+
   // Helper
   uint8_t read8(uint32_t addr);
   uint16_t read16(uint32_t addr);
@@ -66,6 +66,9 @@ SPIFlash_Device_t *Adafruit_FlashTransport_ESP32::getFlashDevice(void) {
   _flash_device.memory_type = (flash->chip_id >> 8) & 0xff;
   _flash_device.capacity = flash->chip_id & 0xff;
 
+  // eraseCommand() does 32KB erases through the SDK
+  _flash_device.supports_block32_erase = true;
+
   return &_flash_device;
 }
 
@@ -114,6 +117,8 @@ bool Adafruit_FlashTransport_ESP32::eraseCommand(uint8_t command,
 
   if (command == SFLASH_CMD_ERASE_SECTOR) {
     erase_sz = SFLASH_SECTOR_SIZE;
+  } else if (command == SFLASH_CMD_ERASE_BLOCK32) {
+    erase_sz = SFLASH_BLOCK32_SIZE;
   } else if (command == SFLASH_CMD_ERASE_BLOCK) {
     erase_sz = SFLASH_BLOCK_SIZE;
   } else {
@@ -69,6 +69,11 @@ typedef struct {
   // Fram does not need/support erase and has much simpler WRITE operation
   bool is_fram : 1;
 
+  // Supports the 32KB block erase command 0x52. eraseRange() only uses it
+  // when set, since SPI transports send any opcode and can't tell whether
+  // the device acted on it. Left false, 64KB and 4KB erases are used.
+  bool supports_block32_erase : 1;
+
 } SPIFlash_Device_t;
 
 // Settings for the Adesto Tech AT25DF081A 1MiB SPI flash. Its on the SAMD21
@@ -83,6 +88,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = false,                        \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Adesto Tech AT25SF041 4MiB SPI flash used in AS7262 sensor
@@ -95,6 +101,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = false,                        \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Gigadevice GD25Q16C 2MiB SPI flash.
@@ -110,6 +117,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Gigadevice GD25Q32C 4MiB SPI flash.
@@ -125,6 +133,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = true,         \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Gigadevice GD25Q64C 8MiB SPI flash.
@@ -141,6 +150,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = true,         \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // https://www.fujitsu.com/uk/Images/MB85RS64V.pdf
@@ -154,6 +164,7 @@ typedef struct {
     .supports_qspi = false, .supports_qspi_writes = false,                     \
     .write_status_register_split = false, .single_status_byte = true,          \
     .is_fram = true,                                                           \
+    .supports_block32_erase = false,                                           \
   }
 
 // https://www.fujitsu.com/uk/Images/MB85RS1MT.pdf
@@ -167,6 +178,7 @@ typedef struct {
     .supports_qspi = false, .supports_qspi_writes = false,                     \
     .write_status_register_split = false, .single_status_byte = true,          \
     .is_fram = true,                                                           \
+    .supports_block32_erase = false,                                           \
   }
 
 // https://www.fujitsu.com/uk/Images/MB85RS2MTA.pdf
@@ -180,6 +192,7 @@ typedef struct {
     .supports_qspi = false, .supports_qspi_writes = false,                     \
     .write_status_register_split = false, .single_status_byte = true,          \
     .is_fram = true,                                                           \
+    .supports_block32_erase = false,                                           \
   }
 
 // https://www.fujitsu.com/uk/Images/MB85RS4MT.pdf
@@ -193,6 +206,7 @@ typedef struct {
     .supports_qspi = false, .supports_qspi_writes = true,                      \
     .write_status_register_split = false, .single_status_byte = true,          \
     .is_fram = true,                                                           \
+    .supports_block32_erase = false,                                           \
   }
 
 // Settings for the Macronix MX25L1606 2MiB SPI flash.
@@ -206,6 +220,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = true, .is_fram = false,                              \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Macronix MX25R1635F 2MiB SPI flash.
@@ -222,6 +237,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = true, .is_fram = false,                              \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Macronix MX25L3233F 4MiB SPI flash.
@@ -236,6 +252,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = true, .is_fram = false,                              \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Macronix MX25L6433F 8MiB SPI flash.
@@ -250,6 +267,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = true, .is_fram = false,                              \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Macronix MX25R6435F 8MiB SPI flash.
@@ -266,6 +284,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = true, .is_fram = false,                              \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Macronix MX25L12833F 16MiB SPI flash.
@@ -280,6 +299,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = true, .is_fram = false,                              \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Cypress (was Spansion) S25FL064L 8MiB SPI flash.
@@ -293,6 +313,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Cypress (was Spansion) S25FL116K 2MiB SPI flash.
@@ -306,6 +327,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Cypress (was Spansion) S25FL216K 2MiB SPI flash.
@@ -319,6 +341,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = false,                        \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = false,                                           \
   }
 
 // Settings for the Winbond W25Q80DL 1MiB SPI flash.
@@ -333,6 +356,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q80DV 1MiB SPI flash.
@@ -347,6 +371,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q16FW 2MiB SPI flash.
@@ -361,6 +386,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q16JV-IQ 2MiB SPI flash. Note that JV-IM has a
@@ -375,6 +401,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q16JV-IM 2MiB SPI flash. Note that JV-IQ has a
@@ -402,6 +429,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q32FV 4MiB SPI flash.
@@ -415,6 +443,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = false,                        \
     .supports_qspi_writes = false, .write_status_register_split = false,       \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q32JV-IM 4MiB SPI flash.
@@ -441,6 +470,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q64JV-IM 8MiB SPI flash. Note that JV-IQ has a
@@ -455,6 +485,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q64JV-IQ 8MiB SPI flash. Note that JV-IM has a
@@ -469,6 +500,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q128JV-SQ 16MiB SPI flash. Note that JV-IM has a
@@ -483,6 +515,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q128JV-PM 16MiB SPI flash. Note that JV-IM has a
@@ -497,6 +530,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Winbond W25Q256JV 32MiB SPI flash.
@@ -510,6 +544,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 // Settings for the Zetta Device ZD25WQ16B 2MiB SPI flash.
@@ -523,6 +558,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = false,                                           \
   }
 
 // Settings for the Puya Semiconductor P25Q16H 2MiB QSPI flash.
@@ -537,6 +573,7 @@ typedef struct {
     .supports_fast_read = true, .supports_qspi = true,                         \
     .supports_qspi_writes = true, .write_status_register_split = false,        \
     .single_status_byte = false, .is_fram = false,                             \
+    .supports_block32_erase = true,                                            \
   }
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_EXTERNAL_FLASH_DEVICES_H
@@ -199,7 +199,9 @@ void Adafruit_FlashTransport_QSPI::setClockSpeed(uint32_t clock_hz,
 /**************************************************************************/
 static void _run_instruction(uint8_t command, uint32_t iframe, uint32_t addr,
                              uint8_t *buffer, uint32_t size) {
-  if (command == SFLASH_CMD_ERASE_SECTOR || command == SFLASH_CMD_ERASE_BLOCK) {
+  if (command == SFLASH_CMD_ERASE_SECTOR ||
+      command == SFLASH_CMD_ERASE_BLOCK32 ||
+      command == SFLASH_CMD_ERASE_BLOCK) {
     QSPI->INSTRADDR.reg = addr;
   }
 
@@ -103,6 +103,9 @@ void Adafruit_FlashTransport_RP2040::begin(void) {
   _flash_dev.manufacturer_id = jedec_ids[0];
   _flash_dev.memory_type = jedec_ids[1];
   _flash_dev.capacity = jedec_ids[2];
+
+  // eraseCommand() does 32KB erases through the SDK
+  _flash_dev.supports_block32_erase = true;
 }
 
 void Adafruit_FlashTransport_RP2040::end(void) {
@@ -168,6 +171,8 @@ bool Adafruit_FlashTransport_RP2040::eraseCommand(uint8_t command,
 
   if (command == SFLASH_CMD_ERASE_SECTOR) {
     erase_sz = SFLASH_SECTOR_SIZE;
+  } else if (command == SFLASH_CMD_ERASE_BLOCK32) {
+    erase_sz = SFLASH_BLOCK32_SIZE;
   } else if (command == SFLASH_CMD_ERASE_BLOCK) {
     erase_sz = SFLASH_BLOCK_SIZE;
   } else {
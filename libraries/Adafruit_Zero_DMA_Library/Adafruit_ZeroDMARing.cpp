@@ -0,0 +1,231 @@
+/*!
+ * @file Adafruit_ZeroDMARing.cpp
+ *
+ * Descriptor ring for streaming with Adafruit_ZeroDMA.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * MIT license, all text here must be included in any redistribution.
+ *
+ */
+
+#include <Adafruit_ZeroDMARing.h>
+#include <stdlib.h>
+
+// How it works: every block has a descriptor of its own, linked in a loop
+// and set to interrupt when done. The DMA owns the blocks from _dmaIndex up
+// to (not including) _userIndex, going round, and the sketch owns the rest
+// (_owned of them). When a block is done the interrupt marks its descriptor
+// invalid and hands it to the sketch; release() marks it valid again. If the
+// DMA comes to an invalid descriptor it suspends the channel with a fetch
+// error, and is resumed once that block is released.
+
+Adafruit_ZeroDMARing::Adafruit_ZeroDMARing(void) {
+  _desc = NULL;
+  _block = NULL;
+  _numBlocks = 0;
+  _dmaIndex = _userIndex = 0;
+  _owned = 0;
+  _waiting = false;
+  _started = false;
+  _transmit = false;
+  _stalls = 0;
+  blockCallback = NULL;
+}
+
+Adafruit_ZeroDMARing::~Adafruit_ZeroDMARing(void) {
+  stopRing();
+  ::free(_desc);
+  ::free(_block);
+}
+
+ZeroDMAstatus Adafruit_ZeroDMARing::beginRing(void *peripheral, void *buffer,
+                                              uint8_t numBlocks,
+                                              uint16_t count,
+                                              dma_beat_size size,
+                                              bool transmit) {
+  if (_started)
+    return DMA_STATUS_BUSY;
+  if ((numBlocks < 2) || !count || !buffer ||
+      (_numBlocks && (numBlocks != _numBlocks)))
+    return DMA_STATUS_ERR_INVALID_ARG;
+
+  ZeroDMAstatus status = allocate();
+  if (status != DMA_STATUS_OK)
+    return status;
+
+  uint8_t *mem = (uint8_t *)buffer;
+  uint32_t blockBytes = (uint32_t)count << size; // 1, 2 or 4 bytes per beat
+
+  if (!_numBlocks) {
+    // First time: build the descriptor list. The channel mustn't already
+    // have one, there's no way to take descriptors off it again.
+    if (hasDescriptors)
+      return DMA_STATUS_ERR_INVALID_ARG;
+    _desc = (DmacDescriptor **)malloc(numBlocks * sizeof(DmacDescriptor *));
+    _block = (void **)malloc(numBlocks * sizeof(void *));
+    if (!_desc || !_block) {
+      unbuild(0);
+      return DMA_STATUS_ERR_INVALID_ARG;
+    }
+    for (uint8_t i = 0; i < numBlocks; i++) {
+      _block[i] = &mem[i * blockBytes];
+      _desc[i] = transmit ? addDescriptor(_block[i], peripheral, count, size,
+                                          true, false)
+                          : addDescriptor(peripheral, _block[i], count, size,
+                                          false, true);
+      if (!_desc[i]) {
+        unbuild(i); // out of memory partway
+        return DMA_STATUS_ERR_INVALID_ARG;
+      }
+    }
+    loop(true);
+    _numBlocks = numBlocks;
+  } else {
+    // Same descriptors, new memory (and maybe direction and beat size)
+    for (uint8_t i = 0; i < numBlocks; i++) {
+      _block[i] = &mem[i * blockBytes];
+      _desc[i]->BTCTRL.bit.BEATSIZE = size;
+      _desc[i]->BTCTRL.bit.SRCINC = transmit;
+      _desc[i]->BTCTRL.bit.DSTINC = !transmit;
+      _desc[i]->BTCTRL.bit.STEPSIZE = DMA_ADDRESS_INCREMENT_STEP_SIZE_1;
+      if (transmit)
+        changeDescriptor(_desc[i], _block[i], peripheral, count);
+      else
+        changeDescriptor(_desc[i], peripheral, _block[i], count);
+    }
+  }
+
+  // Interrupt after every block, and give every block to whoever fills it
+  for (uint8_t i = 0; i < numBlocks; i++) {
+    _desc[i]->BTCTRL.bit.BLOCKACT = DMA_BLOCK_ACTION_INT;
+    _desc[i]->BTCTRL.bit.VALID = !transmit;
+  }
+  _transmit = transmit;
+  _dmaIndex = _userIndex = 0;
+  _owned = transmit ? numBlocks : 0;
+  _waiting = false;
+  _stalls = 0;
+
+  setCallback(blockDone, DMA_CALLBACK_TRANSFER_DONE);
+  setCallback(stalled, DMA_CALLBACK_CHANNEL_SUSPEND);
+
+  return DMA_STATUS_OK;
+}
+
+// Undo a descriptor list that couldn't be finished, leaving the channel with
+// no descriptors so beginRing() can be tried again. Only the first descriptor
+// is the channel's own, in the descriptor table; the rest were allocated by
+// addDescriptor().
+void Adafruit_ZeroDMARing::unbuild(uint8_t built) {
+  for (uint8_t i = 1; i < built; i++)
+    ::free(_desc[i]);
+  if (built)
+    _desc[0]->DESCADDR.reg = 0;
+  hasDescriptors = false;
+  ::free(_desc);
+  ::free(_block);
+  _desc = NULL;
+  _block = NULL;
+}
+
+ZeroDMAstatus Adafruit_ZeroDMARing::startRing(void) {
+  if (!_numBlocks)
+    return DMA_STATUS_ERR_NOT_INITIALIZED;
+  if (_started)
+    return DMA_STATUS_BUSY;
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  _started = true;
+  ZeroDMAstatus status = DMA_STATUS_OK;
+  if (_owned == _numBlocks)
+    _waiting = true; // nothing to send yet, release() starts the job
+  else
+    status = startJob();
+  __set_PRIMASK(primask);
+  return status;
+}
+
+void Adafruit_ZeroDMARing::stopRing(void) {
+  if (_started)
+    abort();
+  _started = false;
+  _waiting = false;
+}
+
+void *Adafruit_ZeroDMARing::acquire(void) {
+  return _owned ? _block[_userIndex] : NULL;
+}
+
+void Adafruit_ZeroDMARing::release(void *block, uint16_t count) {
+  if (!_owned)
+    return;
+
+  uint8_t i = _userIndex;
+  if (block || count) {
+    if (block)
+      _block[i] = block;
+    // The descriptor holds the end address, so it's redone for a new count
+    if (_transmit)
+      changeDescriptor(_desc[i], _block[i], NULL, count);
+    else
+      changeDescriptor(_desc[i], NULL, _block[i], count);
+  }
+  _desc[i]->BTCTRL.bit.VALID = true;
+  if (++_userIndex >= _numBlocks)
+    _userIndex = 0;
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  _owned = _owned - 1;
+  if (_waiting) {
+    _waiting = false;
+    wake();
+  }
+  __set_PRIMASK(primask);
+}
+
+// Get the DMA going again at the block it's waiting for. Called with
+// interrupts off.
+void Adafruit_ZeroDMARing::wake(void) {
+  if (jobStatus != DMA_STATUS_SUSPEND) {
+    startJob(); // The job never got going, see startRing()
+    return;
+  }
+  // A fetch error suspends the channel before the descriptor is used, so
+  // resuming fetches it again. Not resume(), which waits for the channel to
+  // be busy, but a peripheral may not have triggered yet.
+#ifdef __SAMD51__
+  DMAC->Channel[channel].CHCTRLB.reg |= DMAC_CHCTRLB_CMD_RESUME;
+#else
+  DMAC->CHID.bit.ID = channel;
+  DMAC->CHCTRLB.reg |= DMAC_CHCTRLB_CMD_RESUME;
+#endif
+  jobStatus = DMA_STATUS_BUSY;
+}
+
+// TRANSFER_DONE callback, at the end of every block
+void Adafruit_ZeroDMARing::blockDone(Adafruit_ZeroDMA *dma) {
+  Adafruit_ZeroDMARing *ring = (Adafruit_ZeroDMARing *)dma;
+  uint8_t i = ring->_dmaIndex;
+  ring->_desc[i]->BTCTRL.bit.VALID = false;
+  if (++ring->_dmaIndex >= ring->_numBlocks)
+    ring->_dmaIndex = 0;
+  ring->_owned = ring->_owned + 1;
+  if (ring->blockCallback)
+    ring->blockCallback(ring, ring->_block[i]);
+}
+
+// CHANNEL_SUSPEND callback, when the DMA reached a block the sketch has
+void Adafruit_ZeroDMARing::stalled(Adafruit_ZeroDMA *dma) {
+  Adafruit_ZeroDMARing *ring = (Adafruit_ZeroDMARing *)dma;
+  if (ring->_owned < ring->_numBlocks) {
+    ring->wake(); // released since the DMA looked
+  } else {
+    ring->_waiting = true;
+    ring->_stalls = ring->_stalls + 1;
+  }
+}
@@ -0,0 +1,141 @@
+/*!
+ * @file Adafruit_ZeroDMARing.h
+ *
+ * This is part of Adafruit's DMA library for SAMD microcontrollers on
+ * the Arduino platform. SAMD21 and SAMD51 lines are supported.
+ *
+ * Adafruit invests time and resources providing this open source code,
+ * please support Adafruit and open-source hardware by purchasing
+ * products from Adafruit!
+ *
+ * MIT license, all text here must be included in any redistribution.
+ *
+ */
+
+#ifndef _ADAFRUIT_ZERODMARING_H_
+#define _ADAFRUIT_ZERODMARING_H_
+
+#include "Adafruit_ZeroDMA.h"
+
+/*!
+    @brief  A looped list of descriptors moving blocks between a peripheral
+            and memory, for streaming without gaps between jobs. Each block
+            belongs either to the DMA or to the sketch: the DMA hands a block
+            over when it's done with it, and the sketch gets it with
+            acquire() and hands it back with release(). A block the sketch
+            still has is marked invalid, so if the DMA catches up it pauses
+            there (counted by getStalls()) instead of reusing it, and carries
+            on when the block is released.
+
+            The ring uses the channel's TRANSFER_DONE and CHANNEL_SUSPEND
+            callbacks itself; use setBlockCallback() instead.
+*/
+class Adafruit_ZeroDMARing : public Adafruit_ZeroDMA {
+public:
+  Adafruit_ZeroDMARing(void);
+  ~Adafruit_ZeroDMARing(void);
+
+  /*!
+    @brief  Build the ring, allocating the channel if needed. Set the
+            trigger and action first, as for any other job. Can be called
+            again (after stopRing()) with the same number of blocks to point
+            the ring at another buffer.
+    @param  peripheral  Peripheral data register address.
+    @param  buffer      numBlocks * count beats of memory, split into
+                        numBlocks consecutive blocks.
+    @param  numBlocks   Number of blocks (and descriptors), 2 or more.
+    @param  count       Beats per block, 1 to 65535.
+    @param  size        DMA_BEAT_SIZE_BYTE, DMA_BEAT_SIZE_HWORD or
+                        DMA_BEAT_SIZE_WORD.
+    @param  transmit    true to move blocks to the peripheral, in which
+                        case the sketch starts out with all of them to fill;
+                        false to receive, in which case the DMA starts out
+                        with all of them.
+    @return ZeroDMAstatus type:
+            DMA_STATUS_OK on success.
+            DMA_STATUS_ERR_INVALID_ARG if the arguments aren't usable,
+            differ in numBlocks from the ring already built, the channel
+            already has descriptors of its own or there isn't enough
+            memory. Running out of memory partway frees the descriptors
+            added so far, so the call can be retried on the same channel.
+            DMA_STATUS_ERR_NOT_FOUND if there was no free channel.
+            DMA_STATUS_BUSY if the ring is running.
+  */
+  ZeroDMAstatus beginRing(void *peripheral, void *buffer, uint8_t numBlocks,
+                          uint16_t count,
+                          dma_beat_size size = DMA_BEAT_SIZE_BYTE,
+                          bool transmit = false);
+
+  /*!
+    @brief  Start moving data. When transmitting, release() some blocks
+            first, or the ring starts with the first one released.
+    @return ZeroDMAstatus type, as from startJob().
+  */
+  ZeroDMAstatus startRing(void);
+
+  /*!
+    @brief  Stop moving data. beginRing() sets the ring up to start again.
+  */
+  void stopRing(void);
+
+  /*!
+    @brief  Get the next block the DMA has handed over: one it has filled
+            when receiving, one to fill when transmitting. The same block is
+            returned until it's released.
+    @return Pointer to the block, or NULL if the DMA has all of them.
+  */
+  void *acquire(void);
+
+  /*!
+    @brief  Hand the block from acquire() back to the DMA.
+    @param  block  Optional memory to use for this block from now on
+                   instead, so data can be handed over without copying.
+    @param  count  Optional new beat count for this block.
+  */
+  void release(void *block = NULL, uint16_t count = 0);
+
+  /*!
+    @brief  Get the number of blocks the sketch has, acquired or not.
+    @return 0 to numBlocks.
+  */
+  uint8_t available(void) { return _owned; }
+
+  /*!
+    @brief  Get the number of times the DMA caught up with the sketch and
+            paused. Receiving, that's a peripheral overrun; transmitting,
+            a gap in the output.
+    @return Stall count since beginRing().
+  */
+  uint32_t getStalls(void) { return _stalls; }
+
+  /*!
+    @brief  Set a function to call (from the DMA interrupt) as each block is
+            handed over.
+    @param  callback  Function taking the ring and the block, or NULL.
+  */
+  void setBlockCallback(void (*callback)(Adafruit_ZeroDMARing *ring,
+                                         void *block) = NULL) {
+    blockCallback = callback;
+  }
+
+protected:
+  DmacDescriptor **_desc; ///< One descriptor per block, in ring order
+  void **_block;          ///< Memory each block uses
+  uint8_t _numBlocks;     ///< Number of blocks in the ring
+  uint8_t _dmaIndex;      ///< Block the DMA will hand over next
+  uint8_t _userIndex;     ///< Block acquire() returns
+  volatile uint8_t _owned;   ///< Blocks the sketch has
+  volatile bool _waiting;    ///< DMA paused until a block is released
+  bool _started;             ///< DMA job has been started
+  bool _transmit;            ///< Blocks go to the peripheral
+  volatile uint32_t _stalls; ///< Times the DMA caught up with the sketch
+  void (*blockCallback)(Adafruit_ZeroDMARing *, void *); ///< Block handed over
+
+private:
+  void unbuild(uint8_t built);
+  void wake(void);
+  static void blockDone(Adafruit_ZeroDMA *dma);
+  static void stalled(Adafruit_ZeroDMA *dma);
+};
+
+#endif // _ADAFRUIT_ZERODMARING_H_
@@ -0,0 +1,78 @@
+// Continuous ADC capture through a ring of DMA blocks. The DMA fills the
+// blocks in turn while the sketch works on the ones it has filled, so no
+// samples are missed as long as the sketch hands blocks back in time (if it
+// doesn't, the DMA waits for it and getStalls() counts that).
+
+#include <Adafruit_ZeroDMARing.h>
+
+#define ADC_PIN A4
+#define NUM_BLOCKS 4
+#define SAMPLE_BLOCK_LENGTH 256
+
+Adafruit_ZeroDMARing ADC_DMA;
+uint16_t adc_buffer[NUM_BLOCKS * SAMPLE_BLOCK_LENGTH];
+
+uint16_t peak_to_peak(uint16_t *data, int data_length){
+  int signalMax = 0;
+  int signalMin = 4096;  // max value for 12 bit adc
+
+  for(int i=0; i<data_length; i++){
+    if ( data[i] > signalMax ) {
+      signalMax = data[i];
+    }
+    if (data[i] < signalMin ){
+      signalMin = data[i];
+    }
+  }
+  return signalMax - signalMin;
+}
+
+static void ADCsync() {
+  while (ADC->STATUS.bit.SYNCBUSY == 1);
+}
+
+void adc_init() {
+  analogRead(ADC_PIN);
+  ADC->CTRLA.bit.ENABLE = 0;
+  ADCsync();
+  ADC->INPUTCTRL.bit.GAIN = ADC_INPUTCTRL_GAIN_DIV2;
+  ADC->REFCTRL.bit.REFSEL = ADC_REFCTRL_REFSEL_INTVCC1;
+  ADCsync();
+  ADC->INPUTCTRL.bit.MUXPOS = g_APinDescription[ADC_PIN].ulADCChannelNumber;
+  ADCsync();
+  ADC->AVGCTRL.reg = 0;
+  ADC->SAMPCTRL.reg = 2;
+  ADCsync();
+  ADC->CTRLB.reg = ADC_CTRLB_PRESCALER_DIV32 | ADC_CTRLB_FREERUN | ADC_CTRLB_RESSEL_12BIT;
+  ADCsync();
+  ADC->CTRLA.bit.ENABLE = 1;
+  ADCsync();
+}
+
+void setup() {
+  Serial.begin(115200);
+  adc_init();
+
+  ADC_DMA.setTrigger(ADC_DMAC_ID_RESRDY);
+  ADC_DMA.setAction(DMA_TRIGGER_ACTON_BEAT);
+  ZeroDMAstatus stat = ADC_DMA.beginRing(
+           (void *)(&ADC->RESULT.reg),  // move data from here
+           adc_buffer,                  // into blocks of this
+           NUM_BLOCKS,
+           SAMPLE_BLOCK_LENGTH,         // samples per block
+           DMA_BEAT_SIZE_HWORD,
+           false);                      // receiving
+  ADC_DMA.printStatus(stat);
+  ADC_DMA.startRing();
+}
+
+void loop() {
+  // Blocks come out in order; work on them in place, then hand them back
+  uint16_t *block = (uint16_t *)ADC_DMA.acquire();
+  if (block) {
+    Serial.print(peak_to_peak(block, SAMPLE_BLOCK_LENGTH));
+    Serial.print("\tstalls: ");
+    Serial.println(ADC_DMA.getStalls());
+    ADC_DMA.release();
+  }
+}
@@ -0,0 +1,214 @@
+// Host simulation of Adafruit_ZeroDMARing. A fake DMA channel (stub/) moves
+// one block per step() and stalls on a descriptor the sketch still has, with
+// the suspend interrupt arriving at once or a step late. Random rings are
+// run with a sketch that acquires and releases blocks at random, and the
+// stream checked:
+// - receiving, blocks are never torn or stale, and every break in the
+//   sequence is counted as a stall
+// - transmitting, the peripheral gets every released sample exactly once,
+//   in order, including blocks handed over with release(block, count)
+// Also checks that running out of memory partway through beginRing() frees
+// what it built and leaves the channel so the call can be retried. Built
+// with AddressSanitizer, so leaked or twice freed descriptors fail too.
+//
+// Usage: ring_sim   (see Makefile)
+
+#include "fake_dma.h"
+
+#include "Adafruit_ZeroDMARing.h"
+#include <stdio.h>
+#include <vector>
+
+FakeDMAC fakeDMAC;
+int descriptorsBeforeFailure = -1;
+
+static uint32_t periphCounter;     // next word the peripheral produces
+static std::vector<uint32_t> sink; // words the peripheral was sent
+static bool lateSuspend;           // suspend interrupt a step after the stall
+
+void Adafruit_ZeroDMA::step(void) {
+  if (fakeDMAC.CHCTRLB.reg & DMAC_CHCTRLB_CMD_RESUME) {
+    fakeDMAC.CHCTRLB.reg = 0;
+    suspended = false;
+  }
+  if (pendingSuspend) {
+    pendingSuspend = false;
+    jobStatus = DMA_STATUS_SUSPEND;
+    if (callback[DMA_CALLBACK_CHANNEL_SUSPEND])
+      callback[DMA_CALLBACK_CHANNEL_SUSPEND](this);
+    return;
+  }
+  if (!enabled || suspended) {
+    periphCounter += 7; // peripheral data lost meanwhile
+    return;
+  }
+  if (!cur->BTCTRL.bit.VALID) { // fetch error
+    suspended = true;
+    if (lateSuspend) {
+      pendingSuspend = true;
+    } else {
+      jobStatus = DMA_STATUS_SUSPEND;
+      if (callback[DMA_CALLBACK_CHANNEL_SUSPEND])
+        callback[DMA_CALLBACK_CHANNEL_SUSPEND](this);
+    }
+    return;
+  }
+  uint32_t n = cur->BTCNT.reg;
+  if (cur->BTCTRL.bit.DSTINC) {
+    uint32_t *d = (uint32_t *)cur->dst;
+    for (uint32_t i = 0; i < n; i++)
+      d[i] = periphCounter++;
+  } else {
+    uint32_t *s = (uint32_t *)cur->src;
+    for (uint32_t i = 0; i < n; i++)
+      sink.push_back(s[i]);
+  }
+  cur = (DmacDescriptor *)cur->DESCADDR.reg;
+  if (!cur)
+    enabled = false;
+  jobStatus = DMA_STATUS_OK;
+  if (callback[DMA_CALLBACK_TRANSFER_DONE])
+    callback[DMA_CALLBACK_TRANSFER_DONE](this);
+}
+
+static int callbacks;
+static void blockCallback(Adafruit_ZeroDMARing *, void *) { callbacks++; }
+
+static int stream(void) {
+  int fails = 0;
+  static uint32_t buf[8 * 16];
+  static uint32_t pool[4000][16]; // blocks handed over by release(block)
+
+  for (int trial = 0; trial < 400; trial++) {
+    srand(trial);
+    lateSuspend = trial & 1;
+    bool tx = trial & 2;
+    periphCounter = 0;
+    sink.clear();
+    callbacks = 0;
+    int blocks = 2 + rand() % 6, count = 1 + rand() % 16;
+    int busy = 10 + rand() % 90; // % of steps the sketch looks at the ring
+
+    Adafruit_ZeroDMARing ring;
+    ring.setBlockCallback(blockCallback);
+    if (ring.beginRing((void *)0x1000, buf, blocks, count, DMA_BEAT_SIZE_WORD,
+                       tx) != DMA_STATUS_OK) {
+      printf("trial %d: beginRing failed\n", trial);
+      fails++;
+      continue;
+    }
+
+    uint32_t produced = 0, lastSeen = 0;
+    int received = 0, breaks = 0, poolNext = 0;
+    bool first = true;
+    if (tx) {
+      for (int k = rand() % 3; k > 0; k--) {
+        uint32_t *b = (uint32_t *)ring.acquire();
+        for (int i = 0; i < count; i++)
+          b[i] = produced++;
+        ring.release();
+      }
+    }
+    ring.startRing();
+
+    for (int it = 0; it < 5000; it++) {
+      ring.step();
+      if (rand() % 100 >= busy)
+        continue;
+      uint32_t *b = (uint32_t *)ring.acquire();
+      if (!b)
+        continue;
+      if (tx) {
+        if (rand() % 4 == 0) {
+          uint32_t *a = pool[poolNext++ % 4000];
+          int c = 1 + rand() % 16;
+          for (int i = 0; i < c; i++)
+            a[i] = produced++;
+          ring.release(a, c);
+        } else {
+          for (int i = 0; i < count; i++)
+            b[i] = produced++;
+          ring.release(NULL, count);
+        }
+      } else {
+        for (int i = 1; i < count; i++)
+          if (b[i] != b[0] + i) {
+            printf("trial %d: received block torn\n", trial);
+            fails++;
+            break;
+          }
+        if (!first && (b[0] != lastSeen + 1)) {
+          if (b[0] <= lastSeen) {
+            printf("trial %d: stale block %u after %u\n", trial, b[0],
+                   lastSeen);
+            fails++;
+          }
+          breaks++;
+        }
+        lastSeen = b[count - 1];
+        first = false;
+        received++;
+        ring.release();
+      }
+    }
+
+    if (tx) {
+      for (size_t i = 0; i < sink.size(); i++)
+        if (sink[i] != i) {
+          printf("trial %d: sent %u at %zu\n", trial, sink[i], i);
+          fails++;
+          break;
+        }
+      if (sink.size() > produced) {
+        printf("trial %d: sent more than was released\n", trial);
+        fails++;
+      }
+    } else if (breaks > (int)ring.getStalls()) {
+      printf("trial %d: %d breaks but %u stalls\n", trial, breaks,
+             ring.getStalls());
+      fails++;
+    }
+    if (trial < 8)
+      printf("blocks=%d count=%2d busy=%2d%% %s%s: received %4d, sent %5zu, "
+             "stalls %3u, callbacks %4d\n",
+             blocks, count, busy, tx ? "tx" : "rx",
+             lateSuspend ? " late suspend" : "", received, sink.size(),
+             ring.getStalls(), callbacks);
+  }
+  return fails;
+}
+
+// Adafruit_ZeroDMARing's protected state, to see what beginRing() left
+struct PeekRing : Adafruit_ZeroDMARing {
+  bool clean(void) { return !_desc && !_block && !_numBlocks; }
+};
+
+static int outOfMemory(void) {
+  int fails = 0;
+  static uint32_t buf[6 * 8];
+  for (int failAt = 0; failAt < 6; failAt++) {
+    PeekRing ring;
+    descriptorsBeforeFailure = failAt;
+    ZeroDMAstatus status = ring.beginRing((void *)0x1000, buf, 6, 8);
+    if ((status != DMA_STATUS_ERR_INVALID_ARG) || !ring.clean() ||
+        ring.descriptorCount()) {
+      printf("failing descriptor %d: status %d, %d descriptors left\n", failAt,
+             status, ring.descriptorCount());
+      fails++;
+    }
+    descriptorsBeforeFailure = -1;
+    status = ring.beginRing((void *)0x1000, buf, 6, 8);
+    if ((status != DMA_STATUS_OK) || (ring.descriptorCount() != 6)) {
+      printf("retry after failing descriptor %d: status %d, %d descriptors\n",
+             failAt, status, ring.descriptorCount());
+      fails++;
+    }
+  }
+  return fails;
+}
+
+int main(void) {
+  int fails = stream() + outOfMemory();
+  printf("%d failures\n", fails);
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,176 @@
+// Host stand-in for Adafruit_ZeroDMA, just enough for Adafruit_ZeroDMARing.
+// It takes the real header's include guard, so including this first keeps
+// the real one (and the SAMD register headers) out. step() moves one block
+// the way the DMAC would, or stalls on an invalid descriptor.
+#pragma once
+#define _ADAFRUIT_ZERODMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum ZeroDMAstatus {
+  DMA_STATUS_OK = 0,
+  DMA_STATUS_ERR_NOT_FOUND,
+  DMA_STATUS_ERR_NOT_INITIALIZED,
+  DMA_STATUS_ERR_INVALID_ARG,
+  DMA_STATUS_ERR_IO,
+  DMA_STATUS_ERR_TIMEOUT,
+  DMA_STATUS_BUSY,
+  DMA_STATUS_SUSPEND,
+  DMA_STATUS_ABORTED
+};
+enum dma_callback_type {
+  DMA_CALLBACK_TRANSFER_ERROR,
+  DMA_CALLBACK_TRANSFER_DONE,
+  DMA_CALLBACK_CHANNEL_SUSPEND,
+  DMA_CALLBACK_N
+};
+enum dma_beat_size {
+  DMA_BEAT_SIZE_BYTE = 0,
+  DMA_BEAT_SIZE_HWORD,
+  DMA_BEAT_SIZE_WORD
+};
+enum { DMA_BLOCK_ACTION_NOACT = 0, DMA_BLOCK_ACTION_INT };
+enum { DMA_ADDRESS_INCREMENT_STEP_SIZE_1 = 0 };
+
+// The fields the ring touches; addresses are start addresses, not end ones
+struct DmacDescriptor {
+  struct {
+    struct {
+      unsigned VALID : 1, BLOCKACT : 2, BEATSIZE : 2, SRCINC : 1, DSTINC : 1,
+          STEPSIZE : 3;
+    } bit;
+  } BTCTRL;
+  struct {
+    uint32_t reg;
+  } BTCNT;
+  uintptr_t src, dst;
+  struct {
+    uintptr_t reg;
+  } DESCADDR;
+};
+
+struct FakeDMAC {
+  struct {
+    struct {
+      uint8_t ID;
+    } bit;
+  } CHID;
+  struct {
+    uint32_t reg;
+  } CHCTRLB;
+};
+extern FakeDMAC fakeDMAC;
+#define DMAC (&fakeDMAC)
+#define DMAC_CHCTRLB_CMD_RESUME 2
+
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __disable_irq(void) {}
+static inline void __set_PRIMASK(uint32_t) {}
+
+// addDescriptor() calls left before one fails, as if out of memory; -1 never
+extern int descriptorsBeforeFailure;
+
+class Adafruit_ZeroDMA {
+public:
+  Adafruit_ZeroDMA() { memset(callback, 0, sizeof(callback)); }
+  // Unlike the real one, free the descriptors, so leak checking sees only
+  // the ones that were lost
+  ~Adafruit_ZeroDMA() {
+    DmacDescriptor *d = (DmacDescriptor *)first.DESCADDR.reg;
+    while (d && (d != &first)) {
+      DmacDescriptor *next = (DmacDescriptor *)d->DESCADDR.reg;
+      free(d);
+      d = next;
+    }
+  }
+
+  ZeroDMAstatus allocate(void) {
+    channel = 0;
+    return DMA_STATUS_OK;
+  }
+  ZeroDMAstatus startJob(void) {
+    if (jobStatus == DMA_STATUS_BUSY)
+      return DMA_STATUS_BUSY;
+    jobStatus = DMA_STATUS_BUSY;
+    cur = &first;
+    enabled = true;
+    starts++;
+    return DMA_STATUS_OK;
+  }
+  void abort(void) {
+    enabled = false;
+    jobStatus = DMA_STATUS_ABORTED;
+  }
+  void setCallback(void (*cb)(Adafruit_ZeroDMA *) = NULL,
+                   dma_callback_type type = DMA_CALLBACK_TRANSFER_DONE) {
+    callback[type] = cb;
+  }
+  void loop(bool flag) {
+    loopFlag = flag;
+    last()->DESCADDR.reg = flag ? (uintptr_t)&first : 0;
+  }
+  DmacDescriptor *addDescriptor(void *src, void *dst, uint32_t count,
+                                dma_beat_size size, bool srcInc,
+                                bool dstInc) {
+    if (descriptorsBeforeFailure >= 0 && !descriptorsBeforeFailure--)
+      return NULL;
+    DmacDescriptor *d = &first;
+    if (hasDescriptors) {
+      d = (DmacDescriptor *)calloc(1, sizeof(DmacDescriptor));
+      last()->DESCADDR.reg = (uintptr_t)d;
+    }
+    hasDescriptors = true;
+    memset(d, 0, sizeof(*d));
+    d->BTCTRL.bit.VALID = 1;
+    d->BTCTRL.bit.BEATSIZE = size;
+    d->BTCTRL.bit.SRCINC = srcInc;
+    d->BTCTRL.bit.DSTINC = dstInc;
+    d->BTCNT.reg = count;
+    d->src = (uintptr_t)src;
+    d->dst = (uintptr_t)dst;
+    d->DESCADDR.reg = loopFlag ? (uintptr_t)&first : 0;
+    return d;
+  }
+  void changeDescriptor(DmacDescriptor *d, void *src = NULL, void *dst = NULL,
+                        uint32_t count = 0) {
+    if (count)
+      d->BTCNT.reg = count;
+    if (src)
+      d->src = (uintptr_t)src;
+    if (dst)
+      d->dst = (uintptr_t)dst;
+  }
+
+  void step(void); // move one block, see ring_sim.cpp
+  int starts = 0;  // startJob() calls
+  int descriptorCount(void) {
+    if (!hasDescriptors)
+      return 0;
+    int n = 1;
+    for (DmacDescriptor *d = &first; d->DESCADDR.reg &&
+                                     (d->DESCADDR.reg != (uintptr_t)&first);
+         d = (DmacDescriptor *)d->DESCADDR.reg)
+      n++;
+    return n;
+  }
+
+protected:
+  uint8_t channel = 0xFF;
+  volatile ZeroDMAstatus jobStatus = DMA_STATUS_OK;
+  bool hasDescriptors = false;
+  bool loopFlag = false;
+  void (*callback[DMA_CALLBACK_N])(Adafruit_ZeroDMA *);
+
+  DmacDescriptor first = {}; // the channel's entry in the descriptor table
+  DmacDescriptor *cur = NULL;
+  bool enabled = false, suspended = false, pendingSuspend = false;
+  DmacDescriptor *last(void) {
+    DmacDescriptor *d = &first;
+    while (d->DESCADDR.reg && (d->DESCADDR.reg != (uintptr_t)&first))
+      d = (DmacDescriptor *)d->DESCADDR.reg;
+    return d;
+  }
+};
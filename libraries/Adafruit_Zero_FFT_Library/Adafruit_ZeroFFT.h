@@ -49,6 +49,9 @@
 
 #define ZERO_FFT_MAX 4096 ///< the maximum allowed FFT size
 
+#define ZERO_FFT_MAGNITUDE 0 ///< ZeroFFTReal() output: sqrt(re^2 + im^2)
+#define ZERO_FFT_LOG 1 ///< ZeroFFTReal() output: 20*log10(magnitude), in dB * 256
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -67,6 +70,261 @@ extern "C" {
 /**************************************************************************/
 extern int ZeroFFT(q15_t *source, uint16_t length);
 
+/**************************************************************************/
+/*!
+    @brief  run an FFT on an int16_t array of real samples, returning the true
+   magnitude of each bin. Note that this is run in place.
+    @param source the data to FFT
+    @param length the length of the data. This must be a power of 2 between 32
+   and ZERO_FFT_MAX inclusive
+    @param output ZERO_FFT_MAGNITUDE for the magnitude of each bin, on the same
+   scale as ZeroFFT(), or ZERO_FFT_LOG for the magnitude in decibels * 256
+   (0 to about 96 dB)
+    @return 0 on success, -1 on failure
+    @note A hanning window is applied to the input data. The samples are
+   treated as length/2 complex values, transformed with a length/2 point FFT
+   and then separated into the spectrum of the real signal, so this takes about
+   half the time of ZeroFFT() and needs no extra buffer if source is 4 byte
+   aligned. As with ZeroFFT(), the upper half of the output mirrors the lower.
+*/
+/**************************************************************************/
+extern int ZeroFFTReal(q15_t *source, uint16_t length, uint8_t output);
+
+/**************************************************************************/
+/*!
+    @brief  state of a streaming short-time FFT. Samples are written into a
+   caller-owned ring as they arrive, and every 'hop' samples a frame of the
+   last 'length' samples is due. All memory belongs to the caller, so any
+   number of these can run side by side.
+*/
+/**************************************************************************/
+typedef struct {
+  q15_t *ring;                ///< caller-owned sample history
+  q15_t *frame;               ///< caller-owned, 4 byte aligned, FFT output
+  uint16_t ringLength;        ///< number of samples ring can hold
+  uint16_t length;            ///< FFT length
+  uint16_t hop;               ///< samples between the start of each frame
+  uint16_t head;              ///< where the next sample goes in ring
+  uint16_t tail;              ///< where the next frame starts in ring
+  uint8_t output;             ///< ZERO_FFT_MAGNITUDE or ZERO_FFT_LOG
+  volatile uint32_t written;  ///< samples written in total
+  volatile uint16_t filling;  ///< samples ZeroSTFTWrite() is copying in now
+  uint32_t next;              ///< value of written when the next frame is due
+  uint32_t dropped;           ///< frames skipped because reading fell behind
+} ZeroSTFT;
+
+/**************************************************************************/
+/*!
+    @brief  set up a streaming short-time FFT
+    @param stft the state to set up
+    @param ring buffer for the incoming samples
+    @param ringLength the number of samples ring can hold. This must be at
+   least length + hop, plus however many samples can arrive while a frame is
+   being read if ZeroSTFTWrite() is called from an interrupt
+    @param frame buffer of length samples to hold each spectrum. This must be
+   4 byte aligned
+    @param length the FFT length, a power of 2 between 32 and ZERO_FFT_MAX
+    @param hop samples from the start of one frame to the start of the next,
+   eg. length/2 for 50% overlap or length/4 for 75%
+    @param output ZERO_FFT_MAGNITUDE or ZERO_FFT_LOG, as for ZeroFFTReal()
+    @return 0 on success, -1 on failure
+*/
+/**************************************************************************/
+extern int ZeroSTFTInit(ZeroSTFT *stft, q15_t *ring, uint16_t ringLength,
+                        q15_t *frame, uint16_t length, uint16_t hop,
+                        uint8_t output);
+
+/**************************************************************************/
+/*!
+    @brief  add samples to a short-time FFT. This only copies the samples, so
+   it can be called from a PDM or DMA interrupt.
+    @param stft the short-time FFT
+    @param samples the new samples, oldest first
+    @param count the number of samples
+*/
+/**************************************************************************/
+extern void ZeroSTFTWrite(ZeroSTFT *stft, const q15_t *samples,
+                          uint16_t count);
+
+/**************************************************************************/
+/*!
+    @brief  get the next frame of a short-time FFT, if one is due. The mean of
+   the frame is removed, then it is windowed and run through ZeroFFTReal().
+   If the samples for a frame were overwritten before it was read, or are
+   being overwritten by a ZeroSTFTWrite() this call interrupted, it is
+   skipped and counted in stft->dropped.
+    @param stft the short-time FFT
+    @return the spectrum in stft->frame (bins 0 to length/2 are meaningful),
+   or NULL if no frame is due yet
+*/
+/**************************************************************************/
+extern q15_t *ZeroSTFTRead(ZeroSTFT *stft);
+
+/**************************************************************************/
+/*!
+    @brief  work out log spaced bands for ZeroFFTBands()
+    @param edges array of numBands + 1 entries to fill with the first bin of
+   each band, the last entry being one past the end of the last band
+    @param numBands the number of bands
+    @param firstBin the first bin of the lowest band, at least 1
+    @param lastBin the last bin of the highest band, eg. length/2
+    @return 0 on success, -1 if there are too many bands to give each at least
+   one bin
+*/
+/**************************************************************************/
+extern int ZeroFFTBandEdges(uint16_t *edges, uint8_t numBands,
+                            uint16_t firstBin, uint16_t lastBin);
+
+/**************************************************************************/
+/*!
+    @brief  average the bins of a spectrum into bands, eg. for a row of LEDs
+    @param spectrum the output of ZeroFFTReal() or ZeroSTFTRead()
+    @param edges the band edges from ZeroFFTBandEdges()
+    @param numBands the number of bands
+    @param bands array of numBands entries to fill with the average of each
+*/
+/**************************************************************************/
+extern void ZeroFFTBands(const q15_t *spectrum, const uint16_t *edges,
+                         uint8_t numBands, q15_t *bands);
+
+/**************************************************************************/
+/*!
+    @brief  one bin of a ZeroGoertzel bank
+*/
+/**************************************************************************/
+typedef struct {
+  uint16_t bin;    ///< FFT bin number, eg. from FFT_INDEX()
+  q15_t value;     ///< result for the last complete block
+  uint8_t shift;   ///< input scaling that keeps the state in range
+  int32_t coeffHi; ///< 2 * cos(w), Q29, bits 15 and up
+  int32_t coeffLo; ///< 2 * cos(w), Q29, bits 0 to 14
+  int32_t cosine;  ///< cos(w), Q30
+  int32_t sine;    ///< sin(w), Q30
+  int32_t s1;      ///< filter state
+  int32_t s2;      ///< filter state
+} ZeroGoertzelBin;
+
+/**************************************************************************/
+/*!
+    @brief  a bank of Goertzel filters, giving a few bins of ZeroFFTReal() for
+   blocks of samples without running the whole FFT
+*/
+/**************************************************************************/
+typedef struct {
+  ZeroGoertzelBin *bins; ///< caller-owned bins
+  const q15_t *window;   ///< hanning window for the block length
+  uint16_t length;       ///< samples in each block
+  uint16_t count;        ///< samples so far in this block
+  uint8_t numBins;       ///< number of bins
+  uint8_t output;        ///< ZERO_FFT_MAGNITUDE or ZERO_FFT_LOG
+} ZeroGoertzel;
+
+/**************************************************************************/
+/*!
+    @brief  set up a bank of Goertzel filters
+    @param g the bank to set up
+    @param bins array of numBins bins for the bank to use
+    @param binIndices the FFT bin to measure in each of bins, from 0 to
+   length/2. FFT_INDEX() gives the bin for a frequency.
+    @param numBins the number of bins
+    @param length the block length, a power of 2 between 32 and ZERO_FFT_MAX
+    @param output ZERO_FFT_MAGNITUDE or ZERO_FFT_LOG, as for ZeroFFTReal()
+    @return 0 on success, -1 on failure
+    @note Each sample costs three 32 bit multiplies per bin, where
+   ZeroFFTReal() costs about log2(length) per sample whatever the number of
+   bins, so this suits the handful of bins needed for tone detection. Where
+   the two cross over depends on the chip and the length, so time both if it
+   matters.
+*/
+/**************************************************************************/
+extern int ZeroGoertzelInit(ZeroGoertzel *g, ZeroGoertzelBin *bins,
+                            const uint16_t *binIndices, uint8_t numBins,
+                            uint16_t length, uint8_t output);
+
+/**************************************************************************/
+/*!
+    @brief  add samples to a bank of Goertzel filters. Every length samples
+   the value of each bin is updated with what ZeroFFTReal() would give for
+   that block, to within a few LSB.
+    @param g the bank
+    @param samples the new samples, oldest first
+    @param count the number of samples
+    @return the number of blocks completed
+*/
+/**************************************************************************/
+extern uint16_t ZeroGoertzelWrite(ZeroGoertzel *g, const q15_t *samples,
+                                  uint16_t count);
+
+/**************************************************************************/
+/*!
+    @brief  one bin of a ZeroSDFT bank
+*/
+/**************************************************************************/
+typedef struct {
+  uint16_t bin;  ///< FFT bin number, eg. from FFT_INDEX()
+  int32_t re[3]; ///< sums for bin - 1, bin and bin + 1, real part
+  int32_t im[3]; ///< sums for bin - 1, bin and bin + 1, imaginary part
+} ZeroSDFTBin;
+
+/**************************************************************************/
+/*!
+    @brief  a bank of sliding DFT bins, giving a few bins of ZeroFFTReal() for
+   the latest length samples, after every sample
+*/
+/**************************************************************************/
+typedef struct {
+  ZeroSDFTBin *bins; ///< caller-owned bins
+  q15_t *history;    ///< caller-owned, the last length samples
+  uint16_t length;   ///< samples in the window
+  uint16_t pos;      ///< where the next sample goes in history
+  uint8_t numBins;   ///< number of bins
+  uint8_t output;    ///< ZERO_FFT_MAGNITUDE or ZERO_FFT_LOG
+} ZeroSDFT;
+
+/**************************************************************************/
+/*!
+    @brief  set up a bank of sliding DFT bins
+    @param s the bank to set up
+    @param bins array of numBins bins for the bank to use
+    @param binIndices the FFT bin to measure in each of bins, from 0 to
+   length/2. FFT_INDEX() gives the bin for a frequency.
+    @param numBins the number of bins
+    @param history buffer of length samples
+    @param length the window length, a power of 2 between 32 and ZERO_FFT_MAX
+    @param output ZERO_FFT_MAGNITUDE or ZERO_FFT_LOG, as for ZeroFFTReal()
+    @return 0 on success, -1 on failure
+    @note The sums are exact integers, so they never drift however long it
+   runs. The hanning window is applied when a bin is read, by combining it
+   with its neighbours, which makes each sample cost 12 multiplies per bin.
+   This is the periodic hanning window rather than the window_hanning_N
+   tables, which makes a difference of about 1 part in length.
+*/
+/**************************************************************************/
+extern int ZeroSDFTInit(ZeroSDFT *s, ZeroSDFTBin *bins,
+                        const uint16_t *binIndices, uint8_t numBins,
+                        q15_t *history, uint16_t length, uint8_t output);
+
+/**************************************************************************/
+/*!
+    @brief  add samples to a bank of sliding DFT bins
+    @param s the bank
+    @param samples the new samples, oldest first
+    @param count the number of samples
+*/
+/**************************************************************************/
+extern void ZeroSDFTWrite(ZeroSDFT *s, const q15_t *samples, uint16_t count);
+
+/**************************************************************************/
+/*!
+    @brief  read one bin of a sliding DFT bank
+    @param s the bank
+    @param i which of the bins to read
+    @return what ZeroFFTReal() would give for that bin over the latest length
+   samples
+*/
+/**************************************************************************/
+extern q15_t ZeroSDFTRead(ZeroSDFT *s, uint8_t i);
+
 extern const q15_t window_hanning_16[];   ///< a hanning window of length 16
 extern const q15_t window_hanning_32[];   ///< a hanning window of length 32
 extern const q15_t window_hanning_64[];   ///< a hanning window of length 64
@@ -6,15 +6,21 @@
  * 
  * Note that you can print only the value (coment out the other two print statements) and use
  * the serial plotter tool to see a graph.
+ *
+ * Set REAL_FFT to 1 to use ZeroFFTReal() instead, which takes about half the time and
+ * gives the true magnitude of each bin rather than the real part.
  */
 
 #include "Adafruit_ZeroFFT.h"
 #include "signal.h"
 
-//the signal in signal.h has 2048 samples. Set this to a value between 16 and 2048 inclusive.
-//this must be a power of 2
+//the signal in signal.h has 2048 samples. Set this to a value between 16 (32 for REAL_FFT)
+//and 2048 inclusive. this must be a power of 2
 #define DATA_SIZE 256
 
+//1 for ZeroFFTReal(), 0 for ZeroFFT()
+#define REAL_FFT 0
+
 //the sample rate
 #define FS 8000
 
@@ -24,7 +30,12 @@ void setup() {
   while(!Serial); //wait for serial to be ready
 
   //run the FFT
+#if REAL_FFT
+  //ZERO_FFT_LOG instead gives the level of each bin in dB * 256
+  ZeroFFTReal(signal, DATA_SIZE, ZERO_FFT_MAGNITUDE);
+#else
   ZeroFFT(signal, DATA_SIZE);
+#endif
 
   //data is only meaningful up to sample rate/2, discard the other half
   for(int i=0; i<DATA_SIZE/2; i++){
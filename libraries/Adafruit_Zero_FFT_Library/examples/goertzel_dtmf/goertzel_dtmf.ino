@@ -0,0 +1,71 @@
+/* This example shows how to detect a few tones with a Goertzel bank instead of
+ * a whole FFT, using the microphone on a circuit playground express.
+ *
+ * It listens for telephone (DTMF) key tones, which are one of 4 row
+ * frequencies plus one of 4 column frequencies, and prints the keys it hears.
+ */
+
+#include <Adafruit_CircuitPlayground.h>
+#include "Adafruit_ZeroFFT.h"
+
+//this must be a power of 2. 512 samples is enough to tell the rows apart
+#define DATA_SIZE 512
+
+//the sample rate
+#define FS 22000
+
+//how far the tones must be above the quietest one, in dB
+#define THRESHOLD_DB 15
+
+const uint16_t tones[8] = {697, 770, 852, 941, 1209, 1336, 1477, 1633};
+const char keys[4][4] = {{'1', '2', '3', 'A'},
+                         {'4', '5', '6', 'B'},
+                         {'7', '8', '9', 'C'},
+                         {'*', '0', '#', 'D'}};
+
+ZeroGoertzel goertzel;
+ZeroGoertzelBin bins[8];
+int16_t inputData[DATA_SIZE];
+char lastKey = 0;
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(115200);
+  CircuitPlayground.begin();
+
+  uint16_t binIndices[8];
+  for(int i=0; i<8; i++) binIndices[i] = FFT_INDEX(tones[i] + FS / DATA_SIZE / 2, FS, DATA_SIZE);
+  ZeroGoertzelInit(&goertzel, bins, binIndices, 8, DATA_SIZE, ZERO_FFT_LOG);
+}
+
+// the loudest of 4 bins, or -1 if it isn't clearly above the quietest
+int loudest(ZeroGoertzelBin *b){
+  int best = 0, quietest = 0;
+  for(int i=1; i<4; i++){
+    if(b[i].value > b[best].value) best = i;
+    if(b[i].value < b[quietest].value) quietest = i;
+  }
+  if(b[best].value - b[quietest].value < THRESHOLD_DB * 256) return -1;
+  return best;
+}
+
+void loop() {
+  CircuitPlayground.mic.capture(inputData, DATA_SIZE);
+
+  //remove the DC offset
+  int32_t avg = 0;
+  for(int i=0; i<DATA_SIZE; i++) avg += inputData[i];
+  avg = avg/DATA_SIZE;
+  for(int i=0; i<DATA_SIZE; i++) inputData[i] -= avg;
+
+  //only the 8 tones are worked out, not the whole spectrum
+  ZeroGoertzelWrite(&goertzel, inputData, DATA_SIZE);
+
+  int row = loudest(&bins[0]);
+  int col = loudest(&bins[4]);
+  char key = (row < 0 || col < 0) ? 0 : keys[row][col];
+
+  //print each key once, when it starts
+  if(key && key != lastKey) Serial.println(key);
+  lastKey = key;
+}
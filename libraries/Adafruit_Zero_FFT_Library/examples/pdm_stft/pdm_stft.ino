@@ -0,0 +1,93 @@
+/* This example shows continuous spectrum analysis of a PDM microphone with the
+ * streaming short-time FFT. The PDM data is captured by DMA, so none is lost
+ * while the sketch is busy. Each captured block is decimated and goes into a
+ * ring, and a new spectrum is ready every HOP samples, so the frames overlap
+ * rather than leaving gaps between them.
+ *
+ * The spectrum is averaged into NUM_BANDS log spaced bands and printed in dB,
+ * which looks good in the serial plotter.
+ */
+
+#include "Adafruit_ZeroFFT.h"
+#include "Adafruit_ZeroPDM.h"
+
+#define SAMPLERATE_HZ 22000
+#define DECIMATION    64
+
+//this must be a power of 2
+#define DATA_SIZE 256
+
+//samples between frames. DATA_SIZE/2 for 50% overlap, DATA_SIZE/4 for 75%
+#define HOP (DATA_SIZE / 2)
+
+//samples decimated from each DMA block. Printing a spectrum must take less
+//than a block's time (here 128 samples = 5.8 ms) or audio is lost
+#define BLOCK_SAMPLES 128
+#define BLOCK_WORDS   (BLOCK_SAMPLES * DECIMATION / 16)  // 16 bits per 'I2S sample'
+
+#define NUM_BANDS 8
+
+//the lowest frequency shown
+#define FREQ_MIN 100
+
+Adafruit_ZeroPDM pdm = Adafruit_ZeroPDM(1, 4);
+
+uint32_t pdmBuffer[2 * BLOCK_WORDS];
+uint16_t block[BLOCK_SAMPLES];
+
+ZeroSTFT stft;
+int16_t ring[DATA_SIZE + HOP + BLOCK_SAMPLES];
+int16_t ALIGN4 frame[DATA_SIZE];
+uint16_t bandEdges[NUM_BANDS + 1];
+int16_t bands[NUM_BANDS];
+
+// the setup routine runs once when you press reset:
+void setup() {
+  Serial.begin(115200);
+  delay(10);
+
+  // Initialize the PDM/I2S receiver
+  if (!pdm.begin()) {
+    Serial.println("Failed to initialize I2S/PDM!");
+    while (1);
+  }
+
+  // Configure PDM receiver, sample rate
+  if (!pdm.configure(SAMPLERATE_HZ * DECIMATION / 16, true)) {
+    Serial.println("Failed to configure PDM");
+    while (1);
+  }
+
+  ZeroSTFTInit(&stft, ring, sizeof(ring) / sizeof(ring[0]), frame, DATA_SIZE, HOP, ZERO_FFT_LOG);
+  ZeroFFTBandEdges(bandEdges, NUM_BANDS, FFT_INDEX(FREQ_MIN, SAMPLERATE_HZ, DATA_SIZE), DATA_SIZE/2);
+
+  // Start the DMA, it runs from now on without the sketch's help
+  if (!pdm.startCapture(pdmBuffer, BLOCK_WORDS, DECIMATION)) {
+    Serial.println("Failed to start DMA capture");
+    while (1);
+  }
+}
+
+void loop() {
+  if (!pdm.available()) return;
+
+  uint16_t n = pdm.readBlock(block);
+
+  //the samples are unsigned, centre them so they fit in an int16_t
+  int16_t *centred = (int16_t *)block;
+  for(uint16_t i=0; i<n; i++){
+    centred[i] = block[i] - 32768;
+  }
+  ZeroSTFTWrite(&stft, centred, n);
+
+  //the DC offset is removed from each frame, so the spectrum is ready to use
+  int16_t *spectrum = ZeroSTFTRead(&stft);
+  if (spectrum == NULL) return;
+
+  ZeroFFTBands(spectrum, bandEdges, NUM_BANDS, bands);
+  for(int i=0; i<NUM_BANDS; i++){
+    Serial.print(bands[i] / 256.0);
+    Serial.print(" ");
+  }
+  Serial.println();
+}
@@ -0,0 +1,138 @@
+// Host test for ZeroFFTReal(). Compares each bin with a double precision
+// DFT of the same windowed samples, on the same 1/(2N) scale as ZeroFFT(),
+// for N = 32 to ZERO_FFT_MAX with aligned and unaligned buffers, in both output
+// modes. Also sweeps the table square root and dB conversion over the whole
+// 32 bit range, checks that magnitudes past 32767 are clamped, and times
+// ZeroFFTReal() against ZeroFFT() (relative speed only, on this PC).
+//
+// Usage: make
+
+#include "fftutil.c" // for the static helpers
+#include <stdio.h>
+#include <time.h>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void accuracy(void) {
+  static q15_t ALIGN4 buf[ZERO_FFT_MAX + 2], orig[ZERO_FFT_MAX],
+      windowed[ZERO_FFT_MAX];
+  static double ref[ZERO_FFT_MAX / 2 + 1];
+
+  srand(1);
+  for (uint16_t N = 32; N <= ZERO_FFT_MAX; N *= 2) {
+    const q15_t *window = hanningWindow(N);
+    double magErr = 0, dbErr = 0;
+    for (int t = 0; t < 8; t++) {
+      for (int n = 0; n < N; n++)
+        orig[n] = (q15_t)(12000 * sin(2 * M_PI * (3.3 + t * 1.7) * n / N) +
+                          6000 * cos(2 * M_PI * (N / 5.0 + 0.4) * n / N + t) +
+                          (rand() % 2001 - 1000));
+      for (int n = 0; n < N; n++)
+        windowed[n] = (q15_t)(((int32_t)orig[n] * window[n]) >> 15);
+      for (int k = 0; k <= N / 2; k++) {
+        double re = 0, im = 0;
+        for (int n = 0; n < N; n++) {
+          re += windowed[n] * cos(2 * M_PI * k * n / N);
+          im -= windowed[n] * sin(2 * M_PI * k * n / N);
+        }
+        ref[k] = sqrt(re * re + im * im) / (2 * N);
+      }
+
+      q15_t *p = (t & 1) ? buf + 1 : buf; // odd trials unaligned
+      memcpy(p, orig, N * sizeof(q15_t));
+      CHECK(ZeroFFTReal(p, N, ZERO_FFT_MAGNITUDE) == 0, "N=%u rejected", N);
+      for (int k = 0; k <= N / 2; k++) {
+        double e = fabs(p[k] - ref[k]);
+        if (e > magErr)
+          magErr = e;
+        if (k && (k < N / 2))
+          CHECK(p[N - k] == p[k], "N=%u bin %d not mirrored", N, k);
+      }
+
+      memcpy(p, orig, N * sizeof(q15_t));
+      ZeroFFTReal(p, N, ZERO_FFT_LOG);
+      for (int k = 0; k <= N / 2; k++) {
+        if (ref[k] < 256) // a few LSB is many dB on small bins
+          continue;
+        double e = fabs(p[k] / 256.0 - 20 * log10(ref[k]));
+        if (e > dbErr)
+          dbErr = e;
+      }
+    }
+    printf("N=%4u: magnitude within %4.1f LSB, level within %.2f dB\n", N,
+           magErr, dbErr);
+    CHECK(magErr <= 8, "N=%u magnitude error %.1f", N, magErr);
+    CHECK(dbErr <= 0.3, "N=%u level error %.2f dB", N, dbErr);
+  }
+
+  CHECK(ZeroFFTReal(buf, 16, ZERO_FFT_MAGNITUDE) == -1, "N=16 accepted");
+  CHECK(ZeroFFTReal(buf, 100, ZERO_FFT_MAGNITUDE) == -1, "N=100 accepted");
+}
+
+static void helpers(void) {
+  double sqrtErr = 0, dbErr = 0;
+  for (uint64_t x = 0; x <= 0xFFFFFFFFull; x += (x < 100000) ? 1 : x / 50000) {
+    double e = fabs(sqrt32((uint32_t)x) - sqrt((double)x));
+    if (e > sqrtErr)
+      sqrtErr = e;
+  }
+  for (uint64_t x = 1; x <= 0xFFFFFFFFull; x += (x < 20000) ? 1 : x / 20000) {
+    double e = fabs(powerToDB((uint32_t)x) / 256.0 - 10 * log10((double)x));
+    if (e > dbErr)
+      dbErr = e;
+  }
+  printf("sqrt32 within %.2f, powerToDB within %.4f dB\n", sqrtErr, dbErr);
+  CHECK(sqrtErr <= 2.5, "sqrt32 error %.2f", sqrtErr);
+  CHECK(dbErr <= 0.01, "powerToDB error %.4f dB", dbErr);
+
+  CHECK(binOutput(32767, 32767, ZERO_FFT_MAGNITUDE) == 32767,
+        "magnitude not clamped");
+  CHECK(binOutput(-32768, 0, ZERO_FFT_MAGNITUDE) == 32767,
+        "magnitude not clamped");
+}
+
+static void speed(void) {
+  static q15_t ALIGN4 x[ZERO_FFT_MAX], orig[ZERO_FFT_MAX];
+  for (int n = 0; n < ZERO_FFT_MAX; n++)
+    orig[n] = (q15_t)(rand() % 20001 - 10000);
+  // ZeroFFT() only goes to ZERO_FFT_MAX / 2
+  for (uint16_t N = 64; N <= ZERO_FFT_MAX / 2; N *= 4) {
+    int reps = 400000 / N;
+    double a = now();
+    for (int r = 0; r < reps; r++) {
+      memcpy(x, orig, N * sizeof(q15_t));
+      ZeroFFT(x, N);
+    }
+    double b = now();
+    for (int r = 0; r < reps; r++) {
+      memcpy(x, orig, N * sizeof(q15_t));
+      ZeroFFTReal(x, N, ZERO_FFT_MAGNITUDE);
+    }
+    double c = now();
+    printf("N=%4u: ZeroFFTReal takes %.2f of the time of ZeroFFT\n", N,
+           (c - b) / (b - a));
+  }
+}
+
+int main(void) {
+  accuracy();
+  helpers();
+  speed();
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,6 @@
+// Just enough of Arduino.h to build the library's C files on a PC
+#pragma once
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
@@ -6,6 +6,7 @@
  */
 
 #include "Adafruit_ZeroFFT.h"
+#include "fftutil.h"
 
 /*
  * @brief  In-place bit reversal function.
@@ -320,3 +321,149 @@ int ZeroFFT(q15_t *source, uint16_t length) {
 
   return 0;
 }
+
+const q15_t *hanningWindow(uint16_t length) {
+  switch (length) {
+  case 4096u:
+    return window_hanning_4096;
+  case 2048u:
+    return window_hanning_2048;
+  case 1024u:
+    return window_hanning_1024;
+  case 512u:
+    return window_hanning_512;
+  case 256u:
+    return window_hanning_256;
+  case 128u:
+    return window_hanning_128;
+  case 64u:
+    return window_hanning_64;
+  case 32u:
+    return window_hanning_32;
+  default:
+    return NULL;
+  }
+}
+
+// sqrt(i / 128) * 65536 for i = 32 to 128
+static const uint16_t sqrtTable[97] = {
+    32768, 33276, 33776, 34270, 34756, 35235, 35708, 36175, 36636, 37091,
+    37540, 37985, 38424, 38858, 39287, 39712, 40132, 40548, 40960, 41368,
+    41771, 42171, 42567, 42959, 43348, 43733, 44115, 44494, 44869, 45242,
+    45611, 45977, 46341, 46702, 47059, 47415, 47767, 48117, 48465, 48809,
+    49152, 49492, 49830, 50166, 50499, 50830, 51159, 51486, 51811, 52134,
+    52454, 52773, 53090, 53405, 53719, 54030, 54340, 54647, 54954, 55258,
+    55561, 55862, 56162, 56459, 56756, 57051, 57344, 57636, 57926, 58215,
+    58503, 58789, 59073, 59357, 59639, 59919, 60199, 60477, 60753, 61029,
+    61303, 61576, 61848, 62119, 62388, 62657, 62924, 63190, 63455, 63719,
+    63982, 64243, 64504, 64763, 65022, 65279, 65535};
+
+// sqrt(x) to within about 2. Shifts x up by an even amount so the top 7 bits
+// index the table, then interpolates on the next 16, which is much quicker
+// than a bit at a time on a cortex M0.
+static uint16_t sqrt32(uint32_t x) {
+  if (x == 0)
+    return 0;
+  uint8_t shift = __builtin_clz(x) & ~1u;
+  x <<= shift; // 2^30 to 2^32 - 1
+  uint32_t i = (x >> 25) - 32, f = (x >> 9) & 0xFFFF;
+  uint32_t root =
+      sqrtTable[i] + (((uint32_t)(sqrtTable[i + 1] - sqrtTable[i]) * f) >> 16);
+  shift /= 2; // root is sqrt(x) * 2^shift
+  if (shift == 0)
+    return root;
+  return (root + (1ul << (shift - 1))) >> shift;
+}
+
+// log2(1 + i/16) in Q16, for interpolating the fractional part of a log
+static const uint16_t log2Table[17] = {
+    0,     5732,  11136, 16248, 21098, 25711, 30109, 34312, 38336,
+    42196, 45904, 49472, 52911, 56229, 59434, 62534, 65535};
+
+// 10*log10(x) in dB * 256, for x the square of a magnitude
+static q15_t powerToDB(uint32_t x) {
+  if (x == 0)
+    return 0;
+  int msb = 31 - __builtin_clz(x);
+  uint32_t frac = (x << (31 - msb)) << 1; // bits below the leading one
+  uint32_t i = frac >> 28, f = (frac >> 16) & 0xFFF;
+  uint32_t log2 = ((uint32_t)msb << 16) + log2Table[i] +
+                  (((log2Table[i + 1] - log2Table[i]) * f) >> 12); // Q16
+  // 10*log10(2) = 3.0103, as 12330 / 4096
+  return ((log2 >> 4) * 12330u) >> 16;
+}
+
+static inline q15_t binOutput(int32_t re, int32_t im, uint8_t output) {
+  uint32_t power = (uint32_t)(re * re) + (uint32_t)(im * im);
+  if (output == ZERO_FFT_LOG)
+    return powerToDB(power);
+  uint16_t mag = sqrt32(power); // up to sqrt(2) * 32768
+  return (mag > 32767) ? 32767 : mag;
+}
+
+q15_t zeroFFTBinOutput(int32_t re, int32_t im, uint8_t output) {
+  return binOutput(re, im, output);
+}
+
+int ZeroFFTReal(q15_t *source, uint16_t length, uint8_t output) {
+  const q15_t *window = hanningWindow(length);
+  if ((window == NULL) || (length > ZERO_FFT_MAX))
+    return -1;
+
+  // the tables are for a 4096 point complex FFT
+  uint16_t half = length / 2;
+  uint16_t bitRevFactor = 4096u / half;
+  uint16_t twidCoefModifier = bitRevFactor;
+
+  applyWindow(source, window, length);
+
+  // Pairs of real samples are already in the layout of a complex array,
+  // x[2n] + j x[2n+1], but the bit reversal moves them as 32 bit words
+  q15_t *z = source;
+  if ((uintptr_t)source & 3u) {
+    memcpy(scratchData, source, length * sizeof(q15_t));
+    z = scratchData;
+  }
+
+  arm_radix2_butterfly_q15(z, half, (q15_t *)twiddleCoefQ15, twidCoefModifier);
+  arm_bitreversal_q15(z, half, bitRevFactor,
+                      (uint16_t *)&armBitRevTable[bitRevFactor - 1]);
+
+  // Separate the half length transform Z into the spectrum X of the real
+  // signal. With B = conj(Z[half - k]):
+  //   X[k]        = (Z[k] + B)/2 - j W^k (Z[k] - B)/2
+  //   X[half - k] = conj((Z[k] + B)/2 + j W^k (Z[k] - B)/2)
+  // where W = exp(-2 pi j / length). Z comes out scaled by 1/half, and
+  // halving once more puts X on the same 1/(2 length) scale as ZeroFFT().
+  // Each result goes in the real part of the bin it was computed from, so
+  // the whole pass works in place.
+  int32_t r0 = z[0], i0 = z[1];
+  q15_t nyquist = binOutput((r0 - i0) >> 1, 0, output);
+  z[0] = binOutput((r0 + i0) >> 1, 0, output);
+
+  uint16_t step = (4096u / length) * 2u; // twiddle table index step
+  const q15_t *w = twiddleCoefQ15;
+  for (uint16_t k = 1; k <= half / 2; k++) {
+    w += step;
+    int32_t ar = z[2 * k], ai = z[2 * k + 1];
+    int32_t br = z[2 * (half - k)], bi = -z[2 * (half - k) + 1];
+    int32_t sr = ar + br, si = ai + bi; // 2 * even part
+    int32_t dr = ai - bi, di = br - ar; // 2 * odd part, -j (A - B)
+    int32_t c = w[0], s = w[1];         // W^k = c - j s
+    dr >>= 1; // keep the products in 32 bits
+    di >>= 1;
+    int32_t tr = (c * dr + s * di) >> 14;
+    int32_t ti = (c * di - s * dr) >> 14;
+    z[2 * k] = binOutput((sr + tr) >> 2, (si + ti) >> 2, output);
+    z[2 * (half - k)] = binOutput((sr - tr) >> 2, (si - ti) >> 2, output);
+  }
+
+  // gather the results, then mirror them into the upper half like ZeroFFT()
+  for (uint16_t k = 0; k < half; k++)
+    source[k] = z[2 * k];
+  source[half] = nyquist;
+  for (uint16_t k = 1; k < half; k++)
+    source[length - k] = source[k];
+
+  return 0;
+}
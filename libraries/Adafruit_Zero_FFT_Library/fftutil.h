@@ -0,0 +1,19 @@
+/*
+ * fftutil.h
+ *
+ * Helpers shared between the FFT, short-time FFT and single bin code. Not
+ * part of the library interface.
+ */
+
+#ifndef ADAFRUIT_ZEROFFT_FFTUTIL_H_
+#define ADAFRUIT_ZEROFFT_FFTUTIL_H_
+
+#include "Adafruit_ZeroFFT.h"
+
+// the window_hanning_N table for a length, or NULL if there isn't one
+const q15_t *hanningWindow(uint16_t length);
+
+// a bin's magnitude or level in dB * 256, as returned by ZeroFFTReal()
+q15_t zeroFFTBinOutput(int32_t re, int32_t im, uint8_t output);
+
+#endif /* ADAFRUIT_ZEROFFT_FFTUTIL_H_ */
@@ -0,0 +1,205 @@
+/*
+ * goertzel.c
+ *
+ * Single bin transforms: a block Goertzel bank and a sliding DFT bank, both
+ * giving the same results as ZeroFFTReal() for the bins they measure.
+ */
+
+#include "Adafruit_ZeroFFT.h"
+#include "fftutil.h"
+
+// log2 of a power of 2
+static uint8_t log2Length(uint16_t length) {
+  uint8_t n = 0;
+  while (length >>= 1)
+    n++;
+  return n;
+}
+
+static int validLength(uint16_t length) {
+  return (length >= 32u) && (length <= ZERO_FFT_MAX) &&
+         !(length & (length - 1u));
+}
+
+// shift right by n > 0, rounding
+static int32_t roundShift(int64_t x, uint8_t n) {
+  return (int32_t)((x + ((int64_t)1 << (n - 1))) >> n);
+}
+
+// round to the nearest integer, without pulling in lroundf()
+static int32_t roundFloat(float x) {
+  return (int32_t)(x < 0 ? x - 0.5f : x + 0.5f);
+}
+
+int ZeroGoertzelInit(ZeroGoertzel *g, ZeroGoertzelBin *bins,
+                     const uint16_t *binIndices, uint8_t numBins,
+                     uint16_t length, uint8_t output) {
+  if (!validLength(length) || (bins == NULL) || (numBins == 0))
+    return -1;
+
+  for (uint8_t i = 0; i < numBins; i++) {
+    ZeroGoertzelBin *b = &bins[i];
+    if (binIndices[i] > length / 2)
+      return -1;
+    float w = 2.0f * (float)M_PI * binIndices[i] / length;
+    b->bin = binIndices[i];
+    b->value = 0;
+
+    // A float can't hold cos(w) to 30 bits near 1, but 1 - cos(w) =
+    // 2 sin^2(w/2) is small there, so work out the distance from 1 instead.
+    // That keeps low bins of long blocks on frequency. 2 * cos(w) in Q29 is
+    // the same number, split in two for ZeroGoertzelWrite().
+    float h = sinf(w / 2);
+    int32_t d = roundFloat(h * h * (float)(1L << 30));
+    b->cosine = (1L << 30) - d - d; // 2 d is 2^31 for bin length/2
+    b->coeffHi = b->cosine >> 15;
+    b->coeffLo = b->cosine & 0x7FFF;
+    b->sine = roundFloat(sinf(w) * (float)(1L << 30));
+    b->s1 = 0;
+    b->s2 = 0;
+
+    // The state is a sum of the windowed samples, each weighted by at most
+    // min(length, 1/sin(w)), so scale the input to keep it below 2^30.
+    float sw = fabsf(sinf(w));
+    float gain = sw * length > 1.0f ? 1.0f / sw : length;
+    float bound = 16384.0f * length * gain;
+    b->shift = 0;
+    while (bound > (float)(1L << 30)) {
+      bound /= 2;
+      b->shift++;
+    }
+  }
+
+  g->bins = bins;
+  g->window = hanningWindow(length);
+  g->length = length;
+  g->count = 0;
+  g->numBins = numBins;
+  g->output = output;
+  return 0;
+}
+
+uint16_t ZeroGoertzelWrite(ZeroGoertzel *g, const q15_t *samples,
+                           uint16_t count) {
+  ZeroGoertzelBin *end = g->bins + g->numBins;
+  uint16_t n = g->count;
+  uint16_t blocks = 0;
+  while (count--) {
+    int32_t x = (*samples++ * g->window[n]) >> 15;
+    for (ZeroGoertzelBin *b = g->bins; b < end; b++) {
+      int32_t in = b->shift ? (x + (1L << (b->shift - 1))) >> b->shift : x;
+      // coeff * s1 >> 29 from 15 bit halves, so no product needs more than
+      // 32 bits. The low * low term is below 2 and is dropped. The new state
+      // fits in 32 bits but coeff * s1 may not quite, so sum modulo 2^32.
+      int32_t hi = b->s1 >> 15, lo = b->s1 & 0x7FFF;
+      int32_t mid = ((b->coeffHi * lo) >> 1) + ((b->coeffLo * hi) >> 1);
+      int32_t s = (int32_t)((uint32_t)(in - b->s2) +
+                            2u * (uint32_t)(b->coeffHi * hi) +
+                            (uint32_t)(mid >> 13));
+      b->s2 = b->s1;
+      b->s1 = s;
+    }
+    if (++n < g->length)
+      continue;
+
+    // X = s1 - exp(-jw) s2, then scaled by 1/(2 length) like ZeroFFTReal()
+    uint8_t down = log2Length(g->length) + 1;
+    for (ZeroGoertzelBin *b = g->bins; b < end; b++) {
+      int64_t re = b->s1 - (((int64_t)b->cosine * b->s2) >> 30);
+      int64_t im = ((int64_t)b->sine * b->s2) >> 30;
+      b->value = zeroFFTBinOutput(roundShift(re, down - b->shift),
+                                  roundShift(im, down - b->shift), g->output);
+      b->s1 = 0;
+      b->s2 = 0;
+    }
+    n = 0;
+    blocks++;
+  }
+  g->count = n;
+  return blocks;
+}
+
+// exp(-2 pi j p / length) = c - j s, Q15, for p from 0 to length - 1
+static void twiddle(uint16_t p, uint16_t step, int32_t *c, int32_t *s) {
+  uint16_t i = p * step; // the table is for a 4096 point FFT and stops at 3/4
+  if (i < 2048u) {
+    *c = twiddleCoefQ15[2 * i];
+    *s = twiddleCoefQ15[2 * i + 1];
+  } else {
+    i -= 2048u;
+    *c = -twiddleCoefQ15[2 * i];
+    *s = -twiddleCoefQ15[2 * i + 1];
+  }
+}
+
+int ZeroSDFTInit(ZeroSDFT *s, ZeroSDFTBin *bins, const uint16_t *binIndices,
+                 uint8_t numBins, q15_t *history, uint16_t length,
+                 uint8_t output) {
+  if (!validLength(length) || (bins == NULL) || (numBins == 0) ||
+      (history == NULL))
+    return -1;
+
+  for (uint8_t i = 0; i < numBins; i++) {
+    if (binIndices[i] > length / 2)
+      return -1;
+    bins[i].bin = binIndices[i];
+    memset(bins[i].re, 0, sizeof(bins[i].re));
+    memset(bins[i].im, 0, sizeof(bins[i].im));
+  }
+  memset(history, 0, length * sizeof(q15_t));
+
+  s->bins = bins;
+  s->history = history;
+  s->length = length;
+  s->pos = 0;
+  s->numBins = numBins;
+  s->output = output;
+  return 0;
+}
+
+void ZeroSDFTWrite(ZeroSDFT *s, const q15_t *samples, uint16_t count) {
+  uint16_t mask = s->length - 1u;
+  uint16_t step = 4096u / s->length;
+
+  while (count--) {
+    int32_t x = *samples++;
+    int32_t old = s->history[s->pos];
+    s->history[s->pos] = x;
+
+    // Each sum is of x[n] exp(-2 pi j k n / length) over the window. The
+    // term for a sample is worked out the same way when it leaves as when it
+    // arrived, since the phase has come round to the same place, so it
+    // cancels exactly.
+    for (ZeroSDFTBin *b = s->bins; b < s->bins + s->numBins; b++) {
+      uint16_t p = (b->bin - 1u) * s->pos;
+      for (uint8_t j = 0; j < 3; j++, p += s->pos) {
+        int32_t c, sn;
+        twiddle(p & mask, step, &c, &sn);
+        b->re[j] += ((x * c) >> 15) - ((old * c) >> 15);
+        b->im[j] -= ((x * sn) >> 15) - ((old * sn) >> 15);
+      }
+    }
+    s->pos = (s->pos + 1u) & mask;
+  }
+}
+
+q15_t ZeroSDFTRead(ZeroSDFT *s, uint8_t i) {
+  ZeroSDFTBin *b = &s->bins[i];
+
+  // The window starts at pos, so relative to bin, the neighbours are out by
+  // exp(+-2 pi j pos / length). The hanning window is then
+  // X[k]/2 - X[k - 1]/4 - X[k + 1]/4.
+  int32_t c, sn;
+  twiddle(s->pos, 4096u / s->length, &c, &sn);
+  int64_t lr = b->re[0], li = b->im[0]; // times exp(-j phi) = c - j sn
+  int64_t hr = b->re[2], hi = b->im[2]; // times exp(+j phi) = c + j sn
+  int64_t re = ((int64_t)b->re[1] << 16) - (lr * c + li * sn) -
+               (hr * c - hi * sn);
+  int64_t im = ((int64_t)b->im[1] << 16) - (li * c - lr * sn) -
+               (hi * c + hr * sn);
+
+  // everything is 2^15 too big, and 4 times X; scale by 1/(2 length)
+  uint8_t down = 15 + 2 + log2Length(s->length) + 1;
+  return zeroFFTBinOutput(roundShift(re, down), roundShift(im, down),
+                          s->output);
+}
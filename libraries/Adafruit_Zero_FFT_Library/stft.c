@@ -0,0 +1,140 @@
+/*
+ * stft.c
+ *
+ * Streaming short-time FFT and band averaging on top of ZeroFFTReal().
+ */
+
+#include "Adafruit_ZeroFFT.h"
+
+int ZeroSTFTInit(ZeroSTFT *stft, q15_t *ring, uint16_t ringLength,
+                 q15_t *frame, uint16_t length, uint16_t hop,
+                 uint8_t output) {
+  if ((length < 32u) || (length > ZERO_FFT_MAX) || (length & (length - 1u)))
+    return -1;
+  if ((hop == 0) || (hop > length) || ((uint32_t)length + hop > ringLength))
+    return -1;
+  if ((ring == NULL) || (frame == NULL) || ((uintptr_t)frame & 3u))
+    return -1;
+
+  stft->ring = ring;
+  stft->frame = frame;
+  stft->ringLength = ringLength;
+  stft->length = length;
+  stft->hop = hop;
+  stft->head = 0;
+  stft->tail = 0;
+  stft->output = output;
+  stft->written = 0;
+  stft->filling = 0;
+  stft->next = length;
+  stft->dropped = 0;
+  return 0;
+}
+
+void ZeroSTFTWrite(ZeroSTFT *stft, const q15_t *samples, uint16_t count) {
+  uint16_t head = stft->head;
+  uint16_t total = count;
+  // claim the samples first, so a reader that interrupts this one keeps off
+  stft->filling = total;
+  while (count) {
+    uint16_t n = stft->ringLength - head;
+    if (n > count)
+      n = count;
+    memcpy(stft->ring + head, samples, n * sizeof(q15_t));
+    samples += n;
+    count -= n;
+    head += n;
+    if (head == stft->ringLength)
+      head = 0;
+  }
+  stft->head = head;
+  // only count the samples once they are in the ring
+  stft->written += total;
+  stft->filling = 0;
+}
+
+q15_t *ZeroSTFTRead(ZeroSTFT *stft) {
+  uint16_t length = stft->length;
+  q15_t *frame = stft->frame;
+
+  for (;;) {
+    // samples still being copied in count as written, the frame can't use
+    // their place in the ring. Read filling first: a write that interrupts
+    // us between the two has finished, and is counted in written
+    uint16_t filling = stft->filling;
+    uint32_t behind = stft->written - stft->next;
+    if ((int32_t)behind < 0)
+      return NULL;
+
+    if (behind + filling + length > stft->ringLength) {
+      // the start of this frame has been overwritten, skip to the newest one
+      uint32_t skip = behind / stft->hop;
+      stft->next += skip * stft->hop;
+      stft->tail = (stft->tail + skip * stft->hop) % stft->ringLength;
+      stft->dropped += skip;
+      // even that one is being written over, wait for the writer
+      if (behind - skip * stft->hop + filling + length > stft->ringLength)
+        return NULL;
+    }
+
+    // copy the frame out of the ring, oldest sample first
+    uint16_t n = stft->ringLength - stft->tail;
+    if (n > length)
+      n = length;
+    memcpy(frame, stft->ring + stft->tail, n * sizeof(q15_t));
+    memcpy(frame + n, stft->ring, (length - n) * sizeof(q15_t));
+
+    // if the writer got all the way round to it meanwhile, try the next frame
+    filling = stft->filling;
+    if (stft->written - stft->next + filling + length > stft->ringLength)
+      continue;
+
+    stft->next += stft->hop;
+    stft->tail += stft->hop;
+    if (stft->tail >= stft->ringLength)
+      stft->tail -= stft->ringLength;
+    break;
+  }
+
+  // remove any DC offset, like the PDM examples do, so it doesn't leak into
+  // the lowest bins
+  int32_t sum = 0;
+  for (uint16_t i = 0; i < length; i++)
+    sum += frame[i];
+  int32_t mean = sum / length;
+  for (uint16_t i = 0; i < length; i++) {
+    int32_t v = frame[i] - mean;
+    frame[i] = v > 32767 ? 32767 : (v < -32768 ? -32768 : v);
+  }
+
+  ZeroFFTReal(frame, length, stft->output);
+  return frame;
+}
+
+int ZeroFFTBandEdges(uint16_t *edges, uint8_t numBands, uint16_t firstBin,
+                     uint16_t lastBin) {
+  if ((numBands == 0) || (firstBin == 0) || (lastBin < firstBin))
+    return -1;
+
+  // the edges go up by the same ratio each band, but never by less than a bin
+  float ratio = logf((float)(lastBin + 1u) / firstBin) / numBands;
+  edges[0] = firstBin;
+  for (uint8_t b = 1; b < numBands; b++) {
+    uint16_t edge = (uint16_t)(firstBin * expf(ratio * b) + 0.5f);
+    if (edge <= edges[b - 1])
+      edge = edges[b - 1] + 1u;
+    edges[b] = edge;
+  }
+  edges[numBands] = lastBin + 1u;
+  return edges[numBands - 1] < edges[numBands] ? 0 : -1;
+}
+
+void ZeroFFTBands(const q15_t *spectrum, const uint16_t *edges,
+                  uint8_t numBands, q15_t *bands) {
+  for (uint8_t b = 0; b < numBands; b++) {
+    int32_t sum = 0;
+    for (uint16_t i = edges[b]; i < edges[b + 1]; i++)
+      sum += spectrum[i];
+    bands[b] = sum / (int32_t)(edges[b + 1] - edges[b]);
+  }
+}
@@ -0,0 +1,122 @@
+/*!
+ * @file Adafruit_PDMDecimator.cpp
+ */
+#include "Adafruit_PDMDecimator.h"
+#include <stdlib.h>
+
+// Low pass filters for each decimation ratio. Each sums to about 65535, so
+// all ones gives a full scale output. The 64 tap filter is the one the SPI
+// driver has always used; the others are the same shape, stretched.
+static uint16_t const sincfilter32[32] = {
+    0,    20,   86,   209,  399,  675,  1044, 1504, 2048, 2651, 3275,
+    3879, 4416, 4838, 5107, 5200, 5107, 4838, 4416, 3879, 3275, 2651,
+    2048, 1504, 1044, 675,  399,  209,  86,   20,   0,    0};
+
+static uint16_t const sincfilter64[64] = {
+    0,    2,    9,    21,   39,   63,   94,   132,  179,  236,  302,
+    379,  467,  565,  674,  792,  920,  1055, 1196, 1341, 1487, 1633,
+    1776, 1913, 2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516, 2506,
+    2474, 2422, 2352, 2263, 2159, 2042, 1913, 1776, 1633, 1487, 1341,
+    1196, 1055, 920,  792,  674,  565,  467,  379,  302,  236,  179,
+    132,  94,   63,   39,   21,   9,    2,    0,    0};
+
+static uint16_t const sincfilter128[128] = {
+    0,    0,    1,    2,    4,    7,    10,   14,   19,   24,   30,   37,
+    45,   53,   63,   73,   85,   98,   112,  127,  143,  161,  179,  200,
+    221,  244,  268,  293,  319,  347,  375,  405,  436,  468,  501,  534,
+    568,  603,  638,  674,  709,  744,  780,  815,  850,  884,  917,  950,
+    981,  1011, 1040, 1068, 1093, 1117, 1140, 1160, 1178, 1193, 1207, 1218,
+    1227, 1233, 1237, 1238, 1237, 1233, 1227, 1218, 1207, 1193, 1178, 1160,
+    1140, 1117, 1093, 1068, 1040, 1011, 981,  950,  917,  884,  850,  815,
+    780,  744,  709,  674,  638,  603,  568,  534,  501,  468,  436,  405,
+    375,  347,  319,  293,  268,  244,  221,  200,  179,  161,  143,  127,
+    112,  98,   85,   73,   63,   53,   45,   37,   30,   24,   19,   14,
+    10,   7,    4,    2,    1,    0,    0,    0};
+
+#define TABLE_ENTRIES (1 << PDM_DECIMATOR_TABLE_BITS) //!< entries per table
+#define TABLE_MASK (TABLE_ENTRIES - 1) //!< bits looked up at once
+#define TABLES_PER_WORD (32 / PDM_DECIMATOR_TABLE_BITS) //!< per 32 bits
+
+Adafruit_PDMDecimator::Adafruit_PDMDecimator() {}
+
+Adafruit_PDMDecimator::~Adafruit_PDMDecimator() { end(); }
+
+bool Adafruit_PDMDecimator::begin(uint8_t decimation) {
+  const uint16_t *taps;
+  switch (decimation) {
+  case 32:
+    taps = sincfilter32;
+    break;
+  case 64:
+    taps = sincfilter64;
+    break;
+  case 128:
+    taps = sincfilter128;
+    break;
+  default:
+    return false;
+  }
+
+  end();
+  uint16_t numTables = decimation / PDM_DECIMATOR_TABLE_BITS;
+  _table = (uint16_t *)malloc(numTables * TABLE_ENTRIES * sizeof(uint16_t));
+  if (!_table)
+    return false;
+
+  // Table t, entry e is the sum of the taps for the bits set in e, for the
+  // t'th group of bits
+  for (uint16_t t = 0; t < numTables; t++) {
+    const uint16_t *tap = &taps[t * PDM_DECIMATOR_TABLE_BITS];
+    uint16_t *entry = &_table[t * TABLE_ENTRIES];
+    entry[0] = 0;
+    for (uint16_t e = 1; e < TABLE_ENTRIES; e++) {
+      // add the highest bit's tap to the entry for the remaining bits
+      uint8_t b = 0;
+      while (e >> (b + 1))
+        b++;
+      entry[e] = entry[e & ~(1u << b)] + tap[b];
+    }
+  }
+
+  _words = decimation / 32;
+  _word = 0;
+  _sum = 0;
+  return true;
+}
+
+void Adafruit_PDMDecimator::end() {
+  free(_table);
+  _table = NULL;
+  _words = 0;
+}
+
+// The sum of the taps for the set bits of one 32 bit word of a sample
+uint32_t Adafruit_PDMDecimator::wordSum(uint8_t word, uint32_t bits) {
+  const uint16_t *table = &_table[word * TABLES_PER_WORD * TABLE_ENTRIES];
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < TABLES_PER_WORD; i++) {
+    sum += table[bits & TABLE_MASK];
+    bits >>= PDM_DECIMATOR_TABLE_BITS;
+    table += TABLE_ENTRIES;
+  }
+  return sum;
+}
+
+bool Adafruit_PDMDecimator::pushWord(uint32_t bits, uint16_t *value) {
+  uint32_t sum = _sum + wordSum(_word, bits);
+  if (++_word < _words) {
+    _sum = sum;
+    return false;
+  }
+  _word = 0;
+  _sum = 0;
+  *value = sum;
+  return true;
+}
+
+uint16_t Adafruit_PDMDecimator::decimate(const uint32_t *words) {
+  uint32_t sum = 0;
+  for (uint8_t w = 0; w < _words; w++)
+    sum += wordSum(w, words[w]);
+  return sum;
+}
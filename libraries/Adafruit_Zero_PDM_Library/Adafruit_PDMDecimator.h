@@ -0,0 +1,74 @@
+/*!
+ * @file Adafruit_PDMDecimator.h
+ */
+#ifndef ADAFRUIT_PDMDECIMATOR_H
+#define ADAFRUIT_PDMDECIMATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * Bits of PDM data looked up at once. 4 needs 8 bytes of RAM per tap
+ * (512 bytes at 64x decimation) and 8 looks up twice as many bits at a time
+ * for 64 bytes per tap (4 KB at 64x).
+ */
+#ifndef PDM_DECIMATOR_TABLE_BITS
+#define PDM_DECIMATOR_TABLE_BITS 4
+#endif
+
+/*!
+ * PDM to PCM decimating filter. The filter is applied with tables of the sum
+ * of the taps for every pattern of PDM_DECIMATOR_TABLE_BITS bits, built by
+ * begin(), rather than by testing every bit, and has no hardware
+ * dependencies.
+ */
+class Adafruit_PDMDecimator {
+public:
+  Adafruit_PDMDecimator();
+  ~Adafruit_PDMDecimator();
+
+  /*!
+   * @brief Set up the filter tables
+   * @param decimation PDM bits per output sample: 32, 64 or 128
+   * @return true on success, false if the ratio isn't supported or there
+   *         isn't enough memory for the tables
+   */
+  bool begin(uint8_t decimation = 64);
+
+  /*!
+   * @brief Free the filter tables
+   */
+  void end();
+
+  /*!
+   * @brief Add the next 32 bits of PDM data, earliest bit in the LSB
+   * @param bits the PDM data
+   * @param value Variable to set the new sample to, 0 to 65535
+   * @return true when a sample was completed and stored in value
+   */
+  bool pushWord(uint32_t bits, uint16_t *value);
+
+  /*!
+   * @brief Filter one sample's worth of PDM data at once
+   * @param words decimation / 32 words of PDM data, earliest bit in the LSB
+   *        of the first word
+   * @return the sample, 0 to 65535
+   */
+  uint16_t decimate(const uint32_t *words);
+
+  /*!
+   * @brief Get the decimation ratio
+   * @return PDM bits per output sample, or 0 before begin()
+   */
+  uint8_t getDecimation(void) { return _words * 32; };
+
+private:
+  uint16_t *_table = NULL;
+  uint8_t _words = 0; // 32 bit words per output sample
+  uint8_t _word = 0;  // words so far in this sample
+  uint32_t _sum = 0;  // partial sum of this sample
+
+  uint32_t wordSum(uint8_t word, uint32_t bits);
+};
+
+#endif
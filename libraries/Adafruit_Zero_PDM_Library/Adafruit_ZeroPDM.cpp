@@ -467,6 +467,101 @@ uint32_t Adafruit_ZeroPDM::read(void) {
   }
 }
 
+Adafruit_ZeroPDM *Adafruit_ZeroPDM::_captureInstance = NULL;
+
+// Half 'n' of the buffer holds every other block, so when block n completes
+// the DMA goes on to overwrite block n - 1. If that hasn't been read yet, it's
+// lost.
+void Adafruit_ZeroPDM::dmaCallback(Adafruit_ZeroDMA *dma) {
+  (void)dma;
+  Adafruit_ZeroPDM *pdm = _captureInstance;
+  uint32_t filled = pdm->_filled + 1;
+  pdm->_filled = filled;
+  if (filled - pdm->_read > 1)
+    pdm->_overruns++;
+}
+
+bool Adafruit_ZeroPDM::startCapture(uint32_t *buffer, uint16_t blockWords,
+                                    uint8_t decimation) {
+#if defined(ARDUINO_SAMD_ZERO)
+  stopCapture();
+  if (!blockWords || (blockWords % (decimation / 16)))
+    return false;
+  if (!_decimator.begin(decimation))
+    return false;
+
+  // The channel and its two descriptors are set up once, then just pointed
+  // at the new buffer by later calls
+  void *src = (void *)&_hw->DATA[_i2sserializer].reg;
+  if (!_desc[0]) {
+    _dma.setTrigger(I2S_DMAC_ID_RX_0 + _i2sserializer);
+    _dma.setAction(DMA_TRIGGER_ACTON_BEAT);
+    if (_dma.allocate() != DMA_STATUS_OK)
+      return false;
+    for (uint8_t h = 0; h < 2; h++) {
+      _desc[h] = _dma.addDescriptor(src, &buffer[h * blockWords], blockWords,
+                                    DMA_BEAT_SIZE_WORD, false, true);
+      if (!_desc[h])
+        return false;
+      // interrupt at the end of each half, not just the whole list
+      _desc[h]->BTCTRL.bit.BLOCKACT = DMA_BLOCK_ACTION_INT;
+    }
+    _dma.loop(true);
+    _dma.setCallback(dmaCallback);
+  } else {
+    for (uint8_t h = 0; h < 2; h++)
+      _dma.changeDescriptor(_desc[h], src, &buffer[h * blockWords],
+                            blockWords);
+  }
+
+  _captureBuffer = buffer;
+  _blockWords = blockWords;
+  _filled = _read = _overruns = 0;
+  _captureInstance = this;
+  return _dma.startJob() == DMA_STATUS_OK;
+#else
+  (void)buffer;
+  (void)blockWords;
+  (void)decimation;
+  return false;
+#endif
+}
+
+void Adafruit_ZeroPDM::stopCapture(void) {
+  if (_desc[0])
+    _dma.abort();
+  _filled = _read = 0;
+}
+
+uint16_t Adafruit_ZeroPDM::readBlock(uint16_t *samples) {
+  uint32_t filled = _filled;
+  if (filled == _read)
+    return 0;
+  if (filled - _read > 1)
+    _read = filled - 1; // older halves were overwritten, see dmaCallback()
+  uint32_t reading = _read;
+
+  // In PDM2 mode each word holds 16 bits of PDM data in its low half, earliest
+  // bit in the LSB (BITREV), so pairs of words pack into one for the decimator
+  const uint32_t *block = &_captureBuffer[(_read & 1) * _blockWords];
+  uint8_t words = _decimator.getDecimation() / 16;
+  uint16_t n = 0;
+  for (uint16_t w = 0; w < _blockWords; w += words) {
+    uint32_t packed[4];
+    for (uint8_t i = 0; i < words / 2; i++)
+      packed[i] = (block[w + 2 * i] & 0xFFFF) | (block[w + 2 * i + 1] << 16);
+    samples[n++] = _decimator.decimate(packed);
+  }
+  _read = reading + 1;
+
+  // If the DMA finished the next half while this one was being decimated, it
+  // has gone on to overwrite this one, so what was read may be torn. Drop it;
+  // dmaCallback() has already counted the overrun.
+  if (_filled - reading > 1)
+    return 0;
+  return n;
+}
+
 /// @cond DISABLE
 #endif // I2S defined
 /// @endcond DISABLE
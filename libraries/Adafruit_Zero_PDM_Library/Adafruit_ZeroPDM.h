@@ -10,6 +10,9 @@
 #if defined(I2S)
 /// @endcond DISABLE
 
+#include "Adafruit_PDMDecimator.h"
+#include <Adafruit_ZeroDMA.h>
+
 // Uncomment to enable debug message output.
 #define DEBUG //!< Enables or disables debug
 
@@ -71,6 +74,61 @@ public:
    */
   bool read(uint32_t *buffer, int bufsiz);
 
+  /*!
+   * @brief Start capturing continuously with DMA. The buffer is split in two
+   * halves; the DMA fills one while the other is decimated by readBlock(), so
+   * no PDM data is missed while the sketch is busy for up to a half's worth of
+   * time. Call after configure() in stereo (PDM2) mode with decimation / 16
+   * times the output sample rate, as in the examples.
+   * @param buffer 2 * blockWords words for the DMA to fill
+   * @param blockWords Words of PDM data per half, a multiple of
+   *        decimation / 16
+   * @param decimation PDM bits per output sample: 32, 64 or 128
+   * @return true on success
+   */
+  bool startCapture(uint32_t *buffer, uint16_t blockWords,
+                    uint8_t decimation = 64);
+
+  /*!
+   * @brief Stop the DMA capture started by startCapture()
+   */
+  void stopCapture(void);
+
+  /*!
+   * @brief Check for a captured half that hasn't been read yet
+   * @return true if readBlock() has a half to decimate
+   */
+  bool available(void) { return _filled != _read; };
+
+  /*!
+   * @brief Decimate the oldest captured half that hasn't been overwritten.
+   * Halves the DMA came back round to before they were read are skipped and
+   * counted by getOverruns(). If the DMA comes back round to the half while
+   * it is being decimated, the half is dropped and counted the same way, and
+   * samples holds nothing useful.
+   * @param samples Buffer for getBlockSamples() samples, 0 to 65535
+   * @return the number of samples stored, 0 if no half was ready or it was
+   *         overwritten while being read
+   */
+  uint16_t readBlock(uint16_t *samples);
+
+  /*!
+   * @brief Get the number of samples readBlock() makes from each half
+   * @return blockWords * 16 / decimation
+   */
+  uint16_t getBlockSamples(void) {
+    return _decimator.getDecimation() ? _blockWords * 16 /
+                                            _decimator.getDecimation()
+                                      : 0;
+  };
+
+  /*!
+   * @brief Get the number of halves lost since startCapture(), because the
+   * DMA started filling them again before readBlock() was done with them
+   * @return the overrun count
+   */
+  uint32_t getOverruns(void) { return _overruns; };
+
 private:
   uint8_t _gclk;
   int _clk, _data;
@@ -79,6 +137,18 @@ private:
   uint8_t _i2sclock;
 
   I2s *_hw;
+
+  Adafruit_ZeroDMA _dma;
+  DmacDescriptor *_desc[2] = {NULL, NULL}; // ping and pong halves
+  Adafruit_PDMDecimator _decimator;
+  uint32_t *_captureBuffer = NULL;
+  uint16_t _blockWords = 0;
+  volatile uint32_t _filled = 0;   // halves completed by the DMA
+  volatile uint32_t _read = 0;     // halves read by readBlock()
+  volatile uint32_t _overruns = 0; // halves overwritten before they were read
+
+  static Adafruit_ZeroPDM *_captureInstance;
+  static void dmaCallback(Adafruit_ZeroDMA *dma);
 };
 
 #ifndef I2S_H_INCLUDED
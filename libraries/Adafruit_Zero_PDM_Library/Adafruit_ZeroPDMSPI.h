@@ -8,6 +8,7 @@
 #if defined(__SAMD51__)
 /// @endcond DISABLE
 
+#include "Adafruit_PDMDecimator.h"
 #include <Arduino.h>
 #include <SPI.h>
 
@@ -25,15 +26,20 @@ public:
   /*!
    * @brief Initialize the SPI audio receiver.
    * @param freq Frequency (in Hertz)
+   * @param decimation PDM bits per sample: 32, 64 or 128. The PDM clock is
+   *        freq * decimation
    * @return Returns if connection was successful
    */
-  bool begin(uint32_t freq);
+  bool begin(uint32_t freq, uint8_t decimation = 64);
 
   /*!
-   * @brief Alternates 0 to 1 to let you know that data is ready to be read
+   * @brief Reads the next PDM word and filters it. Each output sample takes
+   *        decimation / 32 words: every word at 32x, every 2nd at 64x and
+   *        every 4th at 128x
    * @param value Variable to set the reading to
    * @param removeDC Whether or not to remove the DC offset
-   * @return Returns if the word is even or not
+   * @return Returns true once per completed output sample, when a new sample
+   *         was stored in value; false while more words are needed for it
    */
   bool decimateFilterWord(uint16_t *value, bool removeDC = true);
 
@@ -53,6 +59,7 @@ private:
   Sercom *_sercom = NULL;
   IRQn_Type _irq;
   volatile uint32_t *_dataReg;
+  Adafruit_PDMDecimator _decimator;
 
   uint16_t dcCounter = 0;         // Rolls over every DC_PERIOD samples
   uint32_t dcSum = 0;             // Accumulates DC_PERIOD samples
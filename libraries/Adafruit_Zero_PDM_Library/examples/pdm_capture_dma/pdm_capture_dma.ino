@@ -0,0 +1,62 @@
+#include <Adafruit_ZeroPDM.h>
+
+// Create PDM receiver object, with Clock and Data pins used (not all pins available)
+Adafruit_ZeroPDM pdm = Adafruit_ZeroPDM(1, 4);      // Metro M0 or Arduino zero
+//Adafruit_ZeroPDM pdm = Adafruit_ZeroPDM(34, 35);  // CPlay express
+
+#define SAMPLERATE_HZ 16000
+#define DECIMATION    64
+
+// The DMA fills one half of this while the other half is decimated, so the
+// sketch can spend up to a half's worth of time (here 256 samples = 16 ms)
+// on each block without losing any audio.
+#define BLOCK_SAMPLES 256
+#define BLOCK_WORDS   (BLOCK_SAMPLES * DECIMATION / 16)  // 16 bits per 'I2S sample'
+uint32_t pdmBuffer[2 * BLOCK_WORDS];
+uint16_t samples[BLOCK_SAMPLES];
+
+void setup() {
+  // Configure serial port.
+  while (!Serial);
+  Serial.begin(115200);
+  Serial.println("SAMD PDM DMA Capture Demo");
+
+  // Initialize the PDM/I2S receiver
+  if (!pdm.begin()) {
+    Serial.println("Failed to initialize I2S/PDM!");
+    while (1);
+  }
+
+  // Configure PDM receiver, sample rate
+  if (!pdm.configure(SAMPLERATE_HZ * DECIMATION / 16, true)) {
+    Serial.println("Failed to configure PDM");
+    while (1);
+  }
+
+  // Start the DMA, it runs from now on without the sketch's help
+  if (!pdm.startCapture(pdmBuffer, BLOCK_WORDS, DECIMATION)) {
+    Serial.println("Failed to start DMA capture");
+    while (1);
+  }
+  Serial.println("Capturing");
+}
+
+void loop() {
+  if (!pdm.available()) return;
+
+  uint16_t n = pdm.readBlock(samples);
+  if (!n) return;  // overwritten while it was being read, see getOverruns()
+
+  // peak to peak level of the block
+  uint16_t lo = 65535, hi = 0;
+  for (uint16_t i = 0; i < n; i++) {
+    if (samples[i] < lo) lo = samples[i];
+    if (samples[i] > hi) hi = samples[i];
+  }
+
+  // printing takes a while, but the DMA keeps capturing meanwhile; if it
+  // ever takes longer than a block, getOverruns() counts the lost blocks
+  Serial.print(hi - lo);
+  Serial.print("\toverruns: ");
+  Serial.println(pdm.getOverruns());
+}
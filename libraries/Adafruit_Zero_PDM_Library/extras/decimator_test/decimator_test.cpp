@@ -0,0 +1,203 @@
+// Host test and benchmark for Adafruit_PDMDecimator. Feeds it a second-order
+// sigma-delta bitstream of a 1 kHz sine at -6 dB, 16 kHz out, and checks:
+// - 64x output is bit-exact against the old bit-at-a-time sincfilter code
+// - decimate() and pushWord() agree
+// - all ones gives about full scale (each filter sums to about 65535) and
+//   all zeros gives 0, at every ratio
+// - the SNR at 32x, 64x and 128x
+// It also times each ratio, in ns and (on x86) TSC cycles per output sample,
+// against the bit-at-a-time code. Build with PDM_DECIMATOR_TABLE_BITS=4 and 8
+// to compare the table sizes; host timings only show the relative cost.
+//
+// Usage: decimator_test   (see Makefile)
+
+#include "Adafruit_PDMDecimator.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC
+#endif
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint64_t cycles(void) {
+#ifdef HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+// The 64x filter as the SPI driver used it before the tables
+static const uint16_t sincfilter[64] = {
+    0,    2,    9,    21,   39,   63,   94,   132,  179,  236,  302,
+    379,  467,  565,  674,  792,  920,  1055, 1196, 1341, 1487, 1633,
+    1776, 1913, 2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516, 2506,
+    2474, 2422, 2352, 2263, 2159, 2042, 1913, 1776, 1633, 1487, 1341,
+    1196, 1055, 920,  792,  674,  565,  467,  379,  302,  236,  179,
+    132,  94,   63,   39,   21,   9,    2,    0,    0};
+
+// The old decimateFilterWord(): test each bit, add its tap
+static uint32_t bitAtATime(uint32_t bits, const uint16_t *taps) {
+  uint32_t sum = 0;
+  for (int i = 0; i < 32; i++)
+    if (bits & (1u << i))
+      sum += taps[i];
+  return sum;
+}
+
+// Second-order sigma-delta modulator, earliest bit in the LSB
+static std::vector<uint32_t> modulate(double bitRate, double freq, double amp,
+                                      size_t words) {
+  std::vector<uint32_t> w(words);
+  double i1 = 0, i2 = 0, y = 0;
+  for (size_t k = 0; k < words; k++) {
+    uint32_t v = 0;
+    for (int b = 0; b < 32; b++) {
+      double x = amp * sin(2 * M_PI * freq * (k * 32.0 + b) / bitRate);
+      i1 += x - y;
+      i2 += i1 - y;
+      y = (i2 >= 0) ? 1 : -1;
+      if (y > 0)
+        v |= 1u << b;
+    }
+    w[k] = v;
+  }
+  return w;
+}
+
+// Fit a sine at freq, everything else is noise
+static double snr(const std::vector<double> &x, double rate, double freq) {
+  size_t n = x.size();
+  double mean = 0, c = 0, s = 0;
+  for (size_t i = 0; i < n; i++)
+    mean += x[i];
+  mean /= n;
+  for (size_t i = 0; i < n; i++) {
+    c += (x[i] - mean) * cos(2 * M_PI * freq * i / rate);
+    s += (x[i] - mean) * sin(2 * M_PI * freq * i / rate);
+  }
+  c *= 2.0 / n;
+  s *= 2.0 / n;
+  double signal = 0, noise = 0;
+  for (size_t i = 0; i < n; i++) {
+    double fit = c * cos(2 * M_PI * freq * i / rate) +
+                 s * sin(2 * M_PI * freq * i / rate);
+    signal += fit * fit;
+    noise += (x[i] - mean - fit) * (x[i] - mean - fit);
+  }
+  return 10 * log10(signal / noise);
+}
+
+int main(void) {
+  const double outRate = 16000;
+  const size_t samples = 16384;
+  const double minSNR[3] = {30, 46, 60}; // 32x, 64x, 128x
+  volatile uint32_t sink = 0;
+
+  printf("PDM_DECIMATOR_TABLE_BITS=%d\n", PDM_DECIMATOR_TABLE_BITS);
+  for (int dec = 32, r = 0; dec <= 128; dec *= 2, r++) {
+    Adafruit_PDMDecimator d;
+    CHECK(d.begin(dec), "begin(%d) failed", dec);
+    size_t words = dec / 32;
+    std::vector<uint32_t> w = modulate(outRate * dec, 1000, 0.5,
+                                       samples * words);
+
+    std::vector<double> out;
+    size_t mismatches = 0;
+    uint16_t v;
+    for (size_t k = 0; k < w.size(); k++)
+      if (d.pushWord(w[k], &v)) {
+        out.push_back(v);
+        if (d.decimate(&w[k + 1 - words]) != v)
+          mismatches++;
+      }
+    CHECK(out.size() == samples, "%dx gave %zu samples", dec, out.size());
+    CHECK(!mismatches, "%dx decimate() and pushWord() differ %zu times", dec,
+          mismatches);
+
+    double s = snr(out, outRate, 1000);
+    CHECK(s >= minSNR[r], "%dx SNR %.1f dB", dec, s);
+
+    uint32_t ones[4] = {~0u, ~0u, ~0u, ~0u}, zeros[4] = {0, 0, 0, 0};
+    uint16_t full = d.decimate(ones);
+    CHECK(full >= 65000, "%dx all ones gives %u", dec, full);
+    CHECK(d.decimate(zeros) == 0, "%dx all zeros isn't 0", dec);
+
+    double best = 1e9, bestCycles = 1e9;
+    for (int rep = 0; rep < 7; rep++) {
+      double t0 = now();
+      uint64_t c0 = cycles();
+      for (size_t k = 0; k < w.size(); k++)
+        if (d.pushWord(w[k], &v))
+          sink += v;
+      double c = (double)(cycles() - c0) / samples;
+      double t = (now() - t0) / samples * 1e9;
+      if (t < best)
+        best = t;
+      if (c < bestCycles)
+        bestCycles = c;
+    }
+    printf("%3dx: SNR %.1f dB, all ones %u, %.1f ns", dec, s, full, best);
+#ifdef HAVE_TSC
+    printf(" / %.0f cycles", bestCycles);
+#endif
+    printf(" per sample\n");
+
+    if (dec == 64) {
+      size_t diff = 0;
+      for (size_t i = 0; i < samples; i++)
+        if (bitAtATime(w[2 * i], sincfilter) +
+                bitAtATime(w[2 * i + 1], sincfilter + 32) !=
+            out[i])
+          diff++;
+      CHECK(!diff, "64x differs from bit-at-a-time in %zu samples", diff);
+
+      best = bestCycles = 1e9;
+      for (int rep = 0; rep < 7; rep++) {
+        double t0 = now();
+        uint64_t c0 = cycles();
+        for (size_t i = 0; i < samples; i++)
+          sink += bitAtATime(w[2 * i], sincfilter) +
+                  bitAtATime(w[2 * i + 1], sincfilter + 32);
+        double c = (double)(cycles() - c0) / samples;
+        double t = (now() - t0) / samples * 1e9;
+        if (t < best)
+          best = t;
+        if (c < bestCycles)
+          bestCycles = c;
+      }
+      printf("     bit-at-a-time: %s, %.1f ns", diff ? "differs" : "bit-exact",
+             best);
+#ifdef HAVE_TSC
+      printf(" / %.0f cycles", bestCycles);
+#endif
+      printf(" per sample\n");
+    }
+  }
+
+  Adafruit_PDMDecimator d;
+  CHECK(!d.begin(48), "begin(48) accepted");
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
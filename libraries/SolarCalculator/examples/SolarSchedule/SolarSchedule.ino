@@ -0,0 +1,74 @@
+//======================================================================================================================
+// SolarCalculator Library for Arduino example sketch: SolarSchedule.ino
+//
+// Precompute a month of sunrise, sunset, and twilight times for a location, then look them up without recalculating.
+// Useful for lights, clocks, and timers that check the times often.
+//
+// Tested with Arduino IDE 1.8.19 and Arduino Uno
+//======================================================================================================================
+
+#include <SolarCalculator.h>
+
+// Location
+double latitude = 45.55;
+double longitude = -73.633;
+int utc_offset = -5;
+
+// One month, 18 bytes per day
+SolarDayEvents days[31];
+SolarSchedule schedule(days, 31);
+
+void setup()
+{
+  Serial.begin(9600);
+
+  // Calculate every event for January 2022, in one pass
+  unsigned long start = millis();
+  calcSolarSchedule(schedule, 2022, 1, 1, latitude, longitude);
+  Serial.print(F("31 days calculated in "));
+  Serial.print(millis() - start);
+  Serial.println(F(" ms"));
+  Serial.println(F("Day  Dawn   Rise   Noon   Set    Dusk"));
+
+  // Look up each day (this is just array indexing)
+  char str[6];
+  for (int day = 1; day <= 31; day++)
+  {
+    double transit, sunrise, sunset, dawn, dusk;
+    getSolarEvents(schedule, 2022, 1, day, SUNRISE_SUNSET, transit, sunrise, sunset);
+    getSolarEvents(schedule, 2022, 1, day, CIVIL_DAWNDUSK, transit, dawn, dusk);
+
+    if (day < 10) Serial.print(' ');
+    Serial.print(day);
+    Serial.print(F("   "));
+    Serial.print(hoursToString(dawn + utc_offset, str));
+    Serial.print(' ');
+    Serial.print(hoursToString(sunrise + utc_offset, str));
+    Serial.print(' ');
+    Serial.print(hoursToString(transit + utc_offset, str));
+    Serial.print(' ');
+    Serial.print(hoursToString(sunset + utc_offset, str));
+    Serial.print(' ');
+    Serial.println(hoursToString(dusk + utc_offset, str));
+  }
+}
+
+void loop()
+{
+}
+
+// Rounded HH:mm format
+char * hoursToString(double h, char *str)
+{
+  int m = int(round(h * 60));
+  int hr = (m / 60) % 24;
+  int mn = m % 60;
+
+  str[0] = (hr / 10) % 10 + '0';
+  str[1] = (hr % 10) + '0';
+  str[2] = ':';
+  str[3] = (mn / 10) % 10 + '0';
+  str[4] = (mn % 10) + '0';
+  str[5] = '\0';
+  return str;
+}
@@ -0,0 +1,131 @@
+// Host check for the solar event schedule. For a grid of latitudes from
+// 85S to 85N, at five longitudes including both sides of the date line, and
+// every day of 2001, 2024 and 2050, compares getSolarEvents() with
+// calcSunriseSunset(), calcCivilDawnDusk(), calcNauticalDawnDusk() and
+// calcAstronomicalDawnDusk(): every time must be within a few seconds, and
+// an event missing (NaN, the Sun never reaching that altitude) from one
+// must be missing from the other. Also checks the year/month/day lookup,
+// that dates outside the schedule are refused, and times building a
+// schedule against calling the four functions.
+//
+// Usage: make
+
+#include <cmath>
+#include <stdio.h>
+#include <time.h>
+#include "SolarCalculator.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+typedef void (*EventFunc)(unsigned long, double, double, double &, double &,
+                          double &);
+
+static const EventFunc direct[4] = {
+    [](unsigned long utc, double lat, double lon, double &tr, double &r,
+       double &s) { calcSunriseSunset(utc, lat, lon, tr, r, s); },
+    calcCivilDawnDusk, calcNauticalDawnDusk, calcAstronomicalDawnDusk};
+static const char *const names[4] = {"sunrise/sunset", "civil", "nautical",
+                                     "astronomical"};
+
+static const double MAX_ERROR = 3; // seconds; times are stored to 4 s
+
+int main(void) {
+  static SolarDayEvents storage[366];
+  SolarSchedule schedule(storage, 366);
+  const double longitudes[] = {0, -73.6, 139.7, 179.9, -179.9};
+  const int years[] = {2001, 2024, 2050};
+  double worst = 0;
+  long compared = 0, tooFar = 0, none = 0, nanMismatch = 0;
+
+  for (double lat = -85; lat <= 85; lat += 5) {
+    for (double lon : longitudes) {
+      for (int year : years) {
+        calcSolarSchedule(schedule, year, 1, 1, lat, lon);
+        unsigned long const first = schedule.firstDay * 86400UL;
+        for (int d = 0; d < schedule.numDays; d++) {
+          // any time of day finds the day's entry
+          unsigned long const utc = first + d * 86400UL;
+          for (int type = 0; type < 4; type++) {
+            double want[3], got[3];
+            direct[type](utc, lat, lon, want[0], want[1], want[2]);
+            if (!getSolarEvents(schedule, utc + 43200, (SolarEventType)type,
+                                got[0], got[1], got[2])) {
+              CHECK(false, "%d-%03d lat %g lon %g: day not in schedule", year,
+                    d + 1, lat, lon);
+              continue;
+            }
+            for (int k = 0; k < 3; k++) {
+              if (std::isnan(want[k]) || std::isnan(got[k])) {
+                none += std::isnan(want[k]) && std::isnan(got[k]);
+                if ((std::isnan(want[k]) != std::isnan(got[k])) &&
+                    (nanMismatch++ < 10))
+                  printf("%d-%03d lat %g lon %g %s: %g, schedule %g\n", year,
+                         d + 1, lat, lon, names[type], want[k], got[k]);
+                continue;
+              }
+              double const e = std::fabs(want[k] - got[k]) * 3600;
+              compared++;
+              if (e > worst)
+                worst = e;
+              if ((e > MAX_ERROR) && (tooFar++ < 10))
+                printf("%d-%03d lat %g lon %g %s: %.5f h, schedule %.5f h\n",
+                       year, d + 1, lat, lon, names[type], want[k], got[k]);
+            }
+          }
+        }
+      }
+    }
+  }
+  printf("%ld times compared, worst %.2f s; %ld events missing from both, "
+         "%ld from only one\n",
+         compared, worst, none, nanMismatch);
+  CHECK(!tooFar, "%ld times more than %g s out", tooFar, MAX_ERROR);
+  CHECK(!nanMismatch, "%ld events missing from only one", nanMismatch);
+
+  // the date overload, and dates either side of the schedule
+  double tr, r, s, tr2, r2, s2;
+  calcSolarSchedule(schedule, 2024, 3, 1, 45.55, -73.63, 31);
+  CHECK(schedule.numDays == 31, "asked for 31 days, got %d", schedule.numDays);
+  CHECK(getSolarEvents(schedule, 2024, 3, 20, SUNRISE_SUNSET, tr, r, s),
+        "2024-03-20 not found");
+  calcSunriseSunset(2024, 3, 20, 45.55, -73.63, tr2, r2, s2);
+  CHECK((std::fabs(r - r2) * 3600 <= MAX_ERROR) &&
+            (std::fabs(s - s2) * 3600 <= MAX_ERROR),
+        "date lookup differs");
+  CHECK(!getSolarEvents(schedule, 2024, 2, 29, SUNRISE_SUNSET, tr, r, s) &&
+            !getSolarEvents(schedule, 2024, 4, 1, SUNRISE_SUNSET, tr, r, s),
+        "date outside the schedule found");
+
+  // what the schedule saves
+  double const t0 = now();
+  for (int i = 0; i < 10; i++)
+    calcSolarSchedule(schedule, 2024, 1, 1, 45.55, -73.63, 366);
+  double const t1 = now();
+  volatile double sink = 0;
+  for (int d = 0; d < 366; d++)
+    for (int type = 0; type < 4; type++) {
+      direct[type](1704067200UL + d * 86400UL, 45.55, -73.63, tr, r, s);
+      sink += r;
+    }
+  double const t2 = now();
+  printf("schedule %.1f us/day, the four calc functions %.1f us/day\n",
+         (t1 - t0) / 10 / 366, (t2 - t1) / 366);
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
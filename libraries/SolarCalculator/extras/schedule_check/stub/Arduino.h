@@ -0,0 +1,4 @@
+// Just enough of Arduino.h to build SolarCalculator on a PC
+#pragma once
+#include <math.h>
+#include <stdint.h>
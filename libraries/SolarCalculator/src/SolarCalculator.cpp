@@ -9,6 +9,7 @@
 
 #ifndef ARDUINO
 #include <cmath>
+using std::isnan;
 #endif
 
 #include "SolarCalculator.h"
@@ -365,4 +366,151 @@ void calcAstronomicalDawnDusk(int year, int month, int day, double latitude, dou
     calcSunriseSunset(year, month, day, latitude, longitude, transit, dawn, dusk, ASTRONOMICAL_DAWNDUSK_STD_ALTITUDE);
 }
 
+//======================================================================================================================
+// Solar event schedule
+//======================================================================================================================
+
+// Days since 1 January 1970, calcJulianDay() in integers
+static long calcDayNumber(int year, int month, int day)
+{
+    return 367L * year - 7 * (year + (month + 9) / 12) / 4 + 275 * month / 9 + day - 719574;
+}
+
+// Sun's coordinates at noon UT on the day before, the day of, and the day after the one being scheduled
+struct SolarScheduleCoords
+{
+    double ra[3], dec[3];
+    double GMST0;  // Sidereal time at 0h UT on the day
+};
+
+// Transit time, as a fraction of the day, for an estimate m of an event time, as calcRiseSetTimes() finds it but
+// with the coordinates interpolated to m. Also returns the Sun's declination at m.
+static double calcScheduleTransit(const SolarScheduleCoords &c, double m, double longitude, double &dec)
+{
+    double n = m - 0.5;  // from noon, within [-1, 1] for any event on the day
+    double ra = interpolateCoordinates(n, c.ra[0], c.ra[1], c.ra[2]);
+    dec = interpolateCoordinates(n, c.dec[0], c.dec[1], c.dec[2]);
+    return wrapTo360(ra - longitude - c.GMST0 - 360.985647 * m + m * 360) / 360;
+}
+
+// Local hour angle of the Sun at altitude h0, as a fraction of a day (NaN if circumpolar)
+static double calcScheduleHourAngle(double dec, double sinLat, double cosLat, double sinH0)
+{
+    return degrees(acos((sinH0 - sinLat * sin(radians(dec))) / (cosLat * cos(radians(dec))))) / 360;
+}
+
+static int16_t toScheduleTicks(double m)
+{
+    if (isnan(m))
+        return SOLAR_EVENT_NONE;
+    return static_cast<int16_t>(floor(m * (86400.0 / SOLAR_SCHEDULE_TICK) + 0.5));
+}
+
+static void calcScheduleCoords(long dayNumber, double &ra, double &dec)
+{
+    double T = (dayNumber - 10957) / 36525.0;  // noon UT, JD - 2451545
+    calcSolarCoordinates(T, ra, dec);
+}
+
+void calcSolarSchedule(SolarSchedule &schedule, unsigned long utc, double latitude, double longitude,
+                       int numDays, int iterations)
+{
+    const double altitudes[4] = {SUNRISESET_STD_ALTITUDE, CIVIL_DAWNDUSK_STD_ALTITUDE,
+                                 NAUTICAL_DAWNDUSK_STD_ALTITUDE, ASTRONOMICAL_DAWNDUSK_STD_ALTITUDE};
+    double sinH0[4];
+    for (int a = 0; a < 4; a++)
+        sinH0[a] = sin(radians(altitudes[a]));
+    double sinLat = sin(radians(latitude));
+    double cosLat = cos(radians(latitude));
+
+    if (numDays <= 0 || numDays > schedule.maxDays)
+        numDays = schedule.maxDays;
+    schedule.firstDay = utc / 86400;
+    schedule.numDays = numDays;
+
+    SolarScheduleCoords c;
+    calcScheduleCoords(schedule.firstDay - 1, c.ra[1], c.dec[1]);
+    calcScheduleCoords(schedule.firstDay, c.ra[2], c.dec[2]);
+
+    for (int i = 0; i < numDays; i++)
+    {
+        long dayNumber = schedule.firstDay + i;
+
+        // Slide the three-day window along, one new set of coordinates per day
+        c.ra[0] = c.ra[1]; c.dec[0] = c.dec[1];
+        c.ra[1] = c.ra[2]; c.dec[1] = c.dec[2];
+        calcScheduleCoords(dayNumber + 1, c.ra[2], c.dec[2]);
+        c.GMST0 = calcGrMeanSiderealTime(JulianDay(static_cast<unsigned long>(dayNumber) * 86400));
+
+        // First approximation, shared by all events (as the first pass of calcSunriseSunset())
+        double dec;
+        double transit = calcScheduleTransit(c, 0.5 - longitude / 360, longitude, dec);
+        double rise[4], set[4];
+        for (int a = 0; a < 4; a++)
+        {
+            double H0 = calcScheduleHourAngle(dec, sinLat, cosLat, sinH0[a]);
+            rise[a] = transit - H0;
+            set[a] = transit + H0;
+        }
+
+        // Refine each event at its own time; transit doesn't depend on the altitude
+        for (int k = 0; k < iterations; k++)
+        {
+            transit = calcScheduleTransit(c, transit, longitude, dec);
+            for (int a = 0; a < 4; a++)
+            {
+                if (isnan(rise[a]))
+                    continue;
+                double t = calcScheduleTransit(c, rise[a], longitude, dec);
+                rise[a] = t - calcScheduleHourAngle(dec, sinLat, cosLat, sinH0[a]);
+                t = calcScheduleTransit(c, set[a], longitude, dec);
+                set[a] = t + calcScheduleHourAngle(dec, sinLat, cosLat, sinH0[a]);
+            }
+        }
+
+        SolarDayEvents &e = schedule.days[i];
+        e.transit = toScheduleTicks(transit);
+        for (int a = 0; a < 4; a++)
+        {
+            e.rise[a] = toScheduleTicks(rise[a]);
+            e.set[a] = toScheduleTicks(set[a]);
+        }
+    }
+}
+
+void calcSolarSchedule(SolarSchedule &schedule, int year, int month, int day, double latitude, double longitude,
+                       int numDays, int iterations)
+{
+    calcSolarSchedule(schedule, static_cast<unsigned long>(calcDayNumber(year, month, day)) * 86400,
+                      latitude, longitude, numDays, iterations);
+}
+
+static double fromScheduleTicks(int16_t t)
+{
+    if (t == SOLAR_EVENT_NONE)
+        return NAN;
+    return t * (SOLAR_SCHEDULE_TICK / 3600.0);
+}
+
+bool getSolarEvents(const SolarSchedule &schedule, unsigned long utc, SolarEventType type,
+                    double &transit, double &rise, double &set)
+{
+    long i = static_cast<long>(utc / 86400) - schedule.firstDay;
+    if (i < 0 || i >= schedule.numDays)
+        return false;
+
+    const SolarDayEvents &e = schedule.days[i];
+    transit = fromScheduleTicks(e.transit);
+    rise = fromScheduleTicks(e.rise[type]);
+    set = fromScheduleTicks(e.set[type]);
+    return true;
+}
+
+bool getSolarEvents(const SolarSchedule &schedule, int year, int month, int day, SolarEventType type,
+                    double &transit, double &rise, double &set)
+{
+    return getSolarEvents(schedule, static_cast<unsigned long>(calcDayNumber(year, month, day)) * 86400,
+                          type, transit, rise, set);
+}
+
 //}  // namespace
@@ -13,6 +13,7 @@
 #ifdef ARDUINO
 #include <Arduino.h>
 #endif
+#include <stdint.h>
 
 //namespace solarcalculator {
 
@@ -123,5 +124,57 @@ void calcAstronomicalDawnDusk(unsigned long utc, double latitude, double longitu
 void calcAstronomicalDawnDusk(int year, int month, int day, double latitude, double longitude,
                               double &transit, double &dawn, double &dusk);
 
+//======================================================================================================================
+// Solar event schedule
+//
+// Times of transit, sunrise and sunset, and civil, nautical and astronomical dawn and dusk for a run of consecutive
+// days at one location, computed in one pass and then looked up as often as needed. The Sun's coordinates are
+// computed once per day and interpolated for each event, and the work common to all four altitudes is shared, so a
+// whole day costs less than a single calcSunriseSunset() call.
+//
+// Times are stored in units of SOLAR_SCHEDULE_TICK seconds after 0h UT, 18 bytes per day.
+//======================================================================================================================
+
+constexpr int SOLAR_SCHEDULE_TICK = 4;           // Seconds per stored time unit
+constexpr int16_t SOLAR_EVENT_NONE = -32768;    // Sun doesn't reach that altitude on that day
+
+enum SolarEventType
+{
+    SUNRISE_SUNSET,
+    CIVIL_DAWNDUSK,
+    NAUTICAL_DAWNDUSK,
+    ASTRONOMICAL_DAWNDUSK
+};
+
+struct SolarDayEvents
+{
+    int16_t transit;  // All in SOLAR_SCHEDULE_TICK units after 0h UT, may be negative or past 24h
+    int16_t rise[4];  // Rise or dawn for each SolarEventType, or SOLAR_EVENT_NONE
+    int16_t set[4];   // Set or dusk for each SolarEventType, or SOLAR_EVENT_NONE
+};
+
+struct SolarSchedule
+{
+    SolarDayEvents *days;  // Storage supplied by the sketch, one entry per day
+    int maxDays;           // Number of entries in days
+    int numDays;           // Number of days computed
+    long firstDay;         // Days since 1 January 1970 of days[0]
+
+    SolarSchedule(SolarDayEvents *storage, int count) : days(storage), maxDays(count), numDays(0), firstDay(0) {}
+};
+
+// Fill the schedule with numDays (at most maxDays, default all) days starting from the given date (UTC)
+void calcSolarSchedule(SolarSchedule &schedule, unsigned long utc, double latitude, double longitude,
+                       int numDays = 0, int iterations = 1);
+void calcSolarSchedule(SolarSchedule &schedule, int year, int month, int day, double latitude, double longitude,
+                       int numDays = 0, int iterations = 1);
+
+// Look up the times of an event pair and transit, in hours, as calcSunriseSunset() would give them; false if the date
+// is not in the schedule. Events that don't happen that day are NaN.
+bool getSolarEvents(const SolarSchedule &schedule, unsigned long utc, SolarEventType type,
+                    double &transit, double &rise, double &set);
+bool getSolarEvents(const SolarSchedule &schedule, int year, int month, int day, SolarEventType type,
+                    double &transit, double &rise, double &set);
+
 //}  // namespace
 #endif  //SOLARCALCULATOR_H
@@ -26,9 +26,10 @@
 \section Intro Introduction
 
 WaveHC is an Arduino library for the Adafruit Wave Shield.  It can play
-uncompressed mono Wave(.WAV) files at sample rate up to 44.1 K samples per
-second. Only the high 12 bits of 16-bit files are used.  Audio files are read
-from an SD flash memory card.
+uncompressed Wave(.WAV) files at sample rate up to 44.1 K samples per
+second. Stereo files are mixed down to mono, and files at higher rates are
+played at half or a quarter of their rate.  Only the high 12 bits of 16-bit
+files are used.  Audio files are read from an SD flash memory card.
 
 Standard SD and high capacity SDHC flash memory cards are supported with
 FAT16 or FAT32 file systems.  The WaveHC only supports short FAT 8.3 names.
@@ -168,21 +169,38 @@ http://www.atmel.com/dyn/resources/prod_documents/doc8161.pdf
 #if PLAYBUFFLEN != 256 && PLAYBUFFLEN != 512
 #error PLAYBUFFLEN must be 256 or 512
 #endif // PLAYBUFFLEN
+#if PLAYBUFFCOUNT < 2
+#error PLAYBUFFCOUNT must be at least 2
+#endif // PLAYBUFFCOUNT
+
+#if DVOLUME
+#define DVOLUME_SHIFT volume ///< software volume, as a shift
+#else // DVOLUME
+#define DVOLUME_SHIFT 0 ///< no software volume
+#endif // DVOLUME
 
 WaveHC *playing = 0;
 
-uint8_t buffer1[PLAYBUFFLEN];
-uint8_t buffer2[PLAYBUFFLEN];
-uint8_t *playend; ///< end position for current buffer
-uint8_t *playpos; ///< position of next sample
-uint8_t *sdbuff;  ///< SD fill buffer
-uint8_t *sdend;   ///< end of data in sd buffer
+// Play buffers hold DAC samples, converted from the wave data as each buffer
+// is read: a byte per sample for 8-bit files, so a buffer holds PLAYBUFFLEN of
+// them, and 12 bits in two bytes for 16-bit files. The DAC plays one buffer
+// while the SD reader fills the others, in order around the ring.
+uint8_t playbuffer[PLAYBUFFCOUNT][PLAYBUFFLEN];
+uint16_t playlen[PLAYBUFFCOUNT]; ///< bytes in each buffer
+uint8_t *playend;                ///< end position for current buffer
+uint8_t *playpos;                ///< position of next sample
+volatile uint8_t playindex;      ///< buffer being played
+volatile uint8_t playready;      ///< buffers filled after the one played
 
 // status of sd
-#define SD_READY 1    ///< buffer is ready to be played
-#define SD_FILLING 2  ///< buffer is being filled from DS
-#define SD_END_FILE 3 ///< reached end of file
-uint8_t sdstatus = 0;
+volatile uint8_t sdfilling = 0; ///< SD read interrupt is filling buffers
+volatile uint8_t sdendfile = 0; ///< reached end of file
+
+// conversion state, carried from one read to the next
+static uint16_t accSum;     ///< sum of samples so far for the next output
+static uint8_t accCount;    ///< number of samples in accSum
+static uint8_t accSamples;  ///< samples averaged into one output
+static uint8_t accShift;    ///< log2(accSamples)
 
 //------------------------------------------------------------------------------
 // timer interrupt for DAC
@@ -191,17 +209,19 @@ ISR(TIMER1_COMPA_vect) {
     return;
 
   if (playpos >= playend) {
-    if (sdstatus == SD_READY) {
-
-      // swap double buffers
-      playpos = sdbuff;
-      playend = sdend;
-      sdbuff = sdbuff != buffer1 ? buffer1 : buffer2;
-
-      sdstatus = SD_FILLING;
-      // interrupt to call SD reader
-      TIMSK1 |= _BV(OCIE1B);
-    } else if (sdstatus == SD_END_FILE) {
+    if (playready) {
+
+      // move on to the next buffer
+      if (++playindex >= PLAYBUFFCOUNT)
+        playindex = 0;
+      playpos = playbuffer[playindex];
+      playend = playpos + playlen[playindex];
+      playready--;
+
+      // interrupt to call SD reader for the buffer just played
+      if (!sdfilling && !sdendfile)
+        TIMSK1 |= _BV(OCIE1B);
+    } else if (sdendfile) {
       playing->stop();
       return;
     } else {
@@ -216,10 +236,11 @@ ISR(TIMER1_COMPA_vect) {
   uint8_t dh, dl;
   if (playing->BitsPerSample == 16) {
 
-    // 16-bit is signed
-    dh = 0X80 ^ playpos[1];
-    dl = playpos[0];
+    // 12 bits, see readPlayData()
+    uint16_t sample = *(uint16_t *)playpos;
     playpos += 2;
+    dh = sample >> 4;
+    dl = sample << 4;
   } else {
 
     // 8-bit is unsigned
@@ -228,13 +249,6 @@ ISR(TIMER1_COMPA_vect) {
     playpos++;
   }
 
-#if DVOLUME
-  uint16_t tmp = (dh << 8) | dl;
-  tmp >>= playing->volume;
-  dh = tmp >> 8;
-  dl = tmp;
-#endif // DVOLUME
-
   // dac chip select low
   mcpDacCsLow();
 
@@ -273,22 +287,31 @@ ISR(TIMER1_COMPB_vect) {
   // turn off calling interrupt
   TIMSK1 &= ~_BV(OCIE1B);
 
-  if (sdstatus != SD_FILLING)
+  if (sdfilling || sdendfile || !playing)
     return;
+  sdfilling = 1;
 
-  // enable interrupts while reading the SD
-  sei();
+  // fill every free buffer, checking again after each one since the DAC
+  // may have finished another meanwhile
+  while (playready < PLAYBUFFCOUNT - 1) {
+    uint8_t i = playindex + 1 + playready;
+    if (i >= PLAYBUFFCOUNT)
+      i -= PLAYBUFFCOUNT;
 
-  int16_t read = playing->readWaveData(sdbuff, PLAYBUFFLEN);
+    // enable interrupts while reading the SD
+    sei();
 
-  cli();
-  if (read > 0) {
-    sdend = sdbuff + read;
-    sdstatus = SD_READY;
-  } else {
-    sdend = sdbuff;
-    sdstatus = SD_END_FILE;
+    int16_t read = playing->readPlayData(playbuffer[i]);
+
+    cli();
+    if (read <= 0) {
+      sdendfile = 1;
+      break;
+    }
+    playlen[i] = read;
+    playready++;
   }
+  sdfilling = 0;
 }
 //------------------------------------------------------------------------------
 /** create an instance of WaveHC. */
@@ -361,11 +384,9 @@ uint8_t WaveHC::create(FatReader &f) {
   }
 
   Channels = buf.fmt.channels;
-  if (Channels > 2) {
+  if (Channels == 0 || Channels > 2) {
     putstring_nl("Not mono/stereo!");
     return false;
-  } else if (Channels > 1) {
-    putstring_nl(" Warning stereo file!");
   }
 
   BitsPerSample = buf.fmt.bitsPerSample;
@@ -375,8 +396,16 @@ uint8_t WaveHC::create(FatReader &f) {
   }
 
   dwSamplesPerSec = buf.fmt.sampleRate;
-  uint32_t clockRate = dwSamplesPerSec * Channels;
-  uint32_t byteRate = clockRate * BitsPerSample / 8;
+  uint32_t byteRate = dwSamplesPerSec * Channels * BitsPerSample / 8;
+
+  // stereo is mixed down, so the DAC runs at the sample rate, or a fraction
+  // of it for rates it can't keep up with
+  rateShift = 0;
+  while ((dwSamplesPerSec >> rateShift) > MAX_CLOCK_RATE &&
+         rateShift < MAX_RATE_SHIFT) {
+    rateShift++;
+  }
+  uint32_t clockRate = dwSamplesPerSec >> rateShift;
 
 #if RATE_ERROR_LEVEL > 0
   if (clockRate > MAX_CLOCK_RATE || byteRate > MAX_BYTE_RATE) {
@@ -439,20 +468,35 @@ void WaveHC::play(void) {
 
   playing = this;
 
+  // average Channels << rateShift samples into each one played
+  if (rateShift > MAX_RATE_SHIFT)
+    rateShift = MAX_RATE_SHIFT;
+  accShift = Channels - 1 + rateShift;
+  accSamples = 1 << accShift;
+  accSum = 0;
+  accCount = 0;
+
   // fill the play buffer
-  read = readWaveData(buffer1, PLAYBUFFLEN);
+  read = readPlayData(playbuffer[0]);
   if (read <= 0)
     return;
-  playpos = buffer1;
-  playend = buffer1 + read;
-
-  // fill the second buffer
-  read = readWaveData(buffer2, PLAYBUFFLEN);
-  if (read < 0)
-    return;
-  sdbuff = buffer2;
-  sdend = sdbuff + read;
-  sdstatus = SD_READY;
+  playindex = 0;
+  playpos = playbuffer[0];
+  playend = playpos + read;
+
+  // fill the buffers to play next
+  sdendfile = 0;
+  sdfilling = 0;
+  for (playready = 0; playready < PLAYBUFFCOUNT - 1; playready++) {
+    read = readPlayData(playbuffer[playready + 1]);
+    if (read < 0)
+      return;
+    if (read == 0) {
+      sdendfile = 1;
+      break;
+    }
+    playlen[playready + 1] = read;
+  }
 
   // its official!
   isplaying = 1;
@@ -465,14 +509,79 @@ void WaveHC::play(void) {
   TCCR1A = 0;
   // no prescaling, CTC mode
   TCCR1B = _BV(WGM12) | _BV(CS10);
-  // Sample rate - play stereo interleaved
-  OCR1A = F_CPU / (dwSamplesPerSec * Channels);
+  // Sample rate, rounded to the nearest timer count
+  uint32_t rate = dwSamplesPerSec >> rateShift;
+  OCR1A = (F_CPU + rate / 2) / rate;
   // SD fill interrupt happens at TCNT1 == 1
   OCR1B = 1;
   // Enable timer interrupt for DAC ISR
   TIMSK1 |= _BV(OCIE1A);
 }
 //------------------------------------------------------------------------------
+/*! Read wave data and convert it to DAC samples.
+ *
+ * @brief Not for use in applications.  Must be public so SD read ISR can access
+ * it. Converting as each buffer is read, rather than in the DAC ISR, keeps the
+ * DAC ISR short for every format: stereo is mixed down to mono, rates are
+ * divided by averaging 1 << rateShift samples, 16-bit samples are cut to 12
+ * bits and the volume shift is applied. 8-bit samples stay 8 bits.
+ * @param buff buffer for PLAYBUFFLEN bytes
+ * @returns the number of bytes stored, zero at the end of the data or -1
+ * for an error.
+ */
+int16_t WaveHC::readPlayData(uint8_t *buff) {
+  int16_t n;
+
+  // 8-bit mono at full rate is played as read
+  if (accSamples == 1 && BitsPerSample != 16) {
+    n = readWaveData(buff, PLAYBUFFLEN);
+#if DVOLUME
+    for (int16_t i = 0; i < n; i++) {
+      buff[i] >>= volume;
+    }
+#endif // DVOLUME
+    return n;
+  }
+
+  // Other formats convert in place from the start: an output sample is never
+  // bigger than the input it came from, so it never gets ahead of it.  A read
+  // may end partway through an output sample; the sum so far is carried over.
+  uint8_t *dst = buff;
+  do {
+    n = readWaveData(buff, PLAYBUFFLEN);
+    uint8_t *src = buff;
+    uint8_t *end = buff + (n > 0 ? n : 0);
+    uint16_t sum = accSum;
+    uint8_t count = accCount;
+    if (BitsPerSample == 16) {
+      // 16-bit is signed
+      for (; src + 1 < end; src += 2) {
+        sum += ((uint8_t)(0X80 ^ src[1]) << 4) | (src[0] >> 4);
+        if (++count == accSamples) {
+          *(uint16_t *)dst = (sum >> accShift) >> DVOLUME_SHIFT;
+          dst += 2;
+          sum = 0;
+          count = 0;
+        }
+      }
+    } else {
+      // 8-bit is unsigned
+      for (; src < end; src++) {
+        sum += *src;
+        if (++count == accSamples) {
+          *dst++ = (sum >> accShift) >> DVOLUME_SHIFT;
+          sum = 0;
+          count = 0;
+        }
+      }
+    }
+    accSum = sum;
+    accCount = count;
+  } while (n > 0 && dst == buff);
+
+  return n < 0 ? -1 : dst - buff;
+}
+//------------------------------------------------------------------------------
 /*! Read wave data.
  *
  * @brief Not for use in applications.  Must be public so SD read ISR can access
@@ -548,6 +657,8 @@ void WaveHC::seek(uint32_t pos) {
     if (fd->seekSet(pos)) {
       // assumes a lot about the wave file
       remainingBytesInChunk = maxPos - pos;
+      accSum = 0;
+      accCount = 0;
     }
   }
   sei();
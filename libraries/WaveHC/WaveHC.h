@@ -29,9 +29,10 @@
 #define OPTIMIZE_CONTIGUOUS 1
 /**
  * Software volume control should be compatible with Ladyada's library.
- * Uses shift to decrease volume by 6 dB per step. See DAC ISR in WaveHC.cpp.
+ * Uses shift to decrease volume by 6 dB per step. Applied as each buffer is
+ * read, see WaveHC::readPlayData(), so a change is heard once the buffers
+ * already read ahead have played.
  * Must be set after call to WaveHC::create().
- * Decreases MAX_CLOCK_RATE to 22050.
  */
 #define DVOLUME 0
 /**
@@ -42,34 +43,52 @@
  */
 #define RATE_ERROR_LEVEL 2
 //------------------------------------------------------------------------------
-// Set the size for wave data buffers.  Must be 256 or 512.
+// Set the size for wave data buffers, which must be 256 or 512, and the
+// number of them.  The DAC plays one while the rest are read ahead.
 #if defined(__AVR_ATmega168P__) || defined(__AVR_ATmega168__)
 
 /** Buffer length for for 168 Arduino. */
 #define PLAYBUFFLEN 256UL
-#else // __AVR_ATmega168P__
 
-/** Buffer length for Arduinos other than 168. */
+/** Number of play buffers for 168 Arduino. */
+#define PLAYBUFFCOUNT 2
+#elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+
+/** Buffer length for Mega. */
 #define PLAYBUFFLEN 512UL
+
+/** Number of play buffers for Mega, which has RAM to read further ahead. */
+#define PLAYBUFFCOUNT 4
+#else // __AVR_ATmega168P__
+
+/** Buffer length for 328 and other Arduinos. */
+#define PLAYBUFFLEN 256UL
+
+/**
+ * Number of play buffers for 328 and other Arduinos.  Four 256 byte buffers
+ * take the same RAM as two of 512 bytes, but read 768 bytes ahead, not 512.
+ */
+#define PLAYBUFFCOUNT 4
 #endif //__AVR_ATmega168P__
 
 // Define max allowed SD read rate in bytes/sec.
-#if PLAYBUFFLEN == 512UL && OPTIMIZE_CONTIGUOUS
-/** Maximum SD read rate for 512 byte buffer and contiguous file */
+#if (PLAYBUFFCOUNT - 1) * PLAYBUFFLEN >= 512UL && OPTIMIZE_CONTIGUOUS
+/** Maximum SD read rate for 512 or more bytes read ahead and contiguous file */
 #define MAX_BYTE_RATE 88200
 #else // MAX_BYTE_RATE
-/** Maximum SD read rate for 256 byte buffer or fragmented file */
+/** Maximum SD read rate for 256 bytes read ahead or fragmented file */
 #define MAX_BYTE_RATE 44100
 #endif // MAX_BYTE_RATE
 
-// Define maximum clock rate for DAC.
-#if !DVOLUME
 /** maximum DAC clock rate */
 #define MAX_CLOCK_RATE 44100
-#else // DVOLUME
-/** Decreased clock rate if volume control is used */
-#define MAX_CLOCK_RATE 22050
-#endif // DVOLUME
+
+/**
+ * Files with higher sample rates than MAX_CLOCK_RATE are played at half or
+ * a quarter of their rate, averaging each 2 or 4 samples. This is the most
+ * the rate is divided by, as a shift.
+ */
+#define MAX_RATE_SHIFT 2
 
 //------------------------------------------------------------------------------
 /**
@@ -88,6 +107,13 @@ public:
   uint32_t dwSamplesPerSec;
   /** Wave file bits per sample.  Must be 8 or 16. */
   uint8_t BitsPerSample;
+  /**
+   * Samples are played at dwSamplesPerSec >> rateShift, averaging
+   * 1 << rateShift samples into one.  Set by create(), to more than zero for
+   * rates over MAX_CLOCK_RATE, and can be raised before play() to save
+   * DAC interrupt time.
+   */
+  uint8_t rateShift;
   /** Remaining bytes to be played in Wave file data chunk. */
   uint32_t remainingBytesInChunk;
   /** Has the value true if a wave file is playing else false. */
@@ -95,7 +121,7 @@ public:
   /** Number of times data was not available from the SD in the DAC ISR */
   uint32_t errors;
 
-  /** Software volume control. Reduce volume by 6 dB per step. See DAC ISR. */
+  /** Software volume control. Reduce volume by 6 dB per step. See DVOLUME. */
   uint8_t volume;
   /** FatReader instance for current wave file. */
   FatReader *fd;
@@ -110,6 +136,7 @@ public:
   uint8_t isPaused(void);
   void pause(void);
   void play(void);
+  int16_t readPlayData(uint8_t *buff);
   int16_t readWaveData(uint8_t *buff, uint16_t len);
   void resume(void);
   void seek(uint32_t pos);
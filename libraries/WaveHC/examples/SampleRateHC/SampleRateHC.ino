@@ -109,9 +109,9 @@ void playcomplete(FatReader &file) {
          putstring("pot = ");
          Serial.println(potval, DEC); 
          putstring("tickspersam = ");
-         Serial.print(wave.dwSamplesPerSec, DEC);
+         Serial.print(wave.dwSamplesPerSec >> wave.rateShift, DEC);
          putstring(" -> ");
-         newsamplerate = wave.dwSamplesPerSec;
+         newsamplerate = wave.dwSamplesPerSec >> wave.rateShift;
          newsamplerate *= potval;
          newsamplerate /= 512;   // we want to 'split' between sped up and slowed down.
         if (newsamplerate > 24000) {
@@ -28,7 +28,11 @@ int8_t  DST_Rules[9]   = { 3,1,2,2, 11,1,1,2, 1 };
 const uint8_t monthDays[]={31,28,31,30,31,30,31,31,30,31,30,31};
 const uint16_t tmDays[]={0,31,59,90,120,151,181,212,243,273,304,334}; // Number days at beginning of month if not leap year
 
-long DSTstart, DSTend;  // start and end of DST for this year, in Year Seconds
+// DST transitions for one year, as clock time_t instants, computed from the
+// rules once a year rather than on every check
+time_t DSTstart, DSTend;     // start and end of DST for that year
+time_t DSTyearStart = 0;     // Jan 1 00:00 of the year they're for
+time_t DSTyearEnd = 0;       // Jan 1 00:00 of the next year, 0 = none yet
 
 
 //#############################################################################
@@ -69,7 +73,7 @@ long yearSeconds(uint16_t yr, uint8_t mo, uint8_t da, uint8_t h, uint8_t m, uint
 long DSTseconds(uint16_t year, uint8_t month, uint8_t doftw, uint8_t week, uint8_t hour)
 {
   uint8_t dom = monthDays[month-1];
-  if ( (month == 2) && (year%4 == 0) )
+  if ( (month == 2) && ((year%4 == 0 && year%100 != 0) || year%400 == 0) )
     dom ++;  // february has 29 days this year
   uint8_t dow = dotw(year, month, 1);  // DOW for 1st day of month for DST event
   int8_t day = doftw - dow;  // number of days until 1st dotw in given month
@@ -87,14 +91,28 @@ long DSTseconds(uint16_t year, uint8_t month, uint8_t doftw, uint8_t week, uint8
 
 //#############################################################################
 // DSTinit()
+// Compute the DST start and end instants for the year of tm from the rules.
+// getDSToffset() calls this itself when tm moves into another year; call it
+// again after changing the rules.
 //#############################################################################
 void DSTinit(time_t tm, int8_t rules[9])
 {
-  uint16_t yr = 2000 + year(tm);  // Year as 20yy; te.Year is not 1970 based
-  // seconds til start of DST this year
-  DSTstart = DSTseconds(yr, rules[0], rules[1], rules[2], rules[3]);  
-  // seconds til end of DST this year
-  DSTend = DSTseconds(yr, rules[4], rules[5], rules[6], rules[7]);  
+  tmElements_t te;
+  uint16_t yr = year(tm);  // Year as 20yy
+  te.Second = 0;
+  te.Minute = 0;
+  te.Hour = 0;
+  te.Day = 1;
+  te.Month = 1;
+  te.Year = CalendarYrToTm(yr);
+  DSTyearStart = makeTime(te);
+  te.Year++;
+  DSTyearEnd = makeTime(te);
+  time_t jan1 = DSTyearStart - SECS_PER_DAY;  // yearSeconds() counts Jan 1 as day 1
+  // start of DST this year
+  DSTstart = jan1 + DSTseconds(yr, rules[0], rules[1], rules[2], rules[3]);
+  // end of DST this year
+  DSTend = jan1 + DSTseconds(yr, rules[4], rules[5], rules[6], rules[7]);
 }
 
 
@@ -111,18 +129,18 @@ void DSTinit(time_t tm, int8_t rules[9])
 //#############################################################################
 uint8_t getDSToffset(time_t tm, int8_t rules[9])
 {
-  uint16_t yr = 2000 + year(tm);  // Year as 20yy; te.Year is not 1970 based
   // if current time & date is at or past the first DST rule and before the second, return 1
   // otherwise return 0
-  long seconds_now = yearSeconds(yr, month(tm), day(tm), hour(tm), minute(tm), second(tm));
+  if ((tm < DSTyearStart) || (tm >= DSTyearEnd))
+    DSTinit(tm, rules);  // new year
   if (DSTstart<DSTend) {  // northern hemisphere
-    if ((seconds_now >= DSTstart) && (seconds_now < DSTend))  // spring ahead
+    if ((tm >= DSTstart) && (tm < DSTend))  // spring ahead
         return(rules[8]);  // return Offset
     else  // fall back
     return(0);  // return 0
   }
-  else {  // southern hemisphere
-    if ((seconds_now >= DSTend) || (seconds_now < DSTstart))  // spring ahead 14nov12/wbp
+  else {  // southern hemisphere, DST spans the new year
+    if ((tm >= DSTstart) || (tm < DSTend))  // spring ahead 14nov12/wbp
       return(rules[8]);  // return Offset
     else  // fall back
     return(0);  // return 0
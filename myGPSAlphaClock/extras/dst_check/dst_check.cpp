@@ -0,0 +1,80 @@
+// Host check for getDSToffset(). For every year 2000-2099 and three sets
+// of rules (US, EU "last Sunday" and Australian, where DST spans the new
+// year) it works out the transitions independently with TimeLib's
+// weekday(), then compares getDSToffset() against them every 15 minutes
+// and at +/-2 s around each transition. Years are walked in order, so the
+// cached year range rolls over the way it does on the clock.
+//
+// Usage: make
+
+#include <TimeLib.h>
+#include <stdio.h>
+#include "adst.h"
+
+unsigned long millis() { return 0; }
+
+// Instant of the n-th (5 = last) weekday dow of a month, at hour hr
+static time_t ruleInstant(int yr, int mo, int dow, int n, int hr) {
+  tmElements_t te = {0, 0, 0, 0, 1, (uint8_t)mo, (uint8_t)CalendarYrToTm(yr)};
+  time_t t = makeTime(te), hit = 0;
+  for (int k = 0; month(t) == mo; t += SECS_PER_DAY) {
+    if (weekday(t) == dow) {
+      hit = t;
+      if (++k == n)
+        break;
+    }
+  }
+  return hit + hr * SECS_PER_HOUR;
+}
+
+static time_t jan1(int yr) {
+  tmElements_t te = {0, 0, 0, 0, 1, 1, (uint8_t)CalendarYrToTm(yr)};
+  return makeTime(te);
+}
+
+int main() {
+  int8_t rules[3][9] = {{3, 1, 2, 2, 11, 1, 1, 2, 1},  // US
+                        {3, 1, 5, 1, 10, 1, 5, 2, 1},  // EU
+                        {10, 1, 1, 2, 4, 1, 1, 3, 1}}; // Australia
+  long checks = 0, bad = 0;
+
+  for (int r = 0; r < 3; r++) {
+    DSTinit(jan1(2000), rules[r]); // new rules
+    for (int yr = 2000; yr <= 2099; yr++) {
+      time_t start = ruleInstant(yr, rules[r][0], rules[r][1], rules[r][2],
+                                 rules[r][3]);
+      time_t end = ruleInstant(yr, rules[r][4], rules[r][5], rules[r][6],
+                               rules[r][7]);
+      time_t t0 = jan1(yr), t1 = jan1(yr + 1);
+      time_t edges[10];
+      for (int d = -2; d <= 2; d++) {
+        edges[d + 2] = start + d;
+        edges[d + 7] = end + d;
+      }
+
+      int e = 0;
+      for (time_t t = t0; t < t1; t += 900) {
+        while ((e < 10) && (edges[e] < t)) { // in time order with the rest
+          time_t x = edges[e++];
+          bool in = (start < end) ? (x >= start && x < end)
+                                  : (x >= start || x < end);
+          checks++;
+          if (getDSToffset(x, rules[r]) != (in ? rules[r][8] : 0)) {
+            if (bad++ < 10)
+              printf("FAIL: rules %d year %d at %ld\n", r, yr, (long)x);
+          }
+        }
+        bool in = (start < end) ? (t >= start && t < end)
+                                : (t >= start || t < end);
+        checks++;
+        if (getDSToffset(t, rules[r]) != (in ? rules[r][8] : 0)) {
+          if (bad++ < 10)
+            printf("FAIL: rules %d year %d at %ld\n", r, yr, (long)t);
+        }
+      }
+    }
+  }
+
+  printf("%ld checks, %ld failed\n", checks, bad);
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,9 @@
+// Just enough of Arduino.h to build adst.cpp and TimeLib on a PC
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+unsigned long millis();
@@ -0,0 +1 @@
+#include <TimeLib.h>
@@ -0,0 +1,215 @@
+// Host check for the streaming RMC parser. Replays midnight.nmea (two and a
+// half minutes of a GPS module's output over the new year, from a cold start
+// with empty RMC sentences, through void ones with the time, to a fix, with
+// a flipped bit, two sentences cut short by the next '$' and a burst of line
+// noise) one character at a time, and checks that rmcFeed() reports exactly
+// the RMC sentences a straightforward split-on-commas parser accepts, with
+// the same time, date and status. Then checks a bad checksum, a '$' restart
+// mid-sentence, empty and void sentences and over-long fields on their own.
+//
+// Usage: make
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "rmc.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL: " __VA_ARGS__);                                            \
+      printf("\n");                                                            \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+struct Fix {
+  int hour, minute, second, day, month, year;
+  char status;
+};
+
+// The reference: what the clock should take from one line, done the slow
+// way. Anything before the last '$' was cut short by it.
+static bool reference(const std::string &line, Fix *f) {
+  std::string s = line.substr(line.rfind('$') == std::string::npos
+                                  ? 0
+                                  : line.rfind('$'));
+  size_t const star = s.find('*'); // at most 90 characters after the '$'
+  if ((s.size() < 7) || (s[0] != '$') || (star == std::string::npos) ||
+      (star > 91) || (s.size() != star + 3))
+    return false;
+  unsigned sum = 0, sent;
+  for (size_t i = 1; i < star; i++) {
+    if ((s[i] < ' ') || (s[i] > '~'))
+      return false;
+    sum ^= (uint8_t)s[i];
+  }
+  if ((sscanf(s.c_str() + star + 1, "%2X", &sent) != 1) || (sent != sum))
+    return false;
+
+  std::vector<std::string> field;
+  size_t p = 1, q;
+  while ((q = s.find_first_of(",*", p)) != std::string::npos) {
+    field.push_back(s.substr(p, q - p));
+    p = q + 1;
+    if (s[q] == '*')
+      break;
+  }
+  if ((field.size() < 10) || (field[0].size() != 5) ||
+      (field[0].compare(2, 3, "RMC") != 0))
+    return false;
+  std::string const &t = field[1], &d = field[9];
+  size_t const td = t.find_first_not_of("0123456789");
+  if ((((td == std::string::npos) ? t.size() : td) != 6) || (d.size() != 6) ||
+      (d.find_first_not_of("0123456789") != std::string::npos))
+    return false;
+  f->hour = atoi(t.substr(0, 2).c_str());
+  f->minute = atoi(t.substr(2, 2).c_str());
+  f->second = atoi(t.substr(4, 2).c_str());
+  f->day = atoi(d.substr(0, 2).c_str());
+  f->month = atoi(d.substr(2, 2).c_str());
+  f->year = atoi(d.substr(4, 2).c_str());
+  f->status = field[2].empty() ? 'V' : field[2][0];
+  return (f->hour < 24) && (f->minute < 60) && (f->second <= 60) &&
+         (f->day >= 1) && (f->day <= 31) && (f->month >= 1) &&
+         (f->month <= 12);
+}
+
+static bool same(const rmcParser_t &p, const Fix &f) {
+  return (p.hour == f.hour) && (p.minute == f.minute) &&
+         (p.second == f.second) && (p.day == f.day) &&
+         (p.month == f.month) && (p.year == f.year) && (p.status == f.status);
+}
+
+static void replay(const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (!in) {
+    perror(path);
+    exit(2);
+  }
+  rmcParser_t p;
+  rmcInit(&p);
+  std::string line;
+  int lines = 0, taken = 0, valid = 0, got = 0, c;
+  while ((c = fgetc(in)) != EOF) {
+    got += rmcFeed(&p, c); // at the CR, or the LF if there isn't one
+    if (c == '\n') {
+      Fix f;
+      bool const want = reference(line, &f);
+      lines++;
+      CHECK(want == (got == 1), "line %d: parser took it %d times, reference "
+            "%s it", lines, got, want ? "takes" : "rejects");
+      CHECK(!want || same(p, f),
+            "line %d: %02d:%02d:%02d %02d/%02d/%02d %c, expected "
+            "%02d:%02d:%02d %02d/%02d/%02d %c",
+            lines, p.hour, p.minute, p.second, p.day, p.month, p.year,
+            p.status, f.hour, f.minute, f.second, f.day, f.month, f.year,
+            f.status);
+      taken += want;
+      valid += want && (f.status == 'A');
+      line.clear();
+      got = 0;
+    } else if (c != '\r') {
+      line += (char)c;
+    }
+  }
+  fclose(in);
+  printf("%s: %d lines, %d RMC sentences taken, %d with a fix\n", path, lines,
+         taken, valid);
+}
+
+// Feed a sentence, with a checksum computed for it if it ends in '*'
+static bool feed(rmcParser_t *p, const char *s, bool lower = false) {
+  char buf[300];
+  size_t const n = strlen(s);
+  if (s[n - 1] == '*') {
+    uint8_t sum = 0;
+    for (const char *c = strrchr(s, '$') + 1; *c != '*'; c++)
+      sum ^= *c;
+    snprintf(buf, sizeof(buf), lower ? "%s%02x\r\n" : "%s%02X\r\n", s, sum);
+  } else {
+    snprintf(buf, sizeof(buf), "%s\r\n", s);
+  }
+  bool got = false;
+  for (const char *c = buf; *c; c++)
+    got |= rmcFeed(p, *c);
+  return got;
+}
+
+static void cases(void) {
+  rmcParser_t p;
+  rmcInit(&p);
+
+  const char *good =
+      "$GPRMC,081836.00,A,3751.65,S,14507.36,E,000.0,360.0,130998,011.3,E*";
+  CHECK(feed(&p, good) && (p.hour == 8) && (p.minute == 18) &&
+            (p.second == 36) && (p.day == 13) && (p.month == 9) &&
+            (p.year == 98) && (p.status == 'A'),
+        "good sentence");
+  CHECK(feed(&p, "$GNRMC,235959,A,,,,,,,311299,,,A*"), "GN talker, no '.'");
+
+  // checksum: wrong, lower case, missing, or not hex
+  CHECK(!feed(&p, "$GPRMC,081836.00,A,,,,,,,130998,,*00"), "bad checksum");
+  CHECK(feed(&p, "$GPRMC,081836.00,A,,,,,,,130998,,*", true),
+        "lower case checksum");
+  CHECK(!feed(&p, "$GPRMC,081836.00,A,,,,,,,130998,,"), "no checksum");
+  CHECK(!feed(&p, "$GPRMC,081836.00,A,,,,,,,130998,,*G1"), "non-hex checksum");
+
+  // a '$' restarts, whatever came before
+  CHECK(feed(&p, "$GPRMC,0818$GPRMC,120000,A,,,,,,,010120,,*") &&
+            (p.hour == 12) && (p.day == 1),
+        "'$' restart inside an RMC sentence");
+  CHECK(feed(&p, "$GPGGA,1$GPRMC,130000,A,,,,,,,010120,,*") && (p.hour == 13),
+        "'$' restart inside another sentence");
+  CHECK(!feed(&p, "$GPRMC,140000,A,,,,,,,010120,,*2$"), "'$' in the checksum");
+
+  // empty and void sentences
+  CHECK(!feed(&p, "$GPRMC,,V,,,,,,,,,,N*"), "empty RMC accepted");
+  CHECK(!feed(&p, "$GPRMC,,,,,,,,,,,*"), "RMC with no fields accepted");
+  CHECK(!feed(&p, "$GPRMC*"), "bare $GPRMC accepted");
+  CHECK(!feed(&p, "$GPRMC,120000,V,,,,,,,,,,N*"), "void RMC without a date");
+  CHECK(feed(&p, "$GPRMC,150000.000,V,,,,,,,020120,,,N*") &&
+            (p.status == 'V') && (p.hour == 15),
+        "void RMC with time and date: the clock can still use it");
+  CHECK(feed(&p, "$GPRMC,160000,,,,,,,,030120,,*") && (p.status == 'V'),
+        "empty status reads as void");
+
+  // fields too long or too short, and digits out of range
+  CHECK(!feed(&p, "$GPRMC,1234567.00,A,,,,,,,010120,,*"), "7-digit time");
+  CHECK(!feed(&p, "$GPRMC,12345.00,A,,,,,,,010120,,*"), "5-digit time");
+  CHECK(!feed(&p, "$GPRMC,123456,A,,,,,,,0101200,,*"), "7-digit date");
+  CHECK(!feed(&p, "$GPRMC,123456,A,,,,,,,01012,,*"), "5-digit date");
+  CHECK(!feed(&p, "$GPRMC,123456,A,,,,,,,01a120,,*"), "letter in the date");
+  CHECK(!feed(&p, "$GPRMC,246000,A,,,,,,,010120,,*"), "hour 24");
+  CHECK(!feed(&p, "$GPRMC,120000,A,,,,,,,011320,,*"), "month 13");
+  CHECK(!feed(&p, "$GPRMC,120000,A,,,,,,,000120,,*"), "day 0");
+  CHECK(!feed(&p, "$GPRMCX,120000,A,,,,,,,010120,,*"), "6-character address");
+  CHECK(!feed(&p, "$GPRMD,120000,A,,,,,,,010120,,*"), "another sentence");
+
+  // a field that never ends, then a good sentence straight after
+  std::string longer = "$GPRMC,120000,A,";
+  longer += std::string(250, '9');
+  longer += ",,,,,,010120,,*";
+  CHECK(!feed(&p, longer.c_str()), "250-character field accepted");
+  CHECK(feed(&p, good) && (p.hour == 8), "good sentence after a long one");
+  std::string padded = "$GPRMC,120000,A,,,,,,,010120,,,";
+  padded += std::string(92 - padded.size(), 'A') + "*";
+  CHECK(!feed(&p, padded.c_str()), "sentence over 90 characters accepted");
+  padded.erase(padded.size() - 2, 1);
+  CHECK(feed(&p, padded.c_str()), "sentence of 90 characters rejected");
+  CHECK(feed(&p, good) && (p.hour == 8), "good sentence after them");
+
+  // a failed sentence leaves the last good values alone
+  CHECK((p.hour == 8) && (p.day == 13), "rejected sentences changed the fix");
+}
+
+int main(int argc, char **argv) {
+  replay(argc > 1 ? argv[1] : "midnight.nmea");
+  cases();
+
+  if (failures)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -20,8 +20,6 @@
 // this should be changed over to use the DS3231 
 #include "DS1307RTC.h" // For optional RTC module. (This library included with the Arduino Time library)
 
-String split_arr[12];
-
 //#define gpsTimeoutLimit 5 // 5 seconds until we display the "no gps" message
 
 unsigned long tGPSupdateUT = 0; // time since last GPS update in UT
@@ -32,50 +30,7 @@ int8_t TZ_hour = -8;
 int8_t TZ_minutes = 0;
 // uint8_t DST_offset = 0;
 
-#define GPSBUFFERSIZE 128 // plenty big
-char gpsBuffer[GPSBUFFERSIZE];
-
-
-//#############################################################################
-// xsplit - split a string into an array of strings at a given delimiter ","
-//#############################################################################
-void xsplit (String mystr) {
-  int i = 0;
-  int a = mystr.indexOf(",");
-  while (a != -1) {
-    split_arr[i] = mystr.substring(0, a);
-    if (a+1 > mystr.length()-1) {
-      break;
-    }
-    mystr = mystr.substring(a+1);
-    a = mystr.indexOf(",");
-    i++;
-    if ( i >= 10) {
-        break;
-    }
-  }
-  if (mystr.length() != 0) {
-    split_arr[i] = mystr;
-  }
-}
-
-//#############################################################################
-// parse the GPS data and update the clock
-//#############################################################################
-uint32_t parsedecimal(char *str)
-{
-    uint32_t d = 0;
-
-    while (str[0] != 0)
-    {
-        if ((str[0] > '9') || (str[0] < '0'))
-            return d; // no more digits
-
-        d = (d * 10) + (str[0] - '0');
-        str++;
-    }
-    return d;
-}
+rmcParser_t gpsRMC; // streaming $GPRMC parser, no buffer needed
 
 //#############################################################################
 // get data from gps and update the clock (if possible)
@@ -84,31 +39,11 @@ void getGPSdata(void)
 {
     //  char charReceived = UDR0;  // get a byte from the port
     char charReceived = Serial1.read();
-    uint8_t bufflen = strlen(gpsBuffer);
-
-    // If the buffer has not been started, check for '$'
-    if ((bufflen == 0) && ('$' != charReceived))
-        return; // wait for start of next sentence from GPS
-
-    if (bufflen < (GPSBUFFERSIZE - 1))
-    { // is there room left? (allow room for null term)
-
-        if ('\r' != charReceived)
-        {                                         // end of sentence?
-            strncat(gpsBuffer, &charReceived, 1); // add char to buffer
-            return;
-        }
-
-        strncat(gpsBuffer, "*", 1); // mark end of buffer just in case
-
-        if (strncmp(gpsBuffer, "$GPRMC", 6) == 0)
-        {
-            Serial.println(gpsBuffer);
-            parseGPSdata(gpsBuffer); // check for GPRMC sentence and set clock
-        }
-    } // if space left in buffer
-    // either buffer is full, or the message has been processed. reset buffer for next message
-    memset(gpsBuffer, 0, GPSBUFFERSIZE); // clear GPS buffer
+
+    // the parser keeps its place between calls, and says when it has seen
+    // the end of an RMC sentence with a good checksum
+    if (rmcFeed(&gpsRMC, charReceived))
+        parseGPSdata(&gpsRMC); // set clock
 } // getGPSdata
 
 // +-------+------------+-------------------------------------------------------------------------------------------+-----------+---------------+
@@ -152,35 +87,17 @@ void getGPSdata(void)
 //#############################################################################
 // parseGPSdata
 //#############################################################################
-void parseGPSdata(char *gpsBuffer) {
+void parseGPSdata(rmcParser_t *rmc) {
   time_t tNow, tDelta;
   tmElements_t tm;
-  uint32_t tmp;
-  char myTime[10];
-  char myDate[10];
-  
-  xsplit(gpsBuffer);
-  // convert string object to char Array so we can use it.
-  split_arr[1].toCharArray(myTime, 10);
-  split_arr[9].toCharArray(myDate, 10);
-        
-  for (int i = 0; i < 10; i++) {
-//    Serial.println(split_arr[i]); // we can see all the eliments of the $GPRMC record without using a walking strtok
-    split_arr[i] = "";
-  }
-  Serial.println(myTime);
-  Serial.println(myDate);
-      
+
   // since we dont need a location fix we can use the datetime date without checking.  only need 1 sattleite.
-  tmp = parsedecimal(myTime); // parse integer portion
-  tm.Hour = tmp / 10000;
-  tm.Minute = (tmp / 100) % 100;
-  tm.Second = tmp % 100;
-  
-  tmp = parsedecimal(myDate);
-  tm.Day = tmp / 10000;
-  tm.Month = (tmp / 100) % 100;
-  tm.Year = tmp % 100;
+  tm.Hour = rmc->hour;
+  tm.Minute = rmc->minute;
+  tm.Second = rmc->second;
+  tm.Day = rmc->day;
+  tm.Month = rmc->month;
+  tm.Year = rmc->year;
   
   tm.Year = y2kYearToTm(tm.Year); // convert yy year to (yyyy-1970) (add 30)
   tNow = makeTime(tm);            // convert to time_t
@@ -190,7 +107,6 @@ void parseGPSdata(char *gpsBuffer) {
       // GPS time jumped more than 1 day
       Serial.println("GPS error");
       //a5tone(2093, 200);
-      strcpy(gpsBuffer, ""); // wipe GPS buffer
       return;
   }
   GPSupdating = false; // valid GPS data received, flip the LED off
@@ -226,6 +142,7 @@ void parseGPSdata(char *gpsBuffer) {
 //#############################################################################
 void GPSinit(uint8_t gps)
 {
+    rmcInit(&gpsRMC);
     tGPSupdate = 0;      // reset GPS last update time
     GPSupdating = false; // GPS not updating yet
 }
@@ -9,6 +9,7 @@
 
 #include "Time.h"
 #include "Arduino.h"
+#include "rmc.h"
 
 // String buffer size:
 //#define GPSBUFFERSIZE 96
@@ -41,7 +42,7 @@ extern unsigned long tGPSupdateUT;
 //void GPSread(void);
 //char *gpsNMEA(void);
 void getGPSdata(void);
-void parseGPSdata(char *gpsBuffer);
+void parseGPSdata(rmcParser_t *rmc);
 
 uint8_t leapyear(uint16_t y);
 //void uart_init(uint16_t BRR);
@@ -1206,8 +1206,8 @@ void loop()
 
     if (GPS_mode)
     {
-        if (Serial1.available()) // wbp
-            getGPSdata();        // wbp
+        while (Serial1.available()) // wbp - take everything waiting, the parser is cheap
+            getGPSdata();           // wbp
         if (GPSupdating)
             EndVCRmode(); // stop flashing the time
     }
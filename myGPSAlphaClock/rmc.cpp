@@ -0,0 +1,163 @@
+/*
+ * Streaming NMEA RMC sentence parser for Alpha Clock Five
+ *
+ * $GPRMC,144326.00,A,5107.0017737,N,11402.3291611,W,0.080,323.3,210307,0.0,E,A*20
+ *        |field 1  |2                                         |field 9
+ *
+ * Only the fields the clock needs are decoded, as the characters arrive: the
+ * time (field 1, digits before any '.'), the status (field 2) and the date
+ * (field 9). Any talker is accepted (GP, GN, GL...) since newer receivers
+ * send $GNRMC.
+ */
+
+#include "rmc.h"
+
+enum {
+    RMC_IDLE,       // waiting for '$'
+    RMC_ADDRESS,    // "GPRMC"
+    RMC_FIELDS,     // data fields, up to '*'
+    RMC_SUM_HI,     // first checksum digit
+    RMC_SUM_LO,     // second checksum digit
+    RMC_END         // waiting for CR or LF
+};
+
+#define RMC_HAVE_TIME 1
+#define RMC_HAVE_DATE 2
+#define RMC_MAX_LENGTH 90 // NMEA allows 82, be a little lenient
+
+static int8_t hexValue(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+        return c - '0';
+    if ((c >= 'A') && (c <= 'F'))
+        return c - 'A' + 10;
+    if ((c >= 'a') && (c <= 'f'))
+        return c - 'a' + 10;
+    return -1;
+}
+
+//#############################################################################
+// rmcInit - reset the parser, call once before feeding it
+//#############################################################################
+void rmcInit(rmcParser_t *p)
+{
+    p->state = RMC_IDLE;
+    p->status = 'V';
+}
+
+//#############################################################################
+// endField - keep the time or date if it had all 6 digits
+//#############################################################################
+static void endField(rmcParser_t *p)
+{
+    if ((p->field == 1) && (p->digits == 6)) {
+        p->time = p->value;
+        p->have |= RMC_HAVE_TIME;
+    } else if ((p->field == 9) && (p->digits == 6) && (p->len == 6)) {
+        p->date = p->value;
+        p->have |= RMC_HAVE_DATE;
+    }
+}
+
+//#############################################################################
+// rmcFeed - process one character from the GPS
+// returns true when a complete RMC sentence with a good checksum and a full
+// time and date has been received; the results are then in p
+//#############################################################################
+uint8_t rmcFeed(rmcParser_t *p, char c)
+{
+    if (c == '$') { // always starts a new sentence, even mid-sentence
+        p->state = RMC_ADDRESS;
+        p->count = 0;
+        p->field = 0;
+        p->len = 0;
+        p->sum = 0;
+        return false;
+    }
+
+    switch (p->state) {
+    case RMC_ADDRESS: // 2 talker characters, "RMC", then ','
+        if (c == ',') {
+            if (p->len != 5)
+                break;
+            p->sum ^= c;
+            p->count++;
+            p->state = RMC_FIELDS;
+            p->field = 1;
+            p->len = 0;
+            p->digits = 0;
+            p->value = 0;
+            p->have = 0;
+            p->fix = 'V';
+            return false;
+        }
+        if ((p->len >= 5) || ((p->len >= 2) && (c != "RMC"[p->len - 2])))
+            break; // some other sentence
+        p->sum ^= c;
+        p->count++;
+        p->len++;
+        return false;
+
+    case RMC_FIELDS:
+        if (c == '*') {
+            endField(p);
+            p->state = RMC_SUM_HI;
+            return false;
+        }
+        if ((c < ' ') || (c > '~') || (++p->count > RMC_MAX_LENGTH))
+            break; // line noise, drop the sentence
+        p->sum ^= c;
+        if (c == ',') {
+            endField(p);
+            p->field++;
+            p->len = 0;
+            p->digits = 0;
+            p->value = 0;
+            return false;
+        }
+        if ((p->field == 1) || (p->field == 9)) {
+            if ((c >= '0') && (c <= '9') && (p->digits == p->len)) {
+                if (p->digits < 6)
+                    p->value = p->value * 10 + (c - '0');
+                p->digits++; // a 7th leading digit spoils the field
+            }
+        } else if ((p->field == 2) && (p->len == 0)) {
+            p->fix = c;
+        }
+        if (p->len < 255)
+            p->len++;
+        return false;
+
+    case RMC_SUM_HI:
+    case RMC_SUM_LO: {
+        int8_t h = hexValue(c);
+        if (h < 0)
+            break;
+        p->rxsum = (p->state == RMC_SUM_HI) ? (h << 4) : (p->rxsum | h);
+        p->state++;
+        return false;
+    }
+
+    case RMC_END: {
+        if ((c != '\r') && (c != '\n'))
+            break;
+        p->state = RMC_IDLE;
+        if ((p->rxsum != p->sum) || (p->have != (RMC_HAVE_TIME | RMC_HAVE_DATE)))
+            return false;
+        uint8_t hh = p->time / 10000, mm = (p->time / 100) % 100, ss = p->time % 100;
+        uint8_t dd = p->date / 10000, mo = (p->date / 100) % 100;
+        if ((hh > 23) || (mm > 59) || (ss > 60) || (dd < 1) || (dd > 31) || (mo < 1) || (mo > 12))
+            return false; // garbled digits with a lucky checksum
+        p->hour = hh;
+        p->minute = mm;
+        p->second = ss;
+        p->day = dd;
+        p->month = mo;
+        p->year = p->date % 100;
+        p->status = p->fix;
+        return true;
+    }
+    }
+    p->state = RMC_IDLE;
+    return false;
+}
@@ -0,0 +1,41 @@
+/*
+ * Streaming NMEA RMC sentence parser for Alpha Clock Five
+ *
+ * Takes the GPS serial data one character at a time and pulls the UTC time,
+ * date and position status out of $xxRMC sentences as they go by. Nothing is
+ * buffered and nothing is allocated, so it can run for months without
+ * fragmenting the heap, and the time is ready as soon as the end of the
+ * sentence arrives. Sentences with a bad or missing checksum are ignored.
+ *
+ * No Arduino dependencies, so it can be tested on a PC with recorded logs.
+ */
+
+#ifndef RMC_H_
+#define RMC_H_
+
+#include <stdint.h>
+
+typedef struct {
+    // filled in when rmcFeed() returns true
+    uint8_t hour, minute, second;
+    uint8_t day, month, year;   // year is 2 digits, as sent
+    char status;                // 'A' = data valid, 'V' = no fix (time may still be good)
+
+    // parser state, private
+    uint8_t state;
+    uint8_t count;              // characters so far in this sentence
+    uint8_t field;              // field number within the sentence, 0 = address
+    uint8_t len;                // characters so far in this field
+    uint8_t digits;             // leading digits so far in this field
+    uint8_t have;               // which of time and date were complete
+    char fix;                   // status field of this sentence
+    uint8_t sum;                // running XOR checksum
+    uint8_t rxsum;              // checksum sent with the sentence
+    uint32_t value;             // leading digits of the current field
+    uint32_t time, date;        // hhmmss and ddmmyy of this sentence
+} rmcParser_t;
+
+void rmcInit(rmcParser_t *p);
+uint8_t rmcFeed(rmcParser_t *p, char c);
+
+#endif // RMC_H_